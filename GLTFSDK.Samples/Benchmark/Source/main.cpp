@@ -0,0 +1,377 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/AnimationUtils.h>
+#include <GLTFSDK/Color.h>
+#include <GLTFSDK/BoundsUtils.h>
+#include <GLTFSDK/ConversionUtils.h>
+#include <GLTFSDK/Document.h>
+#include <GLTFSDK/FlatSceneGraph.h>
+#include <GLTFSDK/Math.h>
+#include <GLTFSDK/MeshPrimitiveUtils.h>
+#include <GLTFSDK/TransformUpdater.h>
+#include <GLTFSDK/Traverse.h>
+
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <cstdlib>
+
+using namespace Microsoft::glTF;
+
+namespace
+{
+    const size_t ComponentCount = 1U << 20;
+    const size_t Iterations = 20U;
+
+    // Returns the average duration (in milliseconds) of a single call to fn
+    double Measure(const std::function<void()>& fn)
+    {
+        fn(); // Warm up the caches
+
+        const auto start = std::chrono::high_resolution_clock::now();
+
+        for (size_t i = 0; i < Iterations; ++i)
+        {
+            fn();
+        }
+
+        const std::chrono::duration<double, std::milli> duration = std::chrono::high_resolution_clock::now() - start;
+
+        return duration.count() / Iterations;
+    }
+
+    void PrintResult(const std::string& name, double baseline, double optimized)
+    {
+        std::cout << std::left << std::setw(32) << name << std::right << std::fixed << std::setprecision(3)
+            << std::setw(10) << baseline << " ms"
+            << std::setw(10) << optimized << " ms"
+            << std::setw(8) << std::setprecision(1) << (baseline / optimized) << "x\n";
+    }
+
+    template<typename T>
+    std::vector<T> GenerateComponents(size_t count)
+    {
+        std::vector<T> values(count);
+        uint32_t state = 12345U;
+
+        for (auto& value : values)
+        {
+            state = state * 1664525U + 1013904223U;
+            value = static_cast<T>(state >> 8);
+        }
+
+        return values;
+    }
+
+    std::vector<float> GenerateUnormFloats(size_t count)
+    {
+        auto values = GenerateComponents<uint16_t>(count);
+
+        std::vector<float> floats(count);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            floats[i] = values[i] / 65535.0f;
+        }
+
+        return floats;
+    }
+
+    // Compares ConversionUtils::ToFloat against the equivalent per-component scalar loop
+    template<typename T>
+    void BenchmarkToFloat(const std::string& name, ComponentType componentType)
+    {
+        const auto components = GenerateComponents<T>(ComponentCount);
+
+        std::vector<float> output(ComponentCount);
+
+        const double baseline = Measure([&]()
+        {
+            for (size_t i = 0; i < ComponentCount; ++i)
+            {
+                output[i] = AnimationUtils::ComponentToFloat(components[i]);
+            }
+        });
+
+        const double optimized = Measure([&]()
+        {
+            ConversionUtils::ToFloat(components.data(), componentType, true, output.data(), ComponentCount);
+        });
+
+        PrintResult(name, baseline, optimized);
+    }
+
+    void BenchmarkConversions()
+    {
+        std::cout << "Component conversion (" << ComponentCount << " components, scalar vs. ConversionUtils)\n";
+
+        BenchmarkToFloat<int8_t>("BYTE -> float", COMPONENT_BYTE);
+        BenchmarkToFloat<uint8_t>("UNSIGNED_BYTE -> float", COMPONENT_UNSIGNED_BYTE);
+        BenchmarkToFloat<int16_t>("SHORT -> float", COMPONENT_SHORT);
+        BenchmarkToFloat<uint16_t>("UNSIGNED_SHORT -> float", COMPONENT_UNSIGNED_SHORT);
+
+        {
+            const auto components = GenerateComponents<uint16_t>(ComponentCount);
+            std::vector<uint8_t> output(ComponentCount);
+
+            const double baseline = Measure([&]()
+            {
+                for (size_t i = 0; i < ComponentCount; ++i)
+                {
+                    output[i] = Math::FloatToByte(AnimationUtils::ComponentToFloat(components[i]));
+                }
+            });
+
+            const double optimized = Measure([&]()
+            {
+                ConversionUtils::ToUnorm8(components.data(), COMPONENT_UNSIGNED_SHORT, output.data(), ComponentCount);
+            });
+
+            PrintResult("UNSIGNED_SHORT -> unorm8", baseline, optimized);
+        }
+
+        {
+            const auto components = GenerateUnormFloats(ComponentCount);
+            std::vector<uint16_t> output(ComponentCount);
+
+            // Float components aren't guaranteed to be within [0, 1] so the baseline clamps them (NaN to zero) as ToUnorm16 does
+            const double baseline = Measure([&]()
+            {
+                for (size_t i = 0; i < ComponentCount; ++i)
+                {
+                    const float value = components[i];
+                    const float clamped = (value > 0.0f) ? ((value < 1.0f) ? value : 1.0f) : 0.0f;
+
+                    output[i] = static_cast<uint16_t>(clamped * 65535.0f + 0.5f);
+                }
+            });
+
+            const double optimized = Measure([&]()
+            {
+                ConversionUtils::ToUnorm16(components.data(), COMPONENT_FLOAT, output.data(), ComponentCount);
+            });
+
+            PrintResult("FLOAT -> unorm16", baseline, optimized);
+        }
+
+        {
+            const auto components = GenerateUnormFloats(ComponentCount);
+            std::vector<uint32_t> output(ComponentCount / 4U);
+
+            // The baseline constructs a Color4 per element, as MeshPrimitiveUtils::GetColors previously did
+            const double baseline = Measure([&]()
+            {
+                for (size_t i = 0; i < output.size(); ++i)
+                {
+                    const float* c = components.data() + i * 4U;
+                    output[i] = Color4(c[0], c[1], c[2], c[3]).AsUint32RGBA();
+                }
+            });
+
+            const double optimized = Measure([&]()
+            {
+                ConversionUtils::ToRGBA8(components.data(), COMPONENT_FLOAT, 4U, output.data(), output.size());
+            });
+
+            PrintResult("FLOAT VEC4 -> RGBA8", baseline, optimized);
+        }
+
+        {
+            const auto components = GenerateComponents<uint16_t>(ComponentCount);
+            std::vector<uint32_t> output(ComponentCount / 3U);
+
+            const double baseline = Measure([&]()
+            {
+                for (size_t i = 0; i < output.size(); ++i)
+                {
+                    const uint16_t* c = components.data() + i * 3U;
+                    output[i] = Color3(
+                        AnimationUtils::ComponentToFloat(c[0]),
+                        AnimationUtils::ComponentToFloat(c[1]),
+                        AnimationUtils::ComponentToFloat(c[2])).AsUint32RGBA();
+                }
+            });
+
+            const double optimized = Measure([&]()
+            {
+                ConversionUtils::ToRGBA8(components.data(), COMPONENT_UNSIGNED_SHORT, 3U, output.data(), output.size());
+            });
+
+            PrintResult("UNSIGNED_SHORT VEC3 -> RGBA8", baseline, optimized);
+        }
+    }
+
+    void BenchmarkTriangulation()
+    {
+        const size_t indexCount = 1U << 24;
+
+        std::cout << "\nTriangulation (" << indexCount << " indices, scalar vs. MeshPrimitiveUtils)\n";
+
+        std::vector<uint32_t> indices(indexCount);
+        std::iota(indices.begin(), indices.end(), 0U);
+
+        std::vector<uint32_t> output((indexCount - 2U) * 3U);
+
+        // The baseline is the previous implementation, which tested whether each triangle was odd or even
+        const double baseline = Measure([&]()
+        {
+            std::vector<uint32_t> triangles;
+
+            for (size_t i = 0; i < indexCount - 2U; i++)
+            {
+                if (i % 2 == 0)
+                {
+                    triangles.push_back(indices[i]);
+                    triangles.push_back(indices[i + 1]);
+                    triangles.push_back(indices[i + 2]);
+                }
+                else
+                {
+                    triangles.push_back(indices[i]);
+                    triangles.push_back(indices[i + 2]);
+                    triangles.push_back(indices[i + 1]);
+                }
+            }
+        });
+
+        const double optimized = Measure([&]()
+        {
+            MeshPrimitiveUtils::TriangulateIndices32(indices.data(), indices.size(), MESH_TRIANGLE_STRIP, StridedSpan<uint32_t>(output.data(), output.size()));
+        });
+
+        PrintResult("TRIANGLE_STRIP", baseline, optimized);
+    }
+
+    // A scene with a single root and a complete tree of nodes below it, each with four children
+    Document GenerateScene(size_t nodeCount)
+    {
+        Document doc;
+
+        for (size_t i = 0; i < nodeCount; ++i)
+        {
+            Node node;
+            node.id = std::to_string(i);
+            node.translation = Vector3(1.0f, 0.0f, 0.0f);
+
+            for (size_t child = i * 4U + 1U; child <= i * 4U + 4U && child < nodeCount; ++child)
+            {
+                node.children.push_back(std::to_string(child));
+            }
+
+            doc.nodes.Append(std::move(node));
+        }
+
+        Scene scene;
+        scene.id = "0";
+        scene.nodes = { "0" };
+
+        doc.SetDefaultScene(std::move(scene));
+
+        return doc;
+    }
+
+    void BenchmarkSceneGraph()
+    {
+        const size_t nodeCount = 1U << 20;
+
+        std::cout << "\nScene graph (" << nodeCount << " nodes, Traverse vs. FlatSceneGraph)\n";
+
+        const auto doc = GenerateScene(nodeCount);
+        const FlatSceneGraph sceneGraph(doc);
+
+        {
+            size_t count = 0U;
+
+            const double baseline = Measure([&]()
+            {
+                Traverse(doc, DefaultSceneIndex, [&count](const Node& node, const Node* parent)
+                {
+                    count += node.children.size() + (parent ? 1U : 0U);
+                });
+            });
+
+            const double optimized = Measure([&]()
+            {
+                sceneGraph.Traverse(doc, [&count](const Node& node, const Node* parent)
+                {
+                    count += node.children.size() + (parent ? 1U : 0U);
+                });
+            });
+
+            PrintResult("Depth first traversal", baseline, optimized);
+        }
+
+        {
+            // The baseline propagates transforms during a traversal, looking up each parent's world transform
+            std::unordered_map<const Node*, Matrix4> worldTransformMap;
+
+            const double baseline = Measure([&]()
+            {
+                Traverse(doc, DefaultSceneIndex, [&worldTransformMap](const Node& node, const Node* parent)
+                {
+                    const auto localTransform = BoundsUtils::GetLocalTransform(node);
+
+                    worldTransformMap[&node] = parent ? Math::Multiply(worldTransformMap[parent], localTransform) : localTransform;
+                });
+            });
+
+            std::vector<Matrix4> worldTransforms(sceneGraph.GetNodeCount());
+
+            const double optimized = Measure([&]()
+            {
+                const auto localTransforms = sceneGraph.GetLocalTransforms(doc);
+
+                sceneGraph.ComputeWorldTransforms(localTransforms.data(), worldTransforms.data());
+            });
+
+            PrintResult("World transforms", baseline, optimized);
+        }
+
+        {
+            const auto localTransforms = sceneGraph.GetLocalTransforms(doc);
+
+            std::vector<Matrix4> worldTransforms(sceneGraph.GetNodeCount());
+
+            const double baseline = Measure([&]()
+            {
+                sceneGraph.ComputeWorldTransforms(localTransforms.data(), worldTransforms.data());
+            });
+
+            TransformUpdater updater(sceneGraph, localTransforms);
+
+            const double optimized = Measure([&]()
+            {
+                updater.UpdateAll();
+            });
+
+            PrintResult("World transforms (parallel)", baseline, optimized);
+        }
+    }
+}
+
+int main(int, char*[])
+{
+    try
+    {
+        BenchmarkConversions();
+        BenchmarkTriangulation();
+        BenchmarkSceneGraph();
+    }
+    catch (const std::runtime_error& ex)
+    {
+        std::cerr << "Error! - ";
+        std::cerr << ex.what() << "\n";
+
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
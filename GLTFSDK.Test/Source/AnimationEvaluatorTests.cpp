@@ -0,0 +1,204 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+#include <GLTFSDK/AnimationEvaluator.h>
+#include <GLTFSDK/BufferBuilder.h>
+#include <GLTFSDK/GLTF.h>
+#include <GLTFSDK/GLTFResourceReader.h>
+#include <GLTFSDK/GLTFResourceWriter.h>
+
+#include "TestUtils.h"
+
+#include <cmath>
+
+using namespace glTF::UnitTest;
+
+namespace
+{
+    using namespace Microsoft::glTF;
+
+    std::vector<float> Sample(const AnimationCurve& curve, float time, RotationInterpolation rotationInterpolation = RotationInterpolation::Slerp)
+    {
+        std::vector<float> output(curve.componentCount);
+        size_t cursor = 0U;
+
+        AnimationEvaluator::Sample(curve, time, cursor, output.data(), rotationInterpolation);
+
+        return output;
+    }
+}
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Test
+        {
+            GLTFSDK_TEST_CLASS(AnimationEvaluatorTests)
+            {
+                GLTFSDK_TEST_METHOD(AnimationEvaluatorTests, AnimationEvaluator_Test_FindKeyframe)
+                {
+                    const std::vector<float> times = { 0.0f, 1.0f, 2.0f, 3.0f, 4.0f };
+
+                    for (size_t cursor = 0U; cursor < 6U; ++cursor)
+                    {
+                        Assert::AreEqual<size_t>(0U, AnimationEvaluator::FindKeyframe(times, -1.0f, cursor));
+                        Assert::AreEqual<size_t>(0U, AnimationEvaluator::FindKeyframe(times, 0.5f, cursor));
+                        Assert::AreEqual<size_t>(1U, AnimationEvaluator::FindKeyframe(times, 1.0f, cursor));
+                        Assert::AreEqual<size_t>(2U, AnimationEvaluator::FindKeyframe(times, 2.5f, cursor));
+                        Assert::AreEqual<size_t>(3U, AnimationEvaluator::FindKeyframe(times, 3.5f, cursor));
+                        Assert::AreEqual<size_t>(3U, AnimationEvaluator::FindKeyframe(times, 4.0f, cursor));
+                        Assert::AreEqual<size_t>(3U, AnimationEvaluator::FindKeyframe(times, 10.0f, cursor));
+                    }
+
+                    Assert::AreEqual<size_t>(0U, AnimationEvaluator::FindKeyframe({ 1.0f }, 2.0f));
+                }
+
+                GLTFSDK_TEST_METHOD(AnimationEvaluatorTests, AnimationEvaluator_Test_Sample)
+                {
+                    AnimationCurve curve;
+                    curve.path = TARGET_TRANSLATION;
+                    curve.componentCount = 3U;
+                    curve.times = { 1.0f, 2.0f, 4.0f };
+                    curve.values = { 0.0f, 0.0f, 0.0f, 2.0f, 4.0f, 6.0f, 0.0f, 0.0f, 0.0f };
+
+                    // Times are clamped to the first and last keyframes
+                    AreNear({ 0.0f, 0.0f, 0.0f }, Sample(curve, 0.0f).data());
+                    AreNear({ 0.0f, 0.0f, 0.0f }, Sample(curve, 5.0f).data());
+
+                    AreNear({ 1.0f, 2.0f, 3.0f }, Sample(curve, 1.5f).data());
+                    AreNear({ 1.0f, 2.0f, 3.0f }, Sample(curve, 3.0f).data());
+
+                    curve.interpolation = INTERPOLATION_STEP;
+                    AreNear({ 0.0f, 0.0f, 0.0f }, Sample(curve, 1.9f).data());
+                    AreNear({ 2.0f, 4.0f, 6.0f }, Sample(curve, 2.0f).data());
+                    AreNear({ 2.0f, 4.0f, 6.0f }, Sample(curve, 3.9f).data());
+
+                    // With zero tangents a cubic spline eases in and out: 3s^2 - 2s^3
+                    AnimationCurve cubic;
+                    cubic.path = TARGET_WEIGHTS;
+                    cubic.interpolation = INTERPOLATION_CUBICSPLINE;
+                    cubic.componentCount = 1U;
+                    cubic.times = { 0.0f, 2.0f };
+                    cubic.values = { 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f };
+
+                    AreNear({ 0.15625f }, Sample(cubic, 0.5f).data());
+                    AreNear({ 0.5f }, Sample(cubic, 1.0f).data());
+
+                    // A unit out-tangent adds (s^3 - 2s^2 + s) * dt
+                    cubic.values[2] = 1.0f;
+                    AreNear({ 0.5f + 0.25f }, Sample(cubic, 1.0f).data());
+
+                    // A quarter turn about y, interpolated along the shortest arc even though the second key is negated
+                    const float s = std::sqrt(0.5f);
+
+                    AnimationCurve rotation;
+                    rotation.path = TARGET_ROTATION;
+                    rotation.componentCount = 4U;
+                    rotation.times = { 0.0f, 1.0f };
+                    rotation.values = { 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, -s, 0.0f, -s };
+
+                    const float sin = std::sin(3.14159265f / 16.0f);
+                    const float cos = std::cos(3.14159265f / 16.0f);
+
+                    AreNear({ 0.0f, sin, 0.0f, cos }, Sample(rotation, 0.25f).data());
+
+                    // Nlerp only matches slerp at the midpoint
+                    const float sin8 = std::sin(3.14159265f / 8.0f);
+                    const float cos8 = std::cos(3.14159265f / 8.0f);
+
+                    AreNear({ 0.0f, sin8, 0.0f, cos8 }, Sample(rotation, 0.5f, RotationInterpolation::Nlerp).data());
+
+                    const auto nlerp = Sample(rotation, 0.25f, RotationInterpolation::Nlerp);
+                    Assert::IsTrue(std::abs(nlerp[1] * nlerp[1] + nlerp[3] * nlerp[3] - 1.0f) < 1.0e-5f);
+                    Assert::IsTrue(std::abs(nlerp[1] - sin) > 1.0e-3f);
+                }
+
+                GLTFSDK_TEST_METHOD(AnimationEvaluatorTests, AnimationEvaluator_Test_Evaluate)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+                    bufferBuilder.AddBufferView(BufferViewTarget::UNKNOWN_BUFFER);
+
+                    const auto timesId = bufferBuilder.AddAccessor(std::vector<float>({ 0.0f, 1.0f, 2.0f }), { TYPE_SCALAR, COMPONENT_FLOAT, false, { 0.0f }, { 2.0f } }).id;
+                    const auto translationsId = bufferBuilder.AddAccessor(std::vector<float>({ 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f }), { TYPE_VEC3, COMPONENT_FLOAT }).id;
+                    const auto weightsId = bufferBuilder.AddAccessor(std::vector<float>({ 1.0f, 0.0f, 0.0f, 1.0f, 0.5f, 0.5f }), { TYPE_SCALAR, COMPONENT_FLOAT }).id;
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    Animation animation;
+
+                    AnimationSampler weightsSampler;
+                    weightsSampler.id = "0";
+                    weightsSampler.inputAccessorId = timesId;
+                    weightsSampler.outputAccessorId = weightsId;
+                    weightsSampler.interpolation = INTERPOLATION_STEP;
+                    animation.samplers.Append(weightsSampler);
+
+                    AnimationSampler translationSampler;
+                    translationSampler.id = "1";
+                    translationSampler.inputAccessorId = timesId;
+                    translationSampler.outputAccessorId = translationsId;
+                    animation.samplers.Append(translationSampler);
+
+                    // The weights channel is first but the outputs are grouped by target path
+                    AnimationChannel weightsChannel;
+                    weightsChannel.id = "0";
+                    weightsChannel.samplerId = "0";
+                    weightsChannel.target.nodeId = "a";
+                    weightsChannel.target.path = TARGET_WEIGHTS;
+                    animation.channels.Append(weightsChannel);
+
+                    for (const auto nodeId : { "b", "c" })
+                    {
+                        AnimationChannel channel;
+                        channel.id = std::to_string(animation.channels.Size());
+                        channel.samplerId = "1";
+                        channel.target.nodeId = nodeId;
+                        channel.target.path = TARGET_TRANSLATION;
+                        animation.channels.Append(channel);
+                    }
+
+                    GLTFResourceReader reader(readerWriter);
+                    AnimationEvaluator evaluator(doc, reader, animation);
+
+                    Assert::AreEqual<size_t>(3U, evaluator.GetChannelCount());
+                    Assert::AreEqual<std::string>("c", evaluator.GetNodeId(2U));
+                    Assert::AreEqual<size_t>(2U, evaluator.GetCurve(0U).componentCount);
+                    Assert::AreEqual<size_t>(0U, evaluator.GetOutputOffset(0U));
+                    Assert::AreEqual<size_t>(0U, evaluator.GetOutputOffset(1U));
+                    Assert::AreEqual<size_t>(3U, evaluator.GetOutputOffset(2U));
+                    Assert::AreEqual(0.0f, evaluator.GetStartTime());
+                    Assert::AreEqual(2.0f, evaluator.GetEndTime());
+
+                    Assert::AreEqual<size_t>(6U, evaluator.GetOutput(TARGET_TRANSLATION).size());
+                    Assert::AreEqual<size_t>(2U, evaluator.GetOutput(TARGET_WEIGHTS).size());
+                    Assert::IsTrue(evaluator.GetOutput(TARGET_ROTATION).empty());
+
+                    // Forwards and then backwards so that the cursors are both reused and reset
+                    for (const float time : { 0.5f, 1.5f, 3.0f, 1.5f, 0.5f })
+                    {
+                        evaluator.Evaluate(time);
+
+                        const auto& translations = evaluator.GetOutput(TARGET_TRANSLATION);
+                        const auto& weights = evaluator.GetOutput(TARGET_WEIGHTS);
+
+                        const std::vector<float> expected = time < 1.0f
+                            ? std::vector<float>({ time, 0.0f, 0.0f })
+                            : std::vector<float>({ 1.0f, std::min(1.0f, time - 1.0f), 0.0f });
+
+                        AreNear(expected, translations.data());
+                        AreNear(expected, translations.data() + 3U);
+
+                        AreNear(time < 1.0f ? std::vector<float>({ 1.0f, 0.0f }) : (time < 2.0f ? std::vector<float>({ 0.0f, 1.0f }) : std::vector<float>({ 0.5f, 0.5f })), weights.data());
+                    }
+                }
+            };
+        }
+    }
+}
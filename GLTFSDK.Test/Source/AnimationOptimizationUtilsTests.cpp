@@ -0,0 +1,187 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+#include <GLTFSDK/AnimationOptimizationUtils.h>
+#include <GLTFSDK/BufferBuilder.h>
+#include <GLTFSDK/GLTF.h>
+#include <GLTFSDK/GLTFResourceReader.h>
+#include <GLTFSDK/GLTFResourceWriter.h>
+
+#include "TestUtils.h"
+
+#include <cmath>
+
+using namespace glTF::UnitTest;
+
+namespace
+{
+    using namespace Microsoft::glTF;
+
+    const float HalfPi = 1.57079633f;
+
+    // A quarter turn about y sampled at 60Hz over a second
+    AnimationCurve GetRotationCurve()
+    {
+        AnimationCurve curve;
+        curve.path = TARGET_ROTATION;
+        curve.componentCount = 4U;
+
+        for (size_t i = 0U; i <= 60U; ++i)
+        {
+            const float t = i / 60.0f;
+
+            curve.times.push_back(t);
+            curve.values.insert(curve.values.end(), { 0.0f, std::sin(t * HalfPi * 0.5f), 0.0f, std::cos(t * HalfPi * 0.5f) });
+        }
+
+        return curve;
+    }
+
+    // A translation along x for a second and then along y for a second, sampled at 60Hz
+    AnimationCurve GetTranslationCurve()
+    {
+        AnimationCurve curve;
+        curve.path = TARGET_TRANSLATION;
+        curve.componentCount = 3U;
+
+        for (size_t i = 0U; i <= 120U; ++i)
+        {
+            const float t = i / 60.0f;
+
+            curve.times.push_back(t);
+            curve.values.insert(curve.values.end(), { std::min(t, 1.0f), std::max(t - 1.0f, 0.0f), 0.0f });
+        }
+
+        return curve;
+    }
+}
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Test
+        {
+            GLTFSDK_TEST_CLASS(AnimationOptimizationUtilsTests)
+            {
+                GLTFSDK_TEST_METHOD(AnimationOptimizationUtilsTests, AnimationOptimizationUtils_Test_ReduceKeyframes)
+                {
+                    const auto translations = AnimationOptimizationUtils::ReduceKeyframes(GetTranslationCurve(), 1.0e-4f);
+
+                    Assert::AreEqual<size_t>(3U, translations.times.size());
+                    Assert::AreEqual(1.0f, translations.times[1]);
+                    Assert::AreEqual<size_t>(9U, translations.values.size());
+
+                    // Slerp reconstructs the rotation exactly while a negative tolerance keeps every keyframe
+                    const auto rotation = GetRotationCurve();
+
+                    Assert::AreEqual<size_t>(2U, AnimationOptimizationUtils::ReduceKeyframes(rotation, 1.0e-3f).times.size());
+                    Assert::AreEqual<size_t>(rotation.times.size(), AnimationOptimizationUtils::ReduceKeyframes(rotation, -1.0f).times.size());
+
+                    AnimationCurve step;
+                    step.path = TARGET_WEIGHTS;
+                    step.interpolation = INTERPOLATION_STEP;
+                    step.componentCount = 1U;
+                    step.times = { 0.0f, 1.0f, 2.0f, 3.0f, 4.0f };
+                    step.values = { 0.0f, 0.0f, 1.0f, 1.0f, 1.0f };
+
+                    const auto reducedStep = AnimationOptimizationUtils::ReduceKeyframes(step, 1.0e-3f);
+
+                    AreEqual(std::vector<float>({ 0.0f, 2.0f, 4.0f }), reducedStep.times);
+                    AreEqual(std::vector<float>({ 0.0f, 1.0f, 1.0f }), reducedStep.values);
+
+                    AnimationCurve cubic = step;
+                    cubic.interpolation = INTERPOLATION_CUBICSPLINE;
+                    cubic.times = { 0.0f, 1.0f, 2.0f };
+                    cubic.values = { 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f };
+
+                    AreEqual(cubic.times, AnimationOptimizationUtils::ReduceKeyframes(cubic, 1.0f).times);
+                }
+
+                GLTFSDK_TEST_METHOD(AnimationOptimizationUtilsTests, AnimationOptimizationUtils_Test_OptimizeAnimation)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+
+                    // Both curves are sampled at the same times, but only the first second of the translation is used so that
+                    // both reduce to the same two keyframes
+                    auto translation = GetTranslationCurve();
+                    translation.times.resize(61U);
+                    translation.values.resize(61U * 3U);
+
+                    const auto rotation = GetRotationCurve();
+
+                    Document doc;
+                    Animation animation;
+
+                    {
+                        auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                        bufferBuilder.AddBuffer();
+                        bufferBuilder.AddBufferView(BufferViewTarget::UNKNOWN_BUFFER);
+
+                        AnimationSampler translationSampler;
+                        translationSampler.id = "0";
+                        translationSampler.inputAccessorId = bufferBuilder.AddAccessor(translation.times, { TYPE_SCALAR, COMPONENT_FLOAT, false, { 0.0f }, { 1.0f } }).id;
+                        translationSampler.outputAccessorId = bufferBuilder.AddAccessor(translation.values, { TYPE_VEC3, COMPONENT_FLOAT }).id;
+                        animation.samplers.Append(translationSampler);
+
+                        AnimationSampler rotationSampler;
+                        rotationSampler.id = "1";
+                        rotationSampler.inputAccessorId = translationSampler.inputAccessorId;
+                        rotationSampler.outputAccessorId = bufferBuilder.AddAccessor(rotation.values, { TYPE_VEC4, COMPONENT_FLOAT }).id;
+                        animation.samplers.Append(rotationSampler);
+
+                        bufferBuilder.Output(doc);
+                    }
+
+                    for (size_t i = 0U; i < 2U; ++i)
+                    {
+                        AnimationChannel channel;
+                        channel.id = std::to_string(i);
+                        channel.samplerId = std::to_string(i);
+                        channel.target.nodeId = "0";
+                        channel.target.path = i == 0U ? TARGET_TRANSLATION : TARGET_ROTATION;
+                        animation.channels.Append(channel);
+                    }
+
+                    GLTFResourceReader reader(readerWriter);
+
+                    AnimationEvaluator original(doc, reader, animation);
+
+                    {
+                        auto bufferBuilder = CreateBufferBuilder(doc, readerWriter);
+
+                        AnimationOptimizationUtils::Options options;
+                        options.quantizeRotations = true;
+
+                        Assert::AreEqual<size_t>(2U * 59U, AnimationOptimizationUtils::OptimizeAnimation(doc, reader, animation, bufferBuilder, options));
+
+                        bufferBuilder.Output(doc);
+                    }
+
+                    // The identical keyframe times are shared and the rotations are quantized
+                    Assert::AreEqual(animation.samplers["0"].inputAccessorId, animation.samplers["1"].inputAccessorId);
+                    Assert::AreEqual<size_t>(2U, doc.accessors[animation.samplers["0"].inputAccessorId].count);
+                    Assert::IsTrue(doc.accessors[animation.samplers["1"].outputAccessorId].componentType == COMPONENT_SHORT);
+
+                    AnimationEvaluator optimized(doc, reader, animation);
+
+                    for (size_t i = 0U; i <= 100U; ++i)
+                    {
+                        const float time = i / 100.0f;
+
+                        original.Evaluate(time);
+                        optimized.Evaluate(time);
+
+                        for (auto path : { TARGET_TRANSLATION, TARGET_ROTATION })
+                        {
+                            AreNear(original.GetOutput(path), optimized.GetOutput(path), 1.0e-3f);
+                        }
+                    }
+                }
+            };
+        }
+    }
+}
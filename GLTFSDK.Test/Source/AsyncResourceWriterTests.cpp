@@ -0,0 +1,221 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+#include <GLTFSDK/AsyncResourceWriter.h>
+#include <GLTFSDK/BufferBuilder.h>
+#include <GLTFSDK/GLBResourceReader.h>
+#include <GLTFSDK/GLBResourceWriter.h>
+#include <GLTFSDK/GLTFResourceReader.h>
+#include <GLTFSDK/GLTFResourceWriter.h>
+#include <GLTFSDK/IStreamWriter.h>
+
+#include "TestUtils.h"
+
+#include <numeric>
+
+using namespace glTF::UnitTest;
+
+namespace
+{
+    using namespace Microsoft::glTF;
+
+    class FailingStreamWriter : public IStreamWriter
+    {
+    public:
+        std::shared_ptr<std::ostream> GetOutputStream(const std::string&) const override
+        {
+            auto stream = std::make_shared<std::stringstream>();
+            stream->setstate(std::ios::failbit);
+            return stream;
+        }
+    };
+
+    // Accepts at most capacity bytes, any further writes are short
+    class LimitedStreamBuf : public std::streambuf
+    {
+    public:
+        LimitedStreamBuf(size_t capacity) : m_remaining(capacity)
+        {
+        }
+
+    protected:
+        std::streamsize xsputn(const char_type*, std::streamsize count) override
+        {
+            const auto written = std::min(count, static_cast<std::streamsize>(m_remaining));
+            m_remaining -= static_cast<size_t>(written);
+            return written;
+        }
+
+        int_type overflow(int_type ch) override
+        {
+            const char_type c = traits_type::to_char_type(ch);
+            return xsputn(&c, 1) == 1 ? traits_type::not_eof(ch) : traits_type::eof();
+        }
+
+    private:
+        size_t m_remaining;
+    };
+
+    class LimitedStreamWriter : public IStreamWriter
+    {
+    public:
+        LimitedStreamWriter(size_t capacity) : m_streamBuf(capacity)
+        {
+        }
+
+        std::shared_ptr<std::ostream> GetOutputStream(const std::string&) const override
+        {
+            return std::make_shared<std::ostream>(&m_streamBuf);
+        }
+
+    private:
+        mutable LimitedStreamBuf m_streamBuf;
+    };
+
+    // Small blocks and a short queue ensure that the tests exercise the background thread's block recycling
+    const size_t TestBlockByteLength = 16U;
+    const size_t TestMaxQueuedBlocks = 2U;
+}
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Test
+        {
+            GLTFSDK_TEST_CLASS(AsyncResourceWriterTests)
+            {
+                GLTFSDK_TEST_METHOD(AsyncResourceWriterTests, WriteAccessors)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto resourceWriter = std::make_unique<AsyncResourceWriter>(std::make_unique<GLTFResourceWriter>(readerWriter), TestBlockByteLength, TestMaxQueuedBlocks);
+                    auto& asyncResourceWriter = *resourceWriter;
+
+                    BufferBuilder bufferBuilder(std::move(resourceWriter));
+                    bufferBuilder.AddBuffer();
+
+                    std::vector<float> positions(300U);
+                    std::iota(positions.begin(), positions.end(), 0.0f);
+
+                    std::vector<uint16_t> indices(99U);
+                    std::iota(indices.begin(), indices.end(), static_cast<uint16_t>(0U));
+
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+                    bufferBuilder.AddAccessor(positions, { TYPE_VEC3, COMPONENT_FLOAT });
+
+                    bufferBuilder.AddBufferView(BufferViewTarget::ELEMENT_ARRAY_BUFFER);
+                    bufferBuilder.AddAccessor(indices, { TYPE_SCALAR, COMPONENT_UNSIGNED_SHORT });
+
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+                    bufferBuilder.AddAccessor(positions, { TYPE_VEC3, COMPONENT_FLOAT });
+
+                    asyncResourceWriter.Flush();
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    GLTFResourceReader resourceReader(readerWriter);
+
+                    AreEqual(positions, resourceReader.ReadBinaryData<float>(doc, doc.accessors[0]));
+                    AreEqual(indices, resourceReader.ReadBinaryData<uint16_t>(doc, doc.accessors[1]));
+                    AreEqual(positions, resourceReader.ReadBinaryData<float>(doc, doc.accessors[2]));
+                }
+
+                GLTFSDK_TEST_METHOD(AsyncResourceWriterTests, WriteExternal)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+
+                    const std::string uri = "foo.bin";
+                    const std::string data = "The quick brown fox jumps over the lazy dog";
+
+                    AsyncResourceWriter resourceWriter(std::make_unique<GLTFResourceWriter>(readerWriter), TestBlockByteLength, TestMaxQueuedBlocks);
+                    resourceWriter.WriteExternal(uri, data);
+                    resourceWriter.Flush();
+
+                    auto stream = std::dynamic_pointer_cast<std::stringstream>(readerWriter->GetInputStream(uri));
+
+                    Assert::AreEqual(data, stream->str());
+                }
+
+                GLTFSDK_TEST_METHOD(AsyncResourceWriterTests, WriteExternal_NotFlushed)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+
+                    const std::string uri = "foo.bin";
+                    const std::string data = "The quick brown fox jumps over the lazy dog";
+
+                    {
+                        AsyncResourceWriter resourceWriter(std::make_unique<GLTFResourceWriter>(readerWriter), TestBlockByteLength, TestMaxQueuedBlocks);
+                        resourceWriter.WriteExternal(uri, data);
+                    }
+
+                    // Destroying the AsyncResourceWriter still writes the queued and partially filled blocks
+                    auto stream = std::dynamic_pointer_cast<std::stringstream>(readerWriter->GetInputStream(uri));
+
+                    Assert::AreEqual(data, stream->str());
+                }
+
+                GLTFSDK_TEST_METHOD(AsyncResourceWriterTests, WriteExternal_ShortWrite)
+                {
+                    const std::string data = "The quick brown fox jumps over the lazy dog";
+
+                    AsyncResourceWriter resourceWriter(std::make_unique<GLTFResourceWriter>(std::make_shared<const LimitedStreamWriter>(data.size() - 1U)), TestBlockByteLength, TestMaxQueuedBlocks);
+                    resourceWriter.WriteExternal("foo.bin", data);
+
+                    Assert::ExpectException<GLTFException>([&resourceWriter]()
+                    {
+                        resourceWriter.Flush();
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(AsyncResourceWriterTests, WriteGLB)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto resourceWriter = std::make_unique<AsyncResourceWriter>(std::make_unique<GLBResourceWriter>(readerWriter), TestBlockByteLength, TestMaxQueuedBlocks);
+                    auto& asyncResourceWriter = *resourceWriter;
+
+                    BufferBuilder bufferBuilder(std::move(resourceWriter));
+                    bufferBuilder.AddBuffer(GLB_BUFFER_ID);
+
+                    const std::vector<uint8_t> colors = { 255U, 0U, 0U, 255U, 0U, 255U, 0U, 255U, 0U, 0U, 255U, 255U };
+
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+                    bufferBuilder.AddAccessor(colors, { TYPE_VEC4, COMPONENT_UNSIGNED_BYTE, true });
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    const std::string uri = "foo.glb";
+
+                    // The wrapped GLBResourceWriter can only be flushed once all pending blocks have been written
+                    asyncResourceWriter.Flush();
+                    static_cast<GLBResourceWriter&>(asyncResourceWriter.GetResourceWriter()).Flush("{}", uri);
+
+                    GLBResourceReader resourceReader(readerWriter, readerWriter->GetInputStream(uri));
+
+                    AreEqual(colors, resourceReader.ReadBinaryData<uint8_t>(doc, doc.accessors.Front()));
+                }
+
+                GLTFSDK_TEST_METHOD(AsyncResourceWriterTests, FlushRethrowsWriteError)
+                {
+                    AsyncResourceWriter resourceWriter(std::make_unique<GLTFResourceWriter>(std::make_shared<const FailingStreamWriter>()), TestBlockByteLength, TestMaxQueuedBlocks);
+
+                    BufferView bufferView;
+                    bufferView.bufferId = "0";
+                    bufferView.byteLength = 4U;
+
+                    const std::vector<uint8_t> data = { 0U, 1U, 2U, 3U };
+
+                    resourceWriter.Write(bufferView, data);
+
+                    Assert::ExpectException<GLTFException>([&resourceWriter]()
+                    {
+                        resourceWriter.Flush();
+                    });
+                }
+            };
+        }
+    }
+}
@@ -0,0 +1,282 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+#include <GLTFSDK/BoundsUtils.h>
+#include <GLTFSDK/BufferBuilder.h>
+#include <GLTFSDK/GLTF.h>
+#include <GLTFSDK/GLTFResourceReader.h>
+#include <GLTFSDK/GLTFResourceWriter.h>
+#include <GLTFSDK/PoseUtils.h>
+
+#include "TestUtils.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace glTF::UnitTest;
+
+namespace
+{
+    using namespace Microsoft::glTF;
+    using namespace Microsoft::glTF::BoundsUtils;
+
+    std::vector<float> GenerateFloats(size_t count, uint32_t seed)
+    {
+        std::vector<float> values(count);
+
+        for (auto& value : values)
+        {
+            seed = seed * 1664525U + 1013904223U;
+            value = static_cast<float>(seed >> 8) / static_cast<float>(1U << 24) * 200.0f - 100.0f;
+        }
+
+        return values;
+    }
+
+    const float Tolerance = 1.0e-4f;
+
+    void AreBoundsNear(const BoundingBox& expected, const BoundingBox& actual)
+    {
+        Test::AreNear(expected.min, actual.min, Tolerance);
+        Test::AreNear(expected.max, actual.max, Tolerance);
+    }
+}
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Test
+        {
+            GLTFSDK_TEST_CLASS(BoundsUtilsTests)
+            {
+                GLTFSDK_TEST_METHOD(BoundsUtilsTests, BoundsUtils_Test_ComputeBounds)
+                {
+                    Assert::IsTrue(ComputeBounds(nullptr, 0U).IsEmpty());
+
+                    const auto positions = GenerateFloats(37U * 3U, 1U);
+
+                    for (size_t count = 1U; count <= 37U; ++count)
+                    {
+                        BoundingBox expected;
+
+                        for (size_t i = 0U; i < count; ++i)
+                        {
+                            expected.Merge(Vector3(positions[i * 3U], positions[i * 3U + 1U], positions[i * 3U + 2U]));
+                        }
+
+                        Assert::IsTrue(expected == ComputeBounds(positions.data(), count));
+                    }
+                }
+
+                GLTFSDK_TEST_METHOD(BoundsUtilsTests, BoundsUtils_Test_Transform)
+                {
+                    // A quarter turn about z, scaled by two and translated along x
+                    const float s = std::sqrt(0.5f);
+                    const auto matrix = Math::CreateTransform(Vector3(10.0f, 0.0f, 0.0f), Quaternion(0.0f, 0.0f, s, s), Vector3(2.0f, 2.0f, 2.0f));
+
+                    AreNear(Vector3(10.0f, 2.0f, 0.0f), Math::TransformPoint(matrix, Vector3(1.0f, 0.0f, 0.0f)), Tolerance);
+                    AreNear(Vector3(8.0f, 0.0f, 0.0f), Math::TransformPoint(matrix, Vector3(0.0f, 1.0f, 0.0f)), Tolerance);
+
+                    const auto translation = Math::CreateTransform(Vector3(0.0f, 0.0f, 5.0f), Quaternion::IDENTITY, Vector3::ONE);
+                    AreNear(Vector3(10.0f, 2.0f, 5.0f), Math::TransformPoint(Math::Multiply(translation, matrix), Vector3(1.0f, 0.0f, 0.0f)), Tolerance);
+
+                    const auto bounds = Transform(BoundingBox(Vector3(0.0f, 0.0f, 0.0f), Vector3(1.0f, 2.0f, 3.0f)), matrix);
+                    AreBoundsNear(BoundingBox(Vector3(6.0f, 0.0f, 0.0f), Vector3(10.0f, 2.0f, 6.0f)), bounds);
+
+                    Assert::IsTrue(Transform(BoundingBox(), matrix).IsEmpty());
+                }
+
+                GLTFSDK_TEST_METHOD(BoundsUtilsTests, BoundsUtils_Test_SceneBounds)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+
+                    const std::vector<float> positions = {
+                        -1.0f, -1.0f, -1.0f,
+                         1.0f,  0.5f,  1.0f,
+                         0.0f,  1.0f,  0.0f
+                    };
+
+                    const std::vector<float> displacements = {
+                         0.0f, 0.0f, 0.0f,
+                         0.0f, 0.0f, 2.0f,
+                         0.0f, 0.0f, 0.0f
+                    };
+
+                    Document doc;
+                    Mesh mesh;
+
+                    {
+                        auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                        bufferBuilder.AddBuffer();
+
+                        // The first primitive's accessor has min and max values, the second primitive's accessor doesn't
+                        MeshPrimitive first;
+                        bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+                        first.attributes[ACCESSOR_POSITION] = bufferBuilder.AddAccessor(positions, { TYPE_VEC3, COMPONENT_FLOAT, false, { -1.0f, -1.0f, -1.0f }, { 1.0f, 1.0f, 1.0f } }).id;
+
+                        MeshPrimitive second;
+                        bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+                        second.attributes[ACCESSOR_POSITION] = bufferBuilder.AddAccessor(std::vector<float>({ 0.0f, 0.0f, 0.0f, 3.0f, 0.0f, 0.0f }), { TYPE_VEC3, COMPONENT_FLOAT }).id;
+
+                        MorphTarget target;
+                        bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+                        target.positionsAccessorId = bufferBuilder.AddAccessor(displacements, { TYPE_VEC3, COMPONENT_FLOAT }).id;
+                        second.targets.push_back(target);
+
+                        mesh.primitives = { first, second };
+
+                        bufferBuilder.Output(doc);
+                    }
+
+                    const auto meshId = doc.meshes.Append(std::move(mesh), AppendIdPolicy::GenerateOnEmpty).id;
+
+                    GLTFResourceReader reader(readerWriter);
+
+                    AreBoundsNear(BoundingBox(Vector3(-1.0f, -1.0f, -1.0f), Vector3(3.0f, 1.0f, 2.0f)), GetBounds(doc, reader, doc.meshes[meshId]));
+
+                    // A parent translated along x with a child scaled by two, and a second root node with a matrix
+                    Node child;
+                    child.meshId = meshId;
+                    child.scale = Vector3(2.0f, 2.0f, 2.0f);
+                    const auto childId = doc.nodes.Append(std::move(child), AppendIdPolicy::GenerateOnEmpty).id;
+
+                    Node parent;
+                    parent.translation = Vector3(10.0f, 0.0f, 0.0f);
+                    parent.children.push_back(childId);
+                    const auto parentId = doc.nodes.Append(std::move(parent), AppendIdPolicy::GenerateOnEmpty).id;
+
+                    Node other;
+                    other.meshId = meshId;
+                    other.matrix.values[13] = -10.0f;
+                    const auto otherId = doc.nodes.Append(std::move(other), AppendIdPolicy::GenerateOnEmpty).id;
+
+                    Scene scene;
+                    scene.nodes = { parentId, otherId };
+
+                    const auto meshInstances = GetMeshInstances(doc, reader, scene);
+
+                    Assert::AreEqual<size_t>(2U, meshInstances.size());
+                    Assert::AreEqual(childId, meshInstances[0].nodeId);
+                    Assert::AreEqual(otherId, meshInstances[1].nodeId);
+                    Assert::IsTrue(GetWorldTransform(doc, childId) == meshInstances[0].worldTransform);
+                    Assert::IsTrue(GetWorldTransform(doc, PoseUtils::GetNodeHierarchy(doc), childId) == meshInstances[0].worldTransform);
+
+                    const BoundingBox childBounds(Vector3(8.0f, -2.0f, -2.0f), Vector3(16.0f, 2.0f, 4.0f));
+                    const BoundingBox otherBounds(Vector3(-1.0f, -11.0f, -1.0f), Vector3(3.0f, -9.0f, 2.0f));
+
+                    AreBoundsNear(childBounds, meshInstances[0].bounds);
+                    AreBoundsNear(otherBounds, meshInstances[1].bounds);
+
+                    AreBoundsNear(BoundingBox(Vector3(-1.0f, -11.0f, -2.0f), Vector3(16.0f, 2.0f, 4.0f)), GetSceneBounds(doc, reader, scene));
+                    AreBoundsNear(childBounds, GetNodeBounds(doc, reader, childId));
+                    AreBoundsNear(childBounds, GetNodeBounds(doc, reader, parentId));
+                }
+
+                GLTFSDK_TEST_METHOD(BoundsUtilsTests, BoundsUtils_Test_Bvh)
+                {
+                    const size_t itemCount = 1000U;
+
+                    const auto centers = GenerateFloats(itemCount * 3U, 2U);
+                    const auto sizes = GenerateFloats(itemCount * 3U, 3U);
+
+                    std::vector<BoundingBox> bounds(itemCount);
+
+                    for (size_t i = 0U; i < itemCount; ++i)
+                    {
+                        const Vector3 center(centers[i * 3U], centers[i * 3U + 1U], centers[i * 3U + 2U]);
+                        const Vector3 extents(std::abs(sizes[i * 3U]) * 0.05f, std::abs(sizes[i * 3U + 1U]) * 0.05f, std::abs(sizes[i * 3U + 2U]) * 0.05f);
+
+                        bounds[i] = BoundingBox(
+                            Vector3(center.x - extents.x, center.y - extents.y, center.z - extents.z),
+                            Vector3(center.x + extents.x, center.y + extents.y, center.z + extents.z));
+                    }
+
+                    // Empty bounding boxes are excluded
+                    bounds[7] = BoundingBox();
+
+                    const auto bvh = BuildBvh(bounds);
+
+                    std::vector<uint32_t> items = bvh.items;
+                    std::sort(items.begin(), items.end());
+
+                    Assert::AreEqual<size_t>(itemCount - 1U, items.size());
+                    Assert::IsTrue(std::adjacent_find(items.begin(), items.end()) == items.end());
+                    Assert::IsTrue(!std::binary_search(items.begin(), items.end(), 7U));
+
+                    for (size_t i = 0U; i < bvh.nodes.size(); ++i)
+                    {
+                        const auto& node = bvh.nodes[i];
+
+                        if (node.IsLeaf())
+                        {
+                            Assert::IsTrue(node.itemCount <= DefaultMaxLeafSize);
+
+                            for (size_t j = node.offset; j < node.offset + node.itemCount; ++j)
+                            {
+                                auto merged = node.bounds;
+                                merged.Merge(bounds[bvh.items[j]]);
+
+                                Assert::IsTrue(merged == node.bounds);
+                            }
+                        }
+                        else
+                        {
+                            auto merged = node.bounds;
+                            merged.Merge(bvh.nodes[i + 1U].bounds);
+                            merged.Merge(bvh.nodes[node.offset].bounds);
+
+                            Assert::IsTrue(merged == node.bounds);
+                        }
+                    }
+
+                    // The queries match a brute force search
+                    const BoundingBox query(Vector3(-20.0f, -30.0f, -40.0f), Vector3(30.0f, 20.0f, 10.0f));
+
+                    std::vector<uint32_t> expected;
+
+                    for (uint32_t i = 0U; i < itemCount; ++i)
+                    {
+                        if (!bounds[i].IsEmpty() && bounds[i].Intersects(query))
+                        {
+                            expected.push_back(i);
+                        }
+                    }
+
+                    auto actual = QueryBvh(bvh, query);
+                    std::sort(actual.begin(), actual.end());
+
+                    Assert::IsTrue(!expected.empty());
+                    Assert::IsTrue(expected == actual);
+
+                    // A ray along x through the center of the first item
+                    const Vector3 origin(-200.0f, bounds[0].GetCenter().y, bounds[0].GetCenter().z);
+                    const auto hits = QueryBvh(bvh, origin, Vector3(1.0f, 0.0f, 0.0f));
+
+                    expected.clear();
+
+                    for (uint32_t i = 0U; i < itemCount; ++i)
+                    {
+                        if (!bounds[i].IsEmpty() && bounds[i].min.y <= origin.y && bounds[i].max.y >= origin.y && bounds[i].min.z <= origin.z && bounds[i].max.z >= origin.z)
+                        {
+                            expected.push_back(i);
+                        }
+                    }
+
+                    std::sort(expected.begin(), expected.end(), [&bounds](uint32_t lhs, uint32_t rhs)
+                    {
+                        return std::make_pair(bounds[lhs].min.x, lhs) < std::make_pair(bounds[rhs].min.x, rhs);
+                    });
+
+                    Assert::IsTrue(!expected.empty());
+                    Assert::IsTrue(expected == hits);
+
+                    Assert::IsTrue(BuildBvh(std::vector<BoundingBox>()).nodes.empty());
+                }
+            };
+        }
+    }
+}
@@ -0,0 +1,213 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+#include <GLTFSDK/BufferBuilder.h>
+#include <GLTFSDK/CompiledAnimation.h>
+#include <GLTFSDK/GLTF.h>
+#include <GLTFSDK/GLTFResourceReader.h>
+#include <GLTFSDK/GLTFResourceWriter.h>
+#include <GLTFSDK/ParallelUtils.h>
+
+#include "TestUtils.h"
+
+#include <cmath>
+
+using namespace glTF::UnitTest;
+
+namespace
+{
+    using namespace Microsoft::glTF;
+
+    // An animation with a LINEAR translation, a CUBICSPLINE rotation and STEP morph weights. The translation and rotation
+    // samplers have identical (but separately written) keyframe times and the translation sampler is used by two channels.
+    Animation CreateAnimation(Document& doc, std::shared_ptr<const Test::StreamReaderWriter> readerWriter)
+    {
+        auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+        bufferBuilder.AddBuffer();
+        bufferBuilder.AddBufferView(BufferViewTarget::UNKNOWN_BUFFER);
+
+        const std::vector<float> times = { 0.0f, 0.5f, 1.5f, 2.0f };
+
+        std::vector<float> translations;
+        std::vector<float> rotations;
+
+        for (size_t i = 0U; i < times.size(); ++i)
+        {
+            const float angle = times[i] * 0.75f;
+
+            translations.insert(translations.end(), { times[i], times[i] * times[i], -times[i] });
+
+            // In-tangent, value and out-tangent
+            rotations.insert(rotations.end(), { 0.0f, 0.1f, 0.0f, 0.0f });
+            rotations.insert(rotations.end(), { 0.0f, std::sin(angle), 0.0f, std::cos(angle) });
+            rotations.insert(rotations.end(), { 0.1f, 0.0f, 0.0f, 0.0f });
+        }
+
+        Animation animation;
+
+        AnimationSampler translationSampler;
+        translationSampler.id = "0";
+        translationSampler.inputAccessorId = bufferBuilder.AddAccessor(times, { TYPE_SCALAR, COMPONENT_FLOAT, false, { 0.0f }, { 2.0f } }).id;
+        translationSampler.outputAccessorId = bufferBuilder.AddAccessor(translations, { TYPE_VEC3, COMPONENT_FLOAT }).id;
+        animation.samplers.Append(translationSampler);
+
+        AnimationSampler rotationSampler;
+        rotationSampler.id = "1";
+        rotationSampler.interpolation = INTERPOLATION_CUBICSPLINE;
+        rotationSampler.inputAccessorId = bufferBuilder.AddAccessor(times, { TYPE_SCALAR, COMPONENT_FLOAT, false, { 0.0f }, { 2.0f } }).id;
+        rotationSampler.outputAccessorId = bufferBuilder.AddAccessor(rotations, { TYPE_VEC4, COMPONENT_FLOAT }).id;
+        animation.samplers.Append(rotationSampler);
+
+        AnimationSampler weightsSampler;
+        weightsSampler.id = "2";
+        weightsSampler.interpolation = INTERPOLATION_STEP;
+        weightsSampler.inputAccessorId = bufferBuilder.AddAccessor(std::vector<float>({ 0.25f, 1.0f, 3.0f }), { TYPE_SCALAR, COMPONENT_FLOAT, false, { 0.25f }, { 3.0f } }).id;
+        weightsSampler.outputAccessorId = bufferBuilder.AddAccessor(std::vector<uint8_t>({ 255U, 0U, 128U, 64U, 0U, 255U }), { TYPE_SCALAR, COMPONENT_UNSIGNED_BYTE, true }).id;
+        animation.samplers.Append(weightsSampler);
+
+        bufferBuilder.Output(doc);
+
+        const std::pair<const char*, TargetPath> targets[] = {
+            { "0", TARGET_TRANSLATION },
+            { "1", TARGET_ROTATION },
+            { "2", TARGET_WEIGHTS },
+            { "0", TARGET_TRANSLATION }
+        };
+
+        for (const auto& target : targets)
+        {
+            AnimationChannel channel;
+            channel.id = std::to_string(animation.channels.Size());
+            channel.samplerId = target.first;
+            channel.target.nodeId = channel.id;
+            channel.target.path = target.second;
+            animation.channels.Append(channel);
+        }
+
+        return animation;
+    }
+}
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Test
+        {
+            GLTFSDK_TEST_CLASS(CompiledAnimationTests)
+            {
+                GLTFSDK_TEST_METHOD(CompiledAnimationTests, CompiledAnimation_Test_Layout)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+
+                    Document doc;
+                    const auto animation = CreateAnimation(doc, readerWriter);
+
+                    GLTFResourceReader reader(readerWriter);
+                    CompiledAnimation compiled(doc, reader, animation);
+
+                    Assert::AreEqual<size_t>(4U, compiled.GetChannelCount());
+                    Assert::AreEqual(0.0f, compiled.GetStartTime());
+                    Assert::AreEqual(3.0f, compiled.GetEndTime());
+                    Assert::AreEqual<size_t>(3U + 4U + 2U + 3U, compiled.GetOutputSize());
+
+                    // The translation and rotation samplers share a time track
+                    Assert::AreEqual<size_t>(2U, compiled.GetTimeTrackCount());
+                    Assert::AreEqual(compiled.GetChannel(0U).timeTrack, compiled.GetChannel(1U).timeTrack);
+                    Assert::AreEqual<size_t>(3U, compiled.GetKeyframeCount(compiled.GetChannel(2U).timeTrack));
+
+                    // Channels with the same sampler share its values, which are only decoded once
+                    Assert::AreEqual(compiled.GetChannel(0U).valueOffset, compiled.GetChannel(3U).valueOffset);
+                    Assert::AreEqual<size_t>(4U * 3U + 12U * 4U + 3U * 2U, compiled.GetValues().size());
+
+                    // The values are stored component by component
+                    const auto& translation = compiled.GetChannel(0U);
+                    Assert::AreEqual<size_t>(4U, translation.valueCount);
+                    Assert::AreEqual(2.0f, compiled.GetValues()[translation.valueOffset + 3U]);
+                    Assert::AreEqual(4.0f, compiled.GetValues()[translation.valueOffset + translation.valueCount + 3U]);
+
+                    const auto& weights = compiled.GetChannel(2U);
+                    Assert::AreEqual(1.0f, compiled.GetValues()[weights.valueOffset]);
+                    Assert::AreEqual(0.0f, compiled.GetValues()[weights.valueOffset + weights.valueCount]);
+                }
+
+                GLTFSDK_TEST_METHOD(CompiledAnimationTests, CompiledAnimation_Test_Sample)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+
+                    Document doc;
+                    const auto animation = CreateAnimation(doc, readerWriter);
+
+                    GLTFResourceReader reader(readerWriter);
+                    CompiledAnimation compiled(doc, reader, animation);
+
+                    // Sampling matches the evaluator (which reads interleaved values) forwards, backwards and out of range
+                    std::vector<AnimationCurve> curves;
+
+                    for (const auto& channel : animation.channels.Elements())
+                    {
+                        curves.push_back(AnimationEvaluator::ReadCurve(doc, reader, animation, channel));
+                    }
+
+                    std::vector<size_t> curveCursors(curves.size());
+                    std::vector<size_t> cursors;
+                    std::vector<float> output(compiled.GetOutputSize());
+
+                    for (const float time : { -1.0f, 0.1f, 0.3f, 0.5f, 0.9f, 1.25f, 1.75f, 2.5f, 1.0f, 0.2f })
+                    {
+                        compiled.Evaluate(time, cursors, output.data());
+
+                        for (size_t i = 0U; i < curves.size(); ++i)
+                        {
+                            std::vector<float> expected(curves[i].componentCount);
+
+                            AnimationEvaluator::Sample(curves[i], time, curveCursors[i], expected.data());
+
+                            AreNear(expected, output.data() + compiled.GetChannel(i).outputOffset);
+                        }
+                    }
+                }
+
+                GLTFSDK_TEST_METHOD(CompiledAnimationTests, CompiledAnimation_Test_SampleConcurrently)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+
+                    Document doc;
+                    const auto animation = CreateAnimation(doc, readerWriter);
+
+                    GLTFResourceReader reader(readerWriter);
+                    const CompiledAnimation compiled(doc, reader, animation);
+
+                    const size_t frameCount = 1000U;
+                    const size_t outputSize = compiled.GetOutputSize();
+
+                    std::vector<float> expected(frameCount * outputSize);
+                    std::vector<float> actual(frameCount * outputSize);
+
+                    std::vector<size_t> cursors;
+
+                    for (size_t i = 0U; i < frameCount; ++i)
+                    {
+                        compiled.Evaluate(i * 0.003f, cursors, expected.data() + i * outputSize);
+                    }
+
+                    // Each range of frames has its own cursors, as each playing instance of an animation would
+                    ParallelUtils::ParallelFor(frameCount, 16U, [&](size_t begin, size_t end)
+                    {
+                        std::vector<size_t> rangeCursors;
+
+                        for (size_t i = begin; i < end; ++i)
+                        {
+                            compiled.Evaluate(i * 0.003f, rangeCursors, actual.data() + i * outputSize);
+                        }
+                    });
+
+                    Assert::IsTrue(expected == actual);
+                }
+            };
+        }
+    }
+}
@@ -0,0 +1,233 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+#include <GLTFSDK/AnimationUtils.h>
+#include <GLTFSDK/Color.h>
+#include <GLTFSDK/ConversionUtils.h>
+#include <GLTFSDK/Math.h>
+
+#include "TestUtils.h"
+
+#include <cmath>
+#include <limits>
+
+using namespace glTF::UnitTest;
+
+namespace
+{
+    using namespace Microsoft::glTF;
+
+    // Odd component counts exercise both the vectorized and scalar code paths
+    const size_t ComponentCount = 77U;
+
+    // Deterministic values covering the full range of T (including the minimum and maximum values)
+    template<typename T>
+    std::vector<T> GenerateComponents(size_t count)
+    {
+        std::vector<T> values(count);
+        uint32_t state = 12345U;
+
+        for (auto& value : values)
+        {
+            state = state * 1664525U + 1013904223U;
+            value = static_cast<T>(state);
+        }
+
+        values[0] = std::numeric_limits<T>::min();
+        values[1] = std::numeric_limits<T>::max();
+        values[2] = static_cast<T>(0);
+
+        return values;
+    }
+
+    template<typename T>
+    float ExpectedFloat(T value, bool normalized)
+    {
+        return normalized ? AnimationUtils::ComponentToFloat(value) : static_cast<float>(value);
+    }
+
+    // Unsigned int components can't be normalized
+    float ExpectedFloat(uint32_t value, bool)
+    {
+        return static_cast<float>(value);
+    }
+
+    template<typename T>
+    void TestToFloat(ComponentType componentType, bool normalized)
+    {
+        const auto components = GenerateComponents<T>(ComponentCount);
+
+        std::vector<float> expected(ComponentCount);
+        std::vector<float> actual(ComponentCount);
+
+        for (size_t i = 0; i < ComponentCount; ++i)
+        {
+            expected[i] = ExpectedFloat(components[i], normalized);
+        }
+
+        ConversionUtils::ToFloat(components.data(), componentType, normalized, actual.data(), ComponentCount);
+
+        // Conversions are expected to be exact, not just within some tolerance
+        Assert::IsTrue(expected == actual);
+    }
+
+    uint8_t ExpectedUnorm8(uint16_t value)
+    {
+        return static_cast<uint8_t>(std::round((value / 65535.0f) * 255.0f));
+    }
+
+    uint8_t ExpectedUnorm8(float value)
+    {
+        return Math::FloatToByte(std::min(std::max(value, 0.0f), 1.0f));
+    }
+
+    uint16_t ExpectedUnorm16(float value)
+    {
+        return static_cast<uint16_t>(std::min(std::max(value, 0.0f), 1.0f) * 65535.0f + 0.5f);
+    }
+
+    std::vector<float> GenerateUnormFloats(size_t count)
+    {
+        std::vector<float> values(count);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            // Includes values outside [0, 1] to test clamping
+            values[i] = -0.25f + 1.5f * static_cast<float>(i) / static_cast<float>(count - 1U);
+        }
+
+        return values;
+    }
+}
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Test
+        {
+            GLTFSDK_TEST_CLASS(ConversionUtilsTests)
+            {
+                GLTFSDK_TEST_METHOD(ConversionUtilsTests, ConversionUtils_Test_ToFloat)
+                {
+                    TestToFloat<int8_t>(COMPONENT_BYTE, true);
+                    TestToFloat<int8_t>(COMPONENT_BYTE, false);
+                    TestToFloat<uint8_t>(COMPONENT_UNSIGNED_BYTE, true);
+                    TestToFloat<uint8_t>(COMPONENT_UNSIGNED_BYTE, false);
+                    TestToFloat<int16_t>(COMPONENT_SHORT, true);
+                    TestToFloat<int16_t>(COMPONENT_SHORT, false);
+                    TestToFloat<uint16_t>(COMPONENT_UNSIGNED_SHORT, true);
+                    TestToFloat<uint16_t>(COMPONENT_UNSIGNED_SHORT, false);
+                    TestToFloat<uint32_t>(COMPONENT_UNSIGNED_INT, false);
+
+                    const auto floats = GenerateUnormFloats(ComponentCount);
+                    std::vector<float> output(ComponentCount);
+
+                    ConversionUtils::ToFloat(floats.data(), COMPONENT_FLOAT, false, output.data(), ComponentCount);
+
+                    Assert::IsTrue(floats == output);
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        ConversionUtils::ToFloat(floats.data(), COMPONENT_UNSIGNED_INT, true, output.data(), ComponentCount);
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(ConversionUtilsTests, ConversionUtils_Test_ToUnorm8)
+                {
+                    std::vector<uint8_t> output(ComponentCount);
+
+                    const auto bytes = GenerateComponents<uint8_t>(ComponentCount);
+                    ConversionUtils::ToUnorm8(bytes.data(), COMPONENT_UNSIGNED_BYTE, output.data(), ComponentCount);
+                    Assert::IsTrue(bytes == output);
+
+                    const auto shorts = GenerateComponents<uint16_t>(ComponentCount);
+                    ConversionUtils::ToUnorm8(shorts.data(), COMPONENT_UNSIGNED_SHORT, output.data(), ComponentCount);
+
+                    for (size_t i = 0; i < ComponentCount; ++i)
+                    {
+                        Assert::AreEqual(ExpectedUnorm8(shorts[i]), output[i]);
+                    }
+
+                    auto floats = GenerateUnormFloats(ComponentCount);
+                    floats[3] = std::numeric_limits<float>::quiet_NaN();
+
+                    ConversionUtils::ToUnorm8(floats.data(), COMPONENT_FLOAT, output.data(), ComponentCount);
+
+                    Assert::AreEqual<uint8_t>(0U, output[3]);
+
+                    for (size_t i = 4; i < ComponentCount; ++i)
+                    {
+                        Assert::AreEqual(ExpectedUnorm8(floats[i]), output[i]);
+                    }
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        ConversionUtils::ToUnorm8(shorts.data(), COMPONENT_SHORT, output.data(), ComponentCount);
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(ConversionUtilsTests, ConversionUtils_Test_ToUnorm16)
+                {
+                    std::vector<uint16_t> output(ComponentCount);
+
+                    const auto bytes = GenerateComponents<uint8_t>(ComponentCount);
+                    ConversionUtils::ToUnorm16(bytes.data(), COMPONENT_UNSIGNED_BYTE, output.data(), ComponentCount);
+
+                    for (size_t i = 0; i < ComponentCount; ++i)
+                    {
+                        Assert::AreEqual<uint16_t>(static_cast<uint16_t>(bytes[i] * 257U), output[i]);
+                    }
+
+                    const auto shorts = GenerateComponents<uint16_t>(ComponentCount);
+                    ConversionUtils::ToUnorm16(shorts.data(), COMPONENT_UNSIGNED_SHORT, output.data(), ComponentCount);
+                    Assert::IsTrue(shorts == output);
+
+                    const auto floats = GenerateUnormFloats(ComponentCount);
+                    ConversionUtils::ToUnorm16(floats.data(), COMPONENT_FLOAT, output.data(), ComponentCount);
+
+                    for (size_t i = 0; i < ComponentCount; ++i)
+                    {
+                        Assert::AreEqual(ExpectedUnorm16(floats[i]), output[i]);
+                    }
+                }
+
+                GLTFSDK_TEST_METHOD(ConversionUtilsTests, ConversionUtils_Test_ToRGBA8)
+                {
+                    const auto floats = GenerateUnormFloats(ComponentCount * 4U);
+                    const auto shorts = GenerateComponents<uint16_t>(ComponentCount * 4U);
+
+                    std::vector<uint32_t> output(ComponentCount);
+
+                    ConversionUtils::ToRGBA8(floats.data(), COMPONENT_FLOAT, 4U, output.data(), ComponentCount);
+
+                    for (size_t i = 0; i < ComponentCount; ++i)
+                    {
+                        const float* c = floats.data() + i * 4U;
+                        Assert::AreEqual(Color4::Clamp(Color4(c[0], c[1], c[2], c[3]), 0.0f, 1.0f).AsUint32RGBA(), output[i]);
+                    }
+
+                    ConversionUtils::ToRGBA8(shorts.data(), COMPONENT_UNSIGNED_SHORT, 3U, output.data(), ComponentCount);
+
+                    for (size_t i = 0; i < ComponentCount; ++i)
+                    {
+                        const uint16_t* c = shorts.data() + i * 3U;
+                        const uint32_t expected = static_cast<uint32_t>(ExpectedUnorm8(c[0]))
+                            | (ExpectedUnorm8(c[1]) << 8)
+                            | (ExpectedUnorm8(c[2]) << 16)
+                            | 0xFF000000U;
+
+                        Assert::AreEqual(expected, output[i]);
+                    }
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        ConversionUtils::ToRGBA8(floats.data(), COMPONENT_FLOAT, 2U, output.data(), ComponentCount);
+                    });
+                }
+            };
+        }
+    }
+}
@@ -0,0 +1,154 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+#include <GLTFSDK/BoundsUtils.h>
+#include <GLTFSDK/FlatSceneGraph.h>
+#include <GLTFSDK/Traverse.h>
+
+#include "TestUtils.h"
+
+#include <cmath>
+
+using namespace glTF::UnitTest;
+
+namespace
+{
+    using namespace Microsoft::glTF;
+
+    void AddNode(Document& doc, const std::string& id, const std::vector<std::string>& children, const Vector3& translation = Vector3::ZERO)
+    {
+        Node node;
+        node.id = id;
+        node.children = children;
+        node.translation = translation;
+        node.rotation = Quaternion(0.0f, std::sin(0.25f), 0.0f, std::cos(0.25f));
+
+        doc.nodes.Append(node);
+    }
+
+    // The scene's roots are a and d, a's children are b and c, and c's child is e. The node f isn't in the scene.
+    Document CreateDocument()
+    {
+        Document doc;
+
+        AddNode(doc, "e", {}, Vector3(0.0f, 0.0f, 1.0f));
+        AddNode(doc, "a", { "b", "c" }, Vector3(1.0f, 0.0f, 0.0f));
+        AddNode(doc, "b", {});
+        AddNode(doc, "c", { "e" }, Vector3(0.0f, 1.0f, 0.0f));
+        AddNode(doc, "d", {});
+        AddNode(doc, "f", {});
+
+        Scene scene;
+        scene.id = "0";
+        scene.nodes = { "a", "d" };
+
+        doc.SetDefaultScene(std::move(scene));
+
+        return doc;
+    }
+}
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Test
+        {
+            GLTFSDK_TEST_CLASS(FlatSceneGraphTests)
+            {
+                GLTFSDK_TEST_METHOD(FlatSceneGraphTests, FlatSceneGraph_Test_Layout)
+                {
+                    const auto doc = CreateDocument();
+                    const FlatSceneGraph sceneGraph(doc);
+
+                    const size_t none = FlatSceneGraph::NoParent;
+
+                    // a, b, c, e, d
+                    Assert::AreEqual<size_t>(5U, sceneGraph.GetNodeCount());
+                    AreEqual(std::vector<size_t>({ 1U, 2U, 3U, 0U, 4U }), sceneGraph.GetNodeIndices());
+                    AreEqual(std::vector<size_t>({ none, 0U, 0U, 2U, none }), sceneGraph.GetParents());
+                    AreEqual(std::vector<size_t>({ 4U, 1U, 2U, 1U, 1U }), sceneGraph.GetSubtreeSizes());
+
+                    Assert::AreEqual<size_t>(2U, sceneGraph.GetDepth(3U));
+                    Assert::AreEqual<size_t>(0U, sceneGraph.GetDepth(4U));
+
+                    Assert::AreEqual<size_t>(3U, sceneGraph.GetFlatIndex(0U));
+                    Assert::AreEqual(FlatSceneGraph::NotInScene, sceneGraph.GetFlatIndex(5U));
+
+                    Assert::IsTrue(sceneGraph.IsAncestor(0U, 3U));
+                    Assert::IsTrue(sceneGraph.IsAncestor(2U, 3U));
+                    Assert::IsFalse(sceneGraph.IsAncestor(1U, 3U));
+                    Assert::IsFalse(sceneGraph.IsAncestor(0U, 4U));
+                    Assert::IsFalse(sceneGraph.IsAncestor(3U, 3U));
+
+                    // A scene can start below the document's root nodes and share a precomputed hierarchy
+                    Scene subScene;
+                    subScene.id = "1";
+                    subScene.nodes = { "c", "b" };
+
+                    const FlatSceneGraph subSceneGraph(doc, subScene, PoseUtils::GetNodeHierarchy(doc));
+
+                    // c, e, b
+                    AreEqual(std::vector<size_t>({ 3U, 0U, 2U }), subSceneGraph.GetNodeIndices());
+                    AreEqual(std::vector<size_t>({ none, 0U, none }), subSceneGraph.GetParents());
+                    AreEqual(std::vector<size_t>({ 2U, 1U, 1U }), subSceneGraph.GetSubtreeSizes());
+                    Assert::AreEqual(FlatSceneGraph::NotInScene, subSceneGraph.GetFlatIndex(1U));
+
+                    // A node can't be reachable twice
+                    auto invalid = CreateDocument();
+                    auto d = invalid.nodes["d"];
+                    d.children = { "e" };
+                    invalid.nodes.Replace(d);
+
+                    Assert::ExpectException<GLTFException>([&invalid]() { FlatSceneGraph sceneGraph(invalid); });
+
+                    subScene.nodes = { "a", "c" };
+
+                    Assert::ExpectException<GLTFException>([&doc, &subScene]() { FlatSceneGraph sceneGraph(doc, subScene); });
+                }
+
+                GLTFSDK_TEST_METHOD(FlatSceneGraphTests, FlatSceneGraph_Test_Traverse)
+                {
+                    const auto doc = CreateDocument();
+                    const FlatSceneGraph sceneGraph(doc);
+
+                    std::vector<std::pair<std::string, std::string>> expected;
+                    std::vector<std::pair<std::string, std::string>> actual;
+
+                    Traverse(doc, DefaultSceneIndex, [&expected](const Node& node, const Node* parent)
+                    {
+                        expected.emplace_back(node.id, parent ? parent->id : std::string());
+                    });
+
+                    sceneGraph.Traverse(doc, [&actual](const Node& node, const Node* parent)
+                    {
+                        actual.emplace_back(node.id, parent ? parent->id : std::string());
+                    });
+
+                    Assert::IsTrue(expected == actual);
+                }
+
+                GLTFSDK_TEST_METHOD(FlatSceneGraphTests, FlatSceneGraph_Test_ComputeWorldTransforms)
+                {
+                    const auto doc = CreateDocument();
+                    const FlatSceneGraph sceneGraph(doc);
+
+                    const auto localTransforms = sceneGraph.GetLocalTransforms(doc);
+
+                    std::vector<Matrix4> worldTransforms(sceneGraph.GetNodeCount());
+
+                    sceneGraph.ComputeWorldTransforms(localTransforms.data(), worldTransforms.data());
+
+                    const auto hierarchy = PoseUtils::GetNodeHierarchy(doc);
+
+                    for (size_t i = 0U; i < sceneGraph.GetNodeCount(); ++i)
+                    {
+                        AreNear(BoundsUtils::GetWorldTransform(doc, hierarchy, doc.nodes[sceneGraph.GetNodeIndex(i)].id), worldTransforms[i]);
+                    }
+                }
+            };
+        }
+    }
+}
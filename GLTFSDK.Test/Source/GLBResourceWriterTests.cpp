@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #include "stdafx.h"
+#include <GLTFSDK/BufferBuilder.h>
 #include <GLTFSDK/Deserialize.h>
 #include <GLTFSDK/GLBResourceReader.h>
 #include <GLTFSDK/GLBResourceWriter.h>
@@ -37,6 +38,69 @@ namespace Microsoft
                     Assert::IsFalse(stream->fail());
                     Assert::IsTrue(doc == roundTrippedDoc);
                 }
+
+                GLTFSDK_TEST_METHOD(GLBResourceWriterTests, WriteBufferView_Streamed_Image)
+                {
+                    auto streamWriter = std::make_shared<const StreamReaderWriter>();
+                    BufferBuilder bufferBuilder(std::make_unique<GLBResourceWriter>(streamWriter));
+                    bufferBuilder.AddBuffer(GLB_BUFFER_ID);
+
+                    // Larger than a single chunk so that the image is copied in several pieces
+                    std::string imageData(200U * 1024U + 3U, '\0');
+
+                    for (size_t i = 0; i < imageData.size(); ++i)
+                    {
+                        imageData[i] = static_cast<char>(i * 31U);
+                    }
+
+                    const std::vector<float> positions = { 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f };
+
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+                    bufferBuilder.AddAccessor(positions, { TYPE_VEC3, COMPONENT_FLOAT });
+
+                    std::istringstream imageStream(imageData);
+
+                    Image image;
+                    image.bufferViewId = bufferBuilder.AddBufferView(imageStream, imageData.size()).id;
+                    image.mimeType = MIMETYPE_PNG;
+
+                    // Data following the streamed image is correctly aligned
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+                    bufferBuilder.AddAccessor(positions, { TYPE_VEC3, COMPONENT_FLOAT });
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+                    doc.images.Append(std::move(image), AppendIdPolicy::GenerateOnEmpty);
+
+                    const std::string uri = "foo.glb";
+                    static_cast<GLBResourceWriter&>(bufferBuilder.GetResourceWriter()).Flush("{}", uri);
+
+                    GLBResourceReader resourceReader(streamWriter, streamWriter->GetInputStream(uri));
+
+                    const auto roundTrippedImageData = resourceReader.ReadBinaryData(doc, doc.images.Front());
+
+                    Assert::IsTrue(std::equal(imageData.begin(), imageData.end(), roundTrippedImageData.begin(), roundTrippedImageData.end(), [](char a, uint8_t b) { return static_cast<uint8_t>(a) == b; }));
+                    AreEqual(positions, resourceReader.ReadBinaryData<float>(doc, doc.accessors[0]));
+                    AreEqual(positions, resourceReader.ReadBinaryData<float>(doc, doc.accessors[1]));
+                }
+
+                GLTFSDK_TEST_METHOD(GLBResourceWriterTests, WriteBufferView_Streamed_Truncated)
+                {
+                    auto streamWriter = std::make_shared<const StreamReaderWriter>();
+                    BufferBuilder bufferBuilder(std::make_unique<GLBResourceWriter>(streamWriter));
+                    bufferBuilder.AddBuffer(GLB_BUFFER_ID);
+
+                    std::istringstream imageStream(std::string(16U, 'x'));
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        bufferBuilder.AddBufferView(imageStream, 32U);
+                    });
+
+                    // The builder isn't left holding a buffer view without any data
+                    Assert::AreEqual<size_t>(0U, bufferBuilder.GetBufferViewCount());
+                    Assert::AreEqual<size_t>(0U, bufferBuilder.GetCurrentBuffer().byteLength);
+                }
             };
         }
     }
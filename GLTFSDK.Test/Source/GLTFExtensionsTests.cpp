@@ -7,6 +7,7 @@
 #include <GLTFSDK/Extension.h>
 #include <GLTFSDK/ExtensionHandlers.h>
 #include <GLTFSDK/ExtensionsKHR.h>
+#include <GLTFSDK/ExtensionsMSFT.h>
 #include <GLTFSDK/RapidJsonUtils.h>
 #include <GLTFSDK/Serialize.h>
 #include <GLTFSDK/SchemaValidation.h>
@@ -342,6 +343,30 @@ namespace Microsoft
                     Assert::IsTrue(doc == outputDoc, L"Input gltf and output gltf are not equal");
                 }
 
+                GLTFSDK_TEST_METHOD(ExtensionsTests, Extensions_Test_RoundTrip_And_Equality_Lod)
+                {
+                    const auto inputJson = ReadLocalJson(c_cubeWithLODJson);
+
+                    const auto extensionDeserializer = MSFT::GetMSFTExtensionDeserializer();
+                    const auto extensionSerializer = MSFT::GetMSFTExtensionSerializer();
+
+                    auto doc = Deserialize(inputJson, extensionDeserializer);
+
+                    Assert::IsTrue(doc.nodes[1].HasExtension<MSFT::Lod>());
+
+                    const auto& lod = doc.nodes[1].GetExtension<MSFT::Lod>();
+
+                    Assert::AreEqual<size_t>(lod.ids.size(), 1);
+                    Assert::AreEqual<std::string>(lod.ids[0], "3");
+
+                    // Serialize Document back to json
+                    auto outputJson = Serialize(doc, extensionSerializer);
+                    auto outputDoc = Deserialize(outputJson, extensionDeserializer);
+
+                    // Compare input and output Documents
+                    Assert::IsTrue(doc == outputDoc, L"Input gltf and output gltf are not equal");
+                }
+
                 GLTFSDK_TEST_METHOD(ExtensionsTests, Extensions_Test_GetExtension)
                 {
                     const auto inputJson = ReadLocalJson(c_cubeJson);
@@ -3,8 +3,10 @@
 
 #include "stdafx.h"
 
+#include <GLTFSDK/BufferBuilder.h>
 #include <GLTFSDK/Deserialize.h>
 #include <GLTFSDK/GLTFResourceReader.h>
+#include <GLTFSDK/GLTFResourceWriter.h>
 
 #include "TestUtils.h"
 
@@ -576,6 +578,114 @@ namespace Microsoft
 
                     Assert::IsTrue(output == expectedReadOutput);
                 }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadAccessorStridedSpan)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+
+                    BufferBuilder bufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+                    bufferBuilder.AddBuffer();
+
+                    const std::vector<uint16_t> values = { 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 9U, 10U, 11U, 12U };
+
+                    // Read the same data from both a tightly packed and an interleaved buffer view
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+                    const auto packedAccessorId = bufferBuilder.AddAccessor(values, { TYPE_VEC2, COMPONENT_UNSIGNED_SHORT }).id;
+
+                    const AccessorDesc descs[] = { { TYPE_VEC2, COMPONENT_UNSIGNED_SHORT }, { TYPE_VEC2, COMPONENT_UNSIGNED_SHORT } };
+                    std::vector<uint16_t> interleaved;
+
+                    for (size_t i = 0; i < values.size(); i += 2U)
+                    {
+                        interleaved.insert(interleaved.end(), { values[i], values[i + 1U], 0U, 0U });
+                    }
+
+                    std::string interleavedAccessorIds[2];
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+                    bufferBuilder.AddAccessors(interleaved.data(), values.size() / 2U, 8U, descs, 2U, interleavedAccessorIds);
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    GLTFResourceReader reader(readerWriter);
+
+                    for (const auto& accessorId : { packedAccessorId, interleavedAccessorIds[0] })
+                    {
+                        const auto& accessor = doc.accessors.Get(accessorId);
+
+                        // Each output element is two values followed by one unwritten value
+                        std::vector<uint16_t> output(accessor.count * 3U, UINT16_MAX);
+                        reader.ReadBinaryData<uint16_t>(doc, accessor, StridedSpan<uint16_t>(output.data(), accessor.count, 3U * sizeof(uint16_t)));
+
+                        for (size_t i = 0; i < accessor.count; ++i)
+                        {
+                            Assert::AreEqual(values[i * 2U], output[i * 3U]);
+                            Assert::AreEqual(values[i * 2U + 1U], output[i * 3U + 1U]);
+                            Assert::AreEqual<uint16_t>(UINT16_MAX, output[i * 3U + 2U]);
+                        }
+
+                        // A byte stride of zero means the output is tightly packed
+                        std::vector<uint16_t> outputPacked(values.size());
+                        reader.ReadBinaryData<uint16_t>(doc, accessor, StridedSpan<uint16_t>(outputPacked.data(), accessor.count));
+
+                        AreEqual(values, outputPacked);
+
+                        Assert::ExpectException<GLTFException>([&]()
+                        {
+                            reader.ReadBinaryData<uint16_t>(doc, accessor, StridedSpan<uint16_t>(outputPacked.data(), accessor.count - 1U));
+                        });
+                    }
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceReaderTests, TestReadAccessorChunked)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+
+                    BufferBuilder bufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+                    bufferBuilder.AddBuffer();
+
+                    // Enough elements that both the accessor and the interleaved buffer view are read in several chunks
+                    const size_t count = 20000U;
+
+                    std::vector<float> interleaved;
+                    std::vector<float> values;
+
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        const float value = static_cast<float>(i);
+
+                        interleaved.insert(interleaved.end(), { value, value + 0.25f, value + 0.5f, -1.0f });
+                        values.insert(values.end(), { value, value + 0.25f, value + 0.5f });
+                    }
+
+                    const AccessorDesc descs[] = { { TYPE_VEC3, COMPONENT_FLOAT }, { TYPE_SCALAR, COMPONENT_FLOAT, false, {}, {}, 12U } };
+
+                    std::string accessorIds[2];
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+                    bufferBuilder.AddAccessors(interleaved.data(), count, 16U, descs, 2U, accessorIds);
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    GLTFResourceReader reader(readerWriter);
+
+                    const auto& accessor = doc.accessors.Get(accessorIds[0]);
+
+                    std::vector<float> output;
+                    size_t chunkCount = 0U;
+
+                    reader.ReadBinaryDataChunked<float>(doc, accessor, [&](const float* components, size_t first, size_t elementCount)
+                    {
+                        Assert::AreEqual(output.size() / 3U, first);
+
+                        output.insert(output.end(), components, components + elementCount * 3U);
+                        ++chunkCount;
+                    });
+
+                    Assert::IsTrue(chunkCount > 1U);
+                    AreEqual(values, output);
+                    AreEqual(values, reader.ReadBinaryData<float>(doc, accessor));
+                }
             };
         }
     }
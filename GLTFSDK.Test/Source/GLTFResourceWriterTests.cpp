@@ -774,6 +774,210 @@ namespace Microsoft
                         AreEqual(expected, output);
                     }
                 }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceWriterTests, BufferBuilderIndicesAccessor)
+                {
+                    auto streamReaderWriter = std::make_shared<const StreamReaderWriter>();
+
+                    BufferBuilder bufferBuilder(std::make_unique<GLTFResourceWriter>(streamReaderWriter));
+                    bufferBuilder.AddBuffer();
+
+                    // The maximum value of each component type is reserved for primitive restart
+                    const std::pair<uint32_t, ComponentType> cases[] = {
+                        { UINT8_MAX - 1U, COMPONENT_UNSIGNED_BYTE },
+                        { UINT8_MAX, COMPONENT_UNSIGNED_SHORT },
+                        { UINT16_MAX - 1U, COMPONENT_UNSIGNED_SHORT },
+                        { UINT16_MAX, COMPONENT_UNSIGNED_INT }
+                    };
+
+                    std::vector<std::vector<uint32_t>> indices;
+                    std::vector<std::string> accessorIds;
+
+                    for (const auto& c : cases)
+                    {
+                        // An odd index count ensures the vectorized and scalar code paths are both used and, as the
+                        // narrowed indices are written in fixed size chunks, that the last chunk is only partly filled
+                        std::vector<uint32_t> caseIndices(2U * 16384U + 37U);
+
+                        for (size_t i = 0; i < caseIndices.size(); ++i)
+                        {
+                            caseIndices[i] = static_cast<uint32_t>((i * 7919U) % (c.first + 1U));
+                        }
+
+                        caseIndices[caseIndices.size() / 2U] = c.first;
+
+                        bufferBuilder.AddBufferView(BufferViewTarget::ELEMENT_ARRAY_BUFFER);
+                        const auto& accessor = bufferBuilder.AddIndicesAccessor(caseIndices);
+
+                        Assert::IsTrue(accessor.componentType == c.second);
+
+                        indices.push_back(std::move(caseIndices));
+                        accessorIds.push_back(accessor.id);
+                    }
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    GLTFResourceReader resourceReader(streamReaderWriter);
+
+                    for (size_t i = 0; i < indices.size(); ++i)
+                    {
+                        AreEqual(indices[i], MeshPrimitiveUtils::GetIndices32(doc, resourceReader, doc.accessors.Get(accessorIds[i])));
+                    }
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceWriterTests, BufferBuilderDeduplicateBufferViews)
+                {
+                    auto streamReaderWriter = std::make_shared<const StreamReaderWriter>();
+
+                    BufferBuilder bufferBuilder(std::make_unique<GLTFResourceWriter>(streamReaderWriter));
+                    bufferBuilder.SetDeduplication(true);
+                    bufferBuilder.AddBuffer();
+
+                    const std::vector<uint16_t> indices = { 0, 1, 2, 2, 1, 3 };
+                    const std::vector<uint16_t> indicesOther = { 0, 1, 2, 2, 3, 0 };
+
+                    const std::string bufferViewId0 = bufferBuilder.AddBufferView(indices, 0, BufferViewTarget::ELEMENT_ARRAY_BUFFER).id;
+                    const std::string bufferViewId1 = bufferBuilder.AddBufferView(indices, 0, BufferViewTarget::ELEMENT_ARRAY_BUFFER).id;
+                    const std::string bufferViewId2 = bufferBuilder.AddBufferView(indicesOther, 0, BufferViewTarget::ELEMENT_ARRAY_BUFFER).id;
+                    const std::string bufferViewId3 = bufferBuilder.AddBufferView(indices, 0, BufferViewTarget::ARRAY_BUFFER).id;
+
+                    Assert::AreEqual(bufferViewId0, bufferViewId1);
+                    Assert::AreEqual(bufferViewId3, bufferBuilder.GetCurrentBufferView().id);
+                    Assert::AreNotEqual(bufferViewId0, bufferViewId2);
+                    Assert::AreNotEqual(bufferViewId0, bufferViewId3);
+
+                    Assert::AreEqual<size_t>(3U, bufferBuilder.GetBufferViewCount());
+                    Assert::AreEqual<size_t>(indices.size() * sizeof(uint16_t), bufferBuilder.GetDeduplicatedByteLength());
+                    Assert::AreEqual<size_t>(3U * indices.size() * sizeof(uint16_t), bufferBuilder.GetCurrentBuffer().byteLength);
+
+                    const std::string bufferUri = bufferBuilder.GetCurrentBuffer().uri;
+                    const auto bufferStream = std::dynamic_pointer_cast<std::stringstream>(streamReaderWriter->GetInputStream(bufferUri));
+
+                    Assert::AreEqual<size_t>(3U * indices.size() * sizeof(uint16_t), bufferStream->str().size());
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceWriterTests, BufferBuilderDeduplicateAccessors)
+                {
+                    auto streamReaderWriter = std::make_shared<const StreamReaderWriter>();
+
+                    BufferBuilder bufferBuilder(std::make_unique<GLTFResourceWriter>(streamReaderWriter));
+                    bufferBuilder.SetDeduplication(true);
+                    bufferBuilder.AddBuffer();
+
+                    const std::vector<float> texCoords = { 0.0f, 0.0f, 1.0f, 0.0f, 1.0f, 1.0f };
+
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+                    const std::string accessorId0 = bufferBuilder.AddAccessor(texCoords, { TYPE_VEC2, COMPONENT_FLOAT }).id;
+
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+                    const std::string accessorId1 = bufferBuilder.AddAccessor(texCoords, { TYPE_VEC2, COMPONENT_FLOAT }).id;
+
+                    // The same data described with different min & max values must not be shared
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+                    const std::string accessorId2 = bufferBuilder.AddAccessor(texCoords, { TYPE_VEC2, COMPONENT_FLOAT, false, { 0.0f, 0.0f }, { 1.0f, 1.0f } }).id;
+
+                    Assert::AreEqual(accessorId0, accessorId1);
+                    Assert::AreNotEqual(accessorId0, accessorId2);
+                    Assert::AreEqual<size_t>(texCoords.size() * sizeof(float), bufferBuilder.GetDeduplicatedByteLength());
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    // No buffer view is appended for the deduplicated accessor
+                    Assert::AreEqual<size_t>(2U, doc.bufferViews.Size());
+                    Assert::AreEqual<size_t>(2U, doc.accessors.Size());
+                    Assert::IsTrue(doc.bufferViews.Has("0"));
+                    Assert::IsTrue(doc.bufferViews.Has("1"));
+
+                    GLTFResourceReader resourceReader(streamReaderWriter);
+
+                    for (const auto& accessor : doc.accessors.Elements())
+                    {
+                        Assert::IsTrue(doc.bufferViews.Has(accessor.bufferViewId));
+                        AreEqual(texCoords, resourceReader.ReadBinaryData<float>(doc, accessor));
+                    }
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceWriterTests, BufferBuilderDeduplicateAccessors_CurrentAccessor)
+                {
+                    auto streamReaderWriter = std::make_shared<const StreamReaderWriter>();
+
+                    BufferBuilder bufferBuilder(std::make_unique<GLTFResourceWriter>(streamReaderWriter));
+                    bufferBuilder.SetDeduplication(true);
+                    bufferBuilder.AddBuffer();
+
+                    const std::vector<float> texCoords = { 0.0f, 0.0f, 1.0f, 0.0f, 1.0f, 1.0f };
+                    const std::vector<float> texCoordsOther = { 1.0f, 1.0f, 0.0f, 1.0f, 0.0f, 0.0f };
+
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+                    const std::string accessorId0 = bufferBuilder.AddAccessor(texCoords, { TYPE_VEC2, COMPONENT_FLOAT }).id;
+
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+                    const std::string accessorId1 = bufferBuilder.AddAccessor(texCoordsOther, { TYPE_VEC2, COMPONENT_FLOAT }).id;
+
+                    // The deduplicated accessor is the current accessor, not the most recently created one
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+                    const std::string accessorId2 = bufferBuilder.AddAccessor(texCoords, { TYPE_VEC2, COMPONENT_FLOAT }).id;
+
+                    Assert::AreEqual(accessorId0, accessorId2);
+                    Assert::AreEqual(accessorId0, bufferBuilder.GetCurrentAccessor().id);
+                    Assert::AreNotEqual(accessorId1, bufferBuilder.GetCurrentAccessor().id);
+
+                    // Likewise the current buffer view is the one used by the deduplicated accessor
+                    Assert::AreEqual(bufferBuilder.GetCurrentAccessor().bufferViewId, bufferBuilder.GetCurrentBufferView().id);
+                    Assert::AreEqual<size_t>(3U, bufferBuilder.GetBufferViewCount());
+
+                    // The buffer view left empty by the deduplicated accessor is never output
+                    bufferBuilder.SetDeduplication(false);
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    Assert::AreEqual<size_t>(2U, doc.bufferViews.Size());
+                    Assert::AreEqual<size_t>(2U, doc.accessors.Size());
+                }
+
+                GLTFSDK_TEST_METHOD(GLTFResourceWriterTests, BufferBuilderDeduplicateAccessors_BufferViewId)
+                {
+                    auto streamReaderWriter = std::make_shared<const StreamReaderWriter>();
+
+                    BufferBuilder bufferBuilder(std::make_unique<GLTFResourceWriter>(streamReaderWriter));
+                    bufferBuilder.SetDeduplication(true);
+                    bufferBuilder.AddBuffer();
+
+                    const std::vector<float> texCoords = { 0.0f, 0.0f, 1.0f, 0.0f, 1.0f, 1.0f };
+                    const std::vector<float> texCoordsOther = { 1.0f, 1.0f, 0.0f, 1.0f, 0.0f, 0.0f };
+
+                    const std::string bufferViewId0 = bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER).id;
+                    const std::string accessorId0 = bufferBuilder.AddAccessor(texCoords, { TYPE_VEC2, COMPONENT_FLOAT }).id;
+
+                    Assert::IsFalse(bufferViewId0.empty());
+                    Assert::AreEqual(bufferViewId0, bufferBuilder.GetCurrentAccessor().bufferViewId);
+
+                    // The buffer view left empty by the deduplicated accessor is reused by the next accessor
+                    const std::string bufferViewId1 = bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER).id;
+                    bufferBuilder.AddAccessor(texCoords, { TYPE_VEC2, COMPONENT_FLOAT });
+
+                    const std::string bufferViewId2 = bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER).id;
+                    const std::string accessorId2 = bufferBuilder.AddAccessor(texCoordsOther, { TYPE_VEC2, COMPONENT_FLOAT }).id;
+
+                    Assert::IsFalse(bufferViewId1.empty());
+                    Assert::AreEqual(bufferViewId1, bufferViewId2);
+                    Assert::AreNotEqual(bufferViewId0, bufferViewId1);
+                    Assert::AreNotEqual(accessorId0, accessorId2);
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    Assert::AreEqual<size_t>(2U, doc.bufferViews.Size());
+                    Assert::AreEqual(bufferViewId2, doc.accessors.Get(accessorId2).bufferViewId);
+
+                    for (const auto& bufferView : doc.bufferViews.Elements())
+                    {
+                        Assert::AreNotEqual<size_t>(0U, bufferView.byteLength);
+                    }
+                }
             };
         }
     }
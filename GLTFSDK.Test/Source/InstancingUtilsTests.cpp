@@ -0,0 +1,191 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+#include <GLTFSDK/BufferBuilder.h>
+#include <GLTFSDK/Deserialize.h>
+#include <GLTFSDK/GLTF.h>
+#include <GLTFSDK/GLTFResourceReader.h>
+#include <GLTFSDK/GLTFResourceWriter.h>
+#include <GLTFSDK/InstancingUtils.h>
+#include <GLTFSDK/Serialize.h>
+
+#include "TestUtils.h"
+
+#include <cmath>
+
+using namespace glTF::UnitTest;
+
+namespace
+{
+    using namespace Microsoft::glTF;
+
+    void AddNode(Document& doc, const std::string& id, const std::string& meshId, const Vector3& translation, const std::vector<std::string>& children = {})
+    {
+        Node node;
+        node.id = id;
+        node.meshId = meshId;
+        node.translation = translation;
+        node.children = children;
+
+        doc.nodes.Append(std::move(node));
+    }
+
+    // The root's children a0..a2 and the scene's roots r0 and r1 can be instanced. Of the root's other children b has a
+    // different mesh, m has a matrix and x is animated.
+    Document CreateDocument()
+    {
+        Document doc;
+
+        Mesh mesh0;
+        mesh0.id = "0";
+        doc.meshes.Append(std::move(mesh0));
+
+        Mesh mesh1;
+        mesh1.id = "1";
+        doc.meshes.Append(std::move(mesh1));
+
+        AddNode(doc, "root", "", Vector3::ZERO, { "a0", "b", "a1", "m", "x", "a2" });
+        AddNode(doc, "a0", "0", Vector3(1.0f, 0.0f, 0.0f));
+        AddNode(doc, "b", "1", Vector3(2.0f, 0.0f, 0.0f));
+        AddNode(doc, "a1", "0", Vector3(3.0f, 0.0f, 0.0f));
+        AddNode(doc, "x", "0", Vector3(4.0f, 0.0f, 0.0f));
+        AddNode(doc, "a2", "0", Vector3(5.0f, 0.0f, 0.0f));
+        AddNode(doc, "r0", "1", Vector3(0.0f, 1.0f, 0.0f));
+        AddNode(doc, "r1", "1", Vector3(0.0f, 2.0f, 0.0f));
+
+        Node m;
+        m.id = "m";
+        m.meshId = "0";
+        m.matrix = Math::CreateTransform(Vector3(0.0f, 0.0f, 1.0f), Quaternion::IDENTITY, Vector3::ONE);
+        doc.nodes.Append(std::move(m));
+
+        // The instances' rotations and scales
+        auto a1 = doc.nodes["a1"];
+        a1.rotation = Quaternion(0.0f, std::sin(0.5f), 0.0f, std::cos(0.5f));
+        doc.nodes.Replace(a1);
+
+        auto a2 = doc.nodes["a2"];
+        a2.scale = Vector3(2.0f, 2.0f, 2.0f);
+        doc.nodes.Replace(a2);
+
+        AnimationChannel channel;
+        channel.id = "0";
+        channel.target.nodeId = "x";
+        channel.target.path = TARGET_TRANSLATION;
+
+        Animation animation;
+        animation.id = "0";
+        animation.channels.Append(std::move(channel));
+        doc.animations.Append(std::move(animation));
+
+        Scene scene;
+        scene.id = "0";
+        scene.nodes = { "root", "r0", "r1" };
+
+        doc.SetDefaultScene(std::move(scene));
+
+        return doc;
+    }
+}
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Test
+        {
+            GLTFSDK_TEST_CLASS(InstancingUtilsTests)
+            {
+                GLTFSDK_TEST_METHOD(InstancingUtilsTests, InstancingUtils_Test_FindInstanceGroups)
+                {
+                    const auto doc = CreateDocument();
+                    const auto groups = InstancingUtils::FindInstanceGroups(doc);
+
+                    Assert::AreEqual<size_t>(2U, groups.size());
+
+                    Assert::AreEqual(std::string("0"), groups[0].meshId);
+                    Assert::AreEqual(std::string("root"), groups[0].parentId);
+                    Assert::IsTrue(groups[0].sceneId.empty());
+                    Assert::IsTrue(std::vector<std::string>({ "a0", "a1", "a2" }) == groups[0].nodeIds);
+
+                    Assert::AreEqual(std::string("1"), groups[1].meshId);
+                    Assert::IsTrue(groups[1].parentId.empty());
+                    Assert::AreEqual(std::string("0"), groups[1].sceneId);
+                    Assert::IsTrue(std::vector<std::string>({ "r0", "r1" }) == groups[1].nodeIds);
+
+                    Assert::AreEqual<size_t>(1U, InstancingUtils::FindInstanceGroups(doc, 3U).size());
+                    Assert::IsTrue(InstancingUtils::FindInstanceGroups(doc, 4U).empty());
+                }
+
+                GLTFSDK_TEST_METHOD(InstancingUtilsTests, InstancingUtils_Test_InstanceMeshes_RoundTrip)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+
+                    auto doc = CreateDocument();
+
+                    const std::vector<Matrix4> expected = {
+                        Math::CreateTransform(doc.nodes["a0"].translation, doc.nodes["a0"].rotation, doc.nodes["a0"].scale),
+                        Math::CreateTransform(doc.nodes["a1"].translation, doc.nodes["a1"].rotation, doc.nodes["a1"].scale),
+                        Math::CreateTransform(doc.nodes["a2"].translation, doc.nodes["a2"].rotation, doc.nodes["a2"].scale)
+                    };
+
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+
+                    Assert::AreEqual<size_t>(5U, InstancingUtils::InstanceMeshes(doc, bufferBuilder));
+
+                    bufferBuilder.Output(doc);
+
+                    // root, b, x, m and the two instanced nodes
+                    Assert::AreEqual<size_t>(6U, doc.nodes.Size());
+                    Assert::IsFalse(doc.nodes.Has("a1"));
+                    Assert::IsFalse(doc.nodes.Has("r1"));
+
+                    const auto& root = doc.nodes["root"];
+                    const auto& scene = doc.GetDefaultScene();
+
+                    Assert::AreEqual<size_t>(4U, root.children.size());
+                    Assert::AreEqual(std::string("b"), root.children[1]);
+                    Assert::AreEqual<size_t>(2U, scene.nodes.size());
+
+                    const auto& instanced = doc.nodes[root.children[0]];
+                    const auto& instancedRoot = doc.nodes[scene.nodes[1]];
+
+                    Assert::AreEqual(std::string("0"), instanced.meshId);
+                    Assert::AreEqual(std::string("1"), instancedRoot.meshId);
+
+                    // The roots only differ in translation
+                    const auto& meshGpuInstancing = instanced.GetExtension<EXT::Nodes::MeshGpuInstancing>();
+                    const auto& rootMeshGpuInstancing = instancedRoot.GetExtension<EXT::Nodes::MeshGpuInstancing>();
+
+                    Assert::AreEqual<size_t>(3U, meshGpuInstancing.attributes.size());
+                    Assert::AreEqual<size_t>(1U, rootMeshGpuInstancing.attributes.size());
+
+                    GLTFResourceReader reader(readerWriter);
+
+                    const auto actual = InstancingUtils::GetInstanceTransforms(doc, reader, meshGpuInstancing);
+
+                    Assert::IsTrue(expected == actual);
+                    Assert::AreEqual<size_t>(2U, InstancingUtils::GetInstanceTransforms(doc, reader, rootMeshGpuInstancing).size());
+
+                    Assert::IsTrue(doc.extensionsRequired.count(EXT::Nodes::MESH_GPU_INSTANCING_NAME) == 1U);
+
+                    // The animation has no sampler and the meshes have no primitives, so neither would pass validation
+                    doc.animations.Clear();
+
+                    const auto json = Serialize(doc, EXT::GetEXTExtensionSerializer());
+                    const auto outputDoc = Deserialize(json, EXT::GetEXTExtensionDeserializer(), DeserializeFlags::None, SchemaFlags::DisableSchemaRoot);
+
+                    // The deserialized document's node ids are indices, but its accessor ids are the same
+                    const auto& outputNode = outputDoc.nodes[doc.nodes.GetIndex(instanced.id)];
+
+                    Assert::IsTrue(outputNode.GetExtension<EXT::Nodes::MeshGpuInstancing>().IsEqual(meshGpuInstancing));
+                    Assert::IsTrue(outputDoc.extensionsRequired.count(EXT::Nodes::MESH_GPU_INSTANCING_NAME) == 1U);
+                }
+            };
+        }
+    }
+}
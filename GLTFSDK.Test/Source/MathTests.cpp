@@ -0,0 +1,203 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+#include <GLTFSDK/Math.h>
+
+#include "TestUtils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace glTF::UnitTest;
+
+namespace
+{
+    using namespace Microsoft::glTF;
+
+    Quaternion CreateRotation(float x, float y, float z, float angle)
+    {
+        const float length = std::sqrt(x * x + y * y + z * z);
+        const float s = std::sin(angle * 0.5f) / length;
+
+        return Quaternion(x * s, y * s, z * s, std::cos(angle * 0.5f));
+    }
+
+    Matrix4 CreateMatrix()
+    {
+        return Math::CreateTransform(Vector3(1.0f, -2.0f, 3.0f), CreateRotation(1.0f, 2.0f, 3.0f, 0.8f), Vector3(2.0f, 0.5f, 1.5f));
+    }
+}
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Test
+        {
+            GLTFSDK_TEST_CLASS(MathTests)
+            {
+                GLTFSDK_TEST_METHOD(MathTests, Math_Test_Multiply)
+                {
+                    Matrix4 lhs;
+                    Matrix4 rhs;
+
+                    for (size_t i = 0U; i < 16U; ++i)
+                    {
+                        lhs.values[i] = static_cast<float>(i) - 3.0f;
+                        rhs.values[i] = 0.5f * static_cast<float>(i * i % 7U);
+                    }
+
+                    const auto result = Math::Multiply(lhs, rhs);
+
+                    // The vectorized paths add the products in the same order as a naive implementation
+                    for (size_t column = 0U; column < 4U; ++column)
+                    {
+                        for (size_t row = 0U; row < 4U; ++row)
+                        {
+                            float expected = 0.0f;
+
+                            for (size_t k = 0U; k < 4U; ++k)
+                            {
+                                expected += lhs.values[k * 4U + row] * rhs.values[column * 4U + k];
+                            }
+
+                            Assert::AreEqual(expected, result.values[column * 4U + row]);
+                        }
+                    }
+
+                    Assert::IsTrue(Math::Multiply(Matrix4::IDENTITY, lhs) == lhs);
+                    Assert::IsTrue(Math::Multiply(lhs, Matrix4::IDENTITY) == lhs);
+                }
+
+                GLTFSDK_TEST_METHOD(MathTests, Math_Test_Decompose)
+                {
+                    const Vector3 translation(1.0f, -2.0f, 3.0f);
+                    const Vector3 scale(2.0f, 0.5f, 1.5f);
+
+                    for (const auto& rotation : { Quaternion::IDENTITY, CreateRotation(1.0f, 2.0f, 3.0f, 0.8f), CreateRotation(1.0f, 0.0f, 0.0f, 3.1f), CreateRotation(0.0f, 1.0f, 0.1f, -3.0f), CreateRotation(0.1f, 0.0f, 1.0f, 3.0f) })
+                    {
+                        Vector3 actualTranslation;
+                        Quaternion actualRotation;
+                        Vector3 actualScale;
+
+                        Assert::IsTrue(Math::Decompose(Math::CreateTransform(translation, rotation, scale), actualTranslation, actualRotation, actualScale));
+
+                        AreNear(translation, actualTranslation);
+                        AreNear(rotation, actualRotation);
+                        AreNear(scale, actualScale);
+                    }
+
+                    // A mirroring transform is recomposed, if not from the same TRS
+                    const auto mirror = Math::CreateTransform(translation, CreateRotation(0.0f, 1.0f, 0.0f, 1.0f), Vector3(2.0f, -1.0f, 1.0f));
+
+                    Vector3 t;
+                    Quaternion r;
+                    Vector3 s;
+
+                    Assert::IsTrue(Math::Decompose(mirror, t, r, s));
+                    Assert::IsTrue(s.x < 0.0f);
+                    AreNear(mirror, Math::CreateTransform(t, r, s));
+
+                    Matrix4 projection;
+                    projection.values[11] = -1.0f;
+
+                    Assert::IsFalse(Math::Decompose(projection, t, r, s));
+                    Assert::IsFalse(Math::Decompose(Math::CreateTransform(translation, Quaternion::IDENTITY, Vector3(1.0f, 0.0f, 1.0f)), t, r, s));
+                }
+
+                GLTFSDK_TEST_METHOD(MathTests, Math_Test_TransformPoints)
+                {
+                    const auto matrix = CreateMatrix();
+
+                    // Enough points for the vectorized loop and a remainder
+                    std::vector<float> points;
+
+                    for (size_t i = 0U; i < 11U * 3U; ++i)
+                    {
+                        points.push_back(static_cast<float>(i) * 0.25f - 4.0f);
+                    }
+
+                    std::vector<float> output(points.size());
+
+                    Math::TransformPoints(matrix, points.data(), 11U, output.data());
+
+                    for (size_t i = 0U; i < 11U; ++i)
+                    {
+                        const auto expected = Math::TransformPoint(matrix, Vector3(points[i * 3U], points[i * 3U + 1U], points[i * 3U + 2U]));
+
+                        Assert::AreEqual(expected.x, output[i * 3U]);
+                        Assert::AreEqual(expected.y, output[i * 3U + 1U]);
+                        Assert::AreEqual(expected.z, output[i * 3U + 2U]);
+                    }
+
+                    // In place
+                    Math::TransformPoints(matrix, points.data(), 11U, points.data());
+
+                    AreEqual(output, points);
+                }
+
+                GLTFSDK_TEST_METHOD(MathTests, Math_Test_TransformBounds)
+                {
+                    const std::vector<Matrix4> matrices = { Matrix4::IDENTITY, CreateMatrix(), Math::CreateTransform(Vector3::ZERO, CreateRotation(0.0f, 0.0f, 1.0f, 0.5f), Vector3(-1.0f, 1.0f, 1.0f)) };
+                    const std::vector<Vector3> mins = { Vector3(-1.0f, -2.0f, -3.0f), Vector3(0.0f, 0.0f, 0.0f), Vector3(1.0f, 1.0f, -1.0f) };
+                    const std::vector<Vector3> maxs = { Vector3(1.0f, 2.0f, 3.0f), Vector3(1.0f, 2.0f, 0.5f), Vector3(2.0f, 4.0f, 1.0f) };
+
+                    std::vector<Vector3> outputMins(matrices.size());
+                    std::vector<Vector3> outputMaxs(matrices.size());
+
+                    Math::TransformBounds(matrices.data(), mins.data(), maxs.data(), matrices.size(), outputMins.data(), outputMaxs.data());
+
+                    // The transformed box is the tightest box around the eight transformed corners
+                    for (size_t i = 0U; i < matrices.size(); ++i)
+                    {
+                        const float infinity = std::numeric_limits<float>::infinity();
+
+                        Vector3 expectedMin(infinity, infinity, infinity);
+                        Vector3 expectedMax(-infinity, -infinity, -infinity);
+
+                        for (size_t corner = 0U; corner < 8U; ++corner)
+                        {
+                            const auto point = Math::TransformPoint(matrices[i], Vector3(
+                                (corner & 1U) ? maxs[i].x : mins[i].x,
+                                (corner & 2U) ? maxs[i].y : mins[i].y,
+                                (corner & 4U) ? maxs[i].z : mins[i].z));
+
+                            expectedMin = Vector3(std::min(expectedMin.x, point.x), std::min(expectedMin.y, point.y), std::min(expectedMin.z, point.z));
+                            expectedMax = Vector3(std::max(expectedMax.x, point.x), std::max(expectedMax.y, point.y), std::max(expectedMax.z, point.z));
+                        }
+
+                        AreNear(expectedMin, outputMins[i]);
+                        AreNear(expectedMax, outputMaxs[i]);
+                    }
+                }
+
+                GLTFSDK_TEST_METHOD(MathTests, Math_Test_Slerp)
+                {
+                    const auto a = CreateRotation(0.0f, 1.0f, 0.0f, 0.2f);
+                    const auto b = CreateRotation(0.0f, 1.0f, 0.0f, 1.4f);
+
+                    AreNear(a, Math::Slerp(a, b, 0.0f));
+                    AreNear(b, Math::Slerp(a, b, 1.0f));
+
+                    // Constant angular velocity
+                    AreNear(CreateRotation(0.0f, 1.0f, 0.0f, 0.5f), Math::Slerp(a, b, 0.25f));
+
+                    // Along the shortest arc, even if b is negated
+                    const Quaternion negated(-b.x, -b.y, -b.z, -b.w);
+
+                    AreNear(CreateRotation(0.0f, 1.0f, 0.0f, 0.8f), Math::Slerp(a, negated, 0.5f));
+                    AreNear(CreateRotation(0.0f, 1.0f, 0.0f, 0.8f), Math::Nlerp(a, negated, 0.5f));
+
+                    // Nearly identical rotations fall back to nlerp
+                    const auto c = CreateRotation(0.0f, 1.0f, 0.0f, 0.2001f);
+
+                    AreNear(Math::Nlerp(a, c, 0.5f), Math::Slerp(a, c, 0.5f));
+                }
+            };
+        }
+    }
+}
@@ -0,0 +1,311 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+#include <GLTFSDK/BufferBuilder.h>
+#include <GLTFSDK/GLTF.h>
+#include <GLTFSDK/GLTFResourceReader.h>
+#include <GLTFSDK/GLTFResourceWriter.h>
+#include <GLTFSDK/MeshOptimizationUtils.h>
+#include <GLTFSDK/MeshPrimitiveUtils.h>
+
+#include "TestUtils.h"
+
+#include <algorithm>
+#include <array>
+
+using namespace glTF::UnitTest;
+
+namespace
+{
+    using namespace Microsoft::glTF;
+
+    // Returns the triangles in a canonical form (each rotated so its smallest index comes first, and sorted) so
+    // that triangle lists can be compared irrespective of order while still validating the winding order
+    std::vector<std::array<uint32_t, 3>> GetCanonicalTriangles(const std::vector<uint32_t>& indices)
+    {
+        std::vector<std::array<uint32_t, 3>> triangles;
+
+        for (size_t i = 0U; i < indices.size(); i += 3U)
+        {
+            std::array<uint32_t, 3> triangle = { indices[i], indices[i + 1U], indices[i + 2U] };
+            std::rotate(triangle.begin(), std::min_element(triangle.begin(), triangle.end()), triangle.end());
+            triangles.push_back(triangle);
+        }
+
+        std::sort(triangles.begin(), triangles.end());
+
+        return triangles;
+    }
+
+    // Two non-indexed quads (each as two triangles) with duplicated corner vertices. The second quad's normals face the
+    // opposite direction so its vertices are never merged with the first quad's.
+    MeshPrimitive AddDuplicatedQuads(BufferBuilder& bufferBuilder, float offset)
+    {
+        std::vector<float> positions;
+        std::vector<float> normals;
+
+        for (size_t quad = 0U; quad < 2U; ++quad)
+        {
+            const float corners[6][2] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 0.0f, 1.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
+
+            for (size_t i = 0U; i < 6U; ++i)
+            {
+                // The duplicate of each corner is perturbed by the offset
+                const float z = (i >= 3U) ? offset : 0.0f;
+
+                positions.insert(positions.end(), { corners[i][0], corners[i][1], z + static_cast<float>(quad) });
+                normals.insert(normals.end(), { 0.0f, 0.0f, quad == 0U ? 1.0f : -1.0f });
+            }
+        }
+
+        MeshPrimitive meshPrimitive;
+
+        bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+        meshPrimitive.attributes[ACCESSOR_POSITION] = bufferBuilder.AddAccessor(positions, { TYPE_VEC3, COMPONENT_FLOAT }).id;
+
+        bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+        meshPrimitive.attributes[ACCESSOR_NORMAL] = bufferBuilder.AddAccessor(normals, { TYPE_VEC3, COMPONENT_FLOAT }).id;
+
+        return meshPrimitive;
+    }
+}
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Test
+        {
+            GLTFSDK_TEST_CLASS(MeshOptimizationUtilsTests)
+            {
+                GLTFSDK_TEST_METHOD(MeshOptimizationUtilsTests, MeshOptimizationUtils_Test_OptimizeVertexCache)
+                {
+                    std::vector<uint32_t> indices;
+                    std::vector<float> positions;
+
+                    GenerateGrid(32U, indices, positions);
+                    ScatterTriangles(indices);
+
+                    const size_t vertexCount = positions.size() / 3U;
+                    const auto optimized = MeshOptimizationUtils::OptimizeVertexCache(indices, vertexCount);
+
+                    Assert::IsTrue(GetCanonicalTriangles(indices) == GetCanonicalTriangles(optimized));
+
+                    const float acmrBefore = MeshOptimizationUtils::ComputeACMR(indices, vertexCount);
+                    const float acmrAfter = MeshOptimizationUtils::ComputeACMR(optimized, vertexCount);
+
+                    Assert::IsTrue(acmrBefore > 2.0f);
+                    Assert::IsTrue(acmrAfter < 1.0f);
+
+                    // Reordering for overdraw mustn't lose triangles or significantly degrade the vertex cache efficiency
+                    const auto overdrawOptimized = MeshOptimizationUtils::OptimizeOverdraw(optimized, positions);
+
+                    Assert::IsTrue(GetCanonicalTriangles(indices) == GetCanonicalTriangles(overdrawOptimized));
+                    Assert::IsTrue(MeshOptimizationUtils::ComputeACMR(overdrawOptimized, vertexCount) < 1.1f);
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        MeshOptimizationUtils::OptimizeVertexCache(indices, vertexCount - 1U);
+                    });
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        MeshOptimizationUtils::OptimizeVertexCache({ 0U, 1U }, vertexCount);
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(MeshOptimizationUtilsTests, MeshOptimizationUtils_Test_OptimizeVertexFetch)
+                {
+                    // Vertex 1 is unreferenced
+                    std::vector<uint32_t> indices = { 4U, 2U, 0U, 0U, 2U, 3U };
+
+                    const auto remap = MeshOptimizationUtils::OptimizeVertexFetch(indices, 5U);
+
+                    AreEqual(std::vector<uint32_t>({ 0U, 1U, 2U, 2U, 1U, 3U }), indices);
+                    AreEqual(std::vector<uint32_t>({ 2U, MeshOptimizationUtils::RemovedVertex, 1U, 3U, 0U }), remap);
+                }
+
+                GLTFSDK_TEST_METHOD(MeshOptimizationUtilsTests, MeshOptimizationUtils_Test_OptimizeMeshPrimitive)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+
+                    std::vector<uint32_t> indices;
+                    std::vector<float> positions;
+
+                    GenerateGrid(8U, indices, positions);
+                    ScatterTriangles(indices);
+
+                    const size_t vertexCount = positions.size() / 3U;
+
+                    // Texture coordinates stored as unsigned shorts exercise the padding of narrow elements
+                    std::vector<uint16_t> texCoords;
+                    std::vector<float> targetPositions;
+
+                    for (size_t i = 0U; i < vertexCount; ++i)
+                    {
+                        texCoords.push_back(static_cast<uint16_t>(i));
+                        texCoords.push_back(static_cast<uint16_t>(i * 2U));
+
+                        targetPositions.push_back(0.0f);
+                        targetPositions.push_back(0.0f);
+                        targetPositions.push_back(static_cast<float>(i));
+                    }
+
+                    MeshPrimitive meshPrimitive;
+
+                    bufferBuilder.AddBufferView(BufferViewTarget::ELEMENT_ARRAY_BUFFER);
+                    meshPrimitive.indicesAccessorId = bufferBuilder.AddAccessor(indices, { TYPE_SCALAR, COMPONENT_UNSIGNED_INT }).id;
+
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+                    meshPrimitive.attributes[ACCESSOR_POSITION] = bufferBuilder.AddAccessor(positions, { TYPE_VEC3, COMPONENT_FLOAT, false, { 0.0f, 0.0f, 0.0f }, { 8.0f, 8.0f, 0.0f } }).id;
+
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+                    meshPrimitive.attributes[ACCESSOR_TEXCOORD_0] = bufferBuilder.AddAccessor(texCoords, { TYPE_VEC2, COMPONENT_UNSIGNED_SHORT, true }).id;
+
+                    MorphTarget morphTarget;
+
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+                    morphTarget.positionsAccessorId = bufferBuilder.AddAccessor(targetPositions, { TYPE_VEC3, COMPONENT_FLOAT, false, { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 80.0f } }).id;
+
+                    meshPrimitive.targets.push_back(morphTarget);
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    GLTFResourceReader reader(readerWriter);
+
+                    // The optimized mesh primitive only references accessors written by the new BufferBuilder
+                    auto optimizedBufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+                    optimizedBufferBuilder.AddBuffer("optimized");
+
+                    auto optimizedPrimitive = meshPrimitive;
+                    MeshOptimizationUtils::OptimizeMeshPrimitive(doc, reader, optimizedPrimitive, optimizedBufferBuilder);
+
+                    Document optimizedDoc;
+                    optimizedBufferBuilder.Output(optimizedDoc);
+
+                    const auto optimizedIndices = MeshPrimitiveUtils::GetTriangulatedIndices32(optimizedDoc, reader, optimizedPrimitive);
+                    const auto optimizedPositions = MeshPrimitiveUtils::GetPositions(optimizedDoc, reader, optimizedPrimitive);
+                    const auto optimizedTargetPositions = MeshPrimitiveUtils::GetPositions(optimizedDoc, reader, optimizedPrimitive.targets[0]);
+
+                    const auto& texCoordAccessor = optimizedDoc.accessors.Get(optimizedPrimitive.GetAttributeAccessorId(ACCESSOR_TEXCOORD_0));
+                    const auto optimizedTexCoords = reader.ReadBinaryData<uint16_t>(optimizedDoc, texCoordAccessor);
+
+                    Assert::AreEqual(vertexCount, optimizedPositions.size() / 3U);
+                    Assert::AreEqual(indices.size(), optimizedIndices.size());
+                    Assert::IsTrue(texCoordAccessor.normalized);
+                    Assert::IsTrue(MeshOptimizationUtils::ComputeACMR(optimizedIndices, vertexCount) < MeshOptimizationUtils::ComputeACMR(indices, vertexCount));
+
+                    // Each vertex's attributes must have moved together, the original vertex index is recoverable from the morph target
+                    std::vector<uint32_t> originalIndices;
+
+                    for (size_t i = 0U; i < vertexCount; ++i)
+                    {
+                        const uint32_t original = static_cast<uint32_t>(optimizedTargetPositions[i * 3U + 2U]);
+
+                        Assert::AreEqual(positions[original * 3U], optimizedPositions[i * 3U]);
+                        Assert::AreEqual(positions[original * 3U + 1U], optimizedPositions[i * 3U + 1U]);
+                        Assert::AreEqual(texCoords[original * 2U], optimizedTexCoords[i * 2U]);
+                        Assert::AreEqual(texCoords[original * 2U + 1U], optimizedTexCoords[i * 2U + 1U]);
+
+                        originalIndices.push_back(original);
+                    }
+
+                    std::vector<uint32_t> restoredIndices;
+
+                    for (auto index : optimizedIndices)
+                    {
+                        restoredIndices.push_back(originalIndices[index]);
+                    }
+
+                    Assert::IsTrue(GetCanonicalTriangles(indices) == GetCanonicalTriangles(restoredIndices));
+
+                    // Min and max values are recomputed
+                    const auto& targetAccessor = optimizedDoc.accessors.Get(optimizedPrimitive.targets[0].positionsAccessorId);
+
+                    AreEqual(std::vector<float>({ 0.0f, 0.0f, 0.0f }), targetAccessor.min);
+                    AreEqual(std::vector<float>({ 0.0f, 0.0f, 80.0f }), targetAccessor.max);
+                }
+
+                GLTFSDK_TEST_METHOD(MeshOptimizationUtilsTests, MeshOptimizationUtils_Test_WeldVertices)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+
+                    Mesh mesh;
+                    mesh.primitives.push_back(AddDuplicatedQuads(bufferBuilder, 0.0f));
+                    mesh.primitives.push_back(AddDuplicatedQuads(bufferBuilder, 0.0001f));
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    GLTFResourceReader reader(readerWriter);
+
+                    // Exact comparison only merges the first primitive's duplicates
+                    AreEqual(std::vector<uint32_t>({ 0U, 1U, 2U, 1U, 3U, 2U, 4U, 5U, 6U, 5U, 7U, 6U }), MeshOptimizationUtils::GenerateVertexRemap(doc, reader, mesh.primitives[0]));
+                    AreEqual(std::vector<uint32_t>({ 0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 9U, 10U, 11U }), MeshOptimizationUtils::GenerateVertexRemap(doc, reader, mesh.primitives[1]));
+
+                    auto weldedBufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+                    weldedBufferBuilder.AddBuffer("welded");
+
+                    Mesh weldedMesh = mesh;
+
+                    Assert::AreEqual<size_t>(20U, MeshOptimizationUtils::WeldVertices(doc, reader, weldedMesh, weldedBufferBuilder, 0.0f));
+                    Assert::AreEqual<size_t>(8U, MeshOptimizationUtils::WeldVertices(doc, reader, mesh.primitives[1], weldedBufferBuilder, 0.001f));
+
+                    Document weldedDoc;
+                    weldedBufferBuilder.Output(weldedDoc);
+
+                    const auto& primitive = weldedMesh.primitives[0];
+
+                    AreEqual(std::vector<uint32_t>({ 0U, 1U, 2U, 1U, 3U, 2U, 4U, 5U, 6U, 5U, 7U, 6U }), MeshPrimitiveUtils::GetIndices32(weldedDoc, reader, primitive));
+                    AreEqual(std::vector<float>({ 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+                                                  0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f }), MeshPrimitiveUtils::GetPositions(weldedDoc, reader, primitive));
+                    AreEqual(std::vector<float>({ 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+                                                  0.0f, 0.0f, -1.0f, 0.0f, 0.0f, -1.0f, 0.0f, 0.0f, -1.0f, 0.0f, 0.0f, -1.0f }), MeshPrimitiveUtils::GetNormals(weldedDoc, reader, primitive));
+
+                    // With an epsilon the perturbed duplicates are merged, each taking the first vertex's values
+                    AreNear(MeshPrimitiveUtils::GetPositions(weldedDoc, reader, primitive), MeshPrimitiveUtils::GetPositions(weldedDoc, reader, mesh.primitives[1]), 0.001f);
+
+                    AreEqual(std::vector<uint32_t>({ 0U, 1U, 2U, 1U, 3U, 2U, 4U, 5U, 6U, 5U, 7U, 6U }), MeshPrimitiveUtils::GetIndices32(weldedDoc, reader, mesh.primitives[1]));
+                }
+
+                GLTFSDK_TEST_METHOD(MeshOptimizationUtilsTests, MeshOptimizationUtils_Test_WeldVertices_FirstVertexValues)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+
+                    const float offset = 0.0001f;
+                    MeshPrimitive meshPrimitive = AddDuplicatedQuads(bufferBuilder, offset);
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    GLTFResourceReader reader(readerWriter);
+
+                    auto weldedBufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+                    weldedBufferBuilder.AddBuffer("welded");
+
+                    Assert::AreEqual<size_t>(8U, MeshOptimizationUtils::WeldVertices(doc, reader, meshPrimitive, weldedBufferBuilder, 0.001f));
+
+                    Document weldedDoc;
+                    weldedBufferBuilder.Output(weldedDoc);
+
+                    // The perturbed duplicates of corners 1 & 2 are merged into the vertices that came first, so keep their (unperturbed)
+                    // values. Corner 3 only appears after the perturbation so keeps the offset.
+                    AreEqual(std::vector<float>({ 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 1.0f, 1.0f, offset,
+                                                  0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 1.0f, 1.0f, offset + 1.0f }), MeshPrimitiveUtils::GetPositions(weldedDoc, reader, meshPrimitive));
+                }
+            };
+        }
+    }
+}
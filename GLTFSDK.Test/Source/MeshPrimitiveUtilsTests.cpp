@@ -12,6 +12,8 @@
 
 #include "TestUtils.h"
 
+#include <numeric>
+
 using namespace glTF::UnitTest;
 
 namespace Microsoft
@@ -1709,6 +1711,340 @@ namespace Microsoft
 
                     AreEqual(outputIndices, indices);
                 }
+
+                GLTFSDK_TEST_METHOD(MeshPrimitiveUtilsTests, MeshPrimitiveUtils_Test_StridedSpan_Interleaved)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+
+                    std::vector<float> positions = {
+                        0.0f, 0.0f, 0.0f,
+                        1.0f, 0.0f, 0.0f,
+                        0.0f, 1.0f, 0.0f,
+                        1.0f, 1.0f, 0.0f,
+                        2.0f, 0.0f, 0.0f
+                    };
+
+                    std::vector<uint8_t> colors = {
+                        255U, 0U, 0U, 255U,
+                        0U, 255U, 0U, 128U,
+                        0U, 0U, 255U, 64U,
+                        255U, 255U, 0U, 32U,
+                        0U, 255U, 255U, 0U
+                    };
+
+                    MeshPrimitive meshPrimitive;
+                    meshPrimitive.attributes[ACCESSOR_POSITION] = bufferBuilder.AddAccessor(positions, { TYPE_VEC3, COMPONENT_FLOAT }).id;
+                    meshPrimitive.attributes[ACCESSOR_COLOR_0] = bufferBuilder.AddAccessor(colors, { TYPE_VEC4, COMPONENT_UNSIGNED_BYTE, true }).id;
+                    meshPrimitive.mode = MESH_TRIANGLE_STRIP;
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    GLTFResourceReader reader(readerWriter);
+
+                    struct Vertex
+                    {
+                        float position[3];
+                        uint32_t color;
+                        uint32_t padding;
+                    };
+
+                    // The padding member ensures that the strided writes don't touch memory outside each attribute's own members
+                    std::vector<Vertex> vertices(5U, { { -1.0f, -1.0f, -1.0f }, 0U, 0xDEADBEEF });
+
+                    MeshPrimitiveUtils::GetPositions(doc, reader, meshPrimitive, StridedSpan<float>(vertices[0].position, vertices.size(), sizeof(Vertex)));
+                    MeshPrimitiveUtils::GetColors_0(doc, reader, meshPrimitive, StridedSpan<uint32_t>(&vertices[0].color, vertices.size(), sizeof(Vertex)));
+
+                    const auto expectedColors = MeshPrimitiveUtils::GetColors_0(doc, reader, meshPrimitive);
+
+                    for (size_t i = 0; i < vertices.size(); ++i)
+                    {
+                        Assert::AreEqual(positions[i * 3], vertices[i].position[0]);
+                        Assert::AreEqual(positions[i * 3 + 1], vertices[i].position[1]);
+                        Assert::AreEqual(positions[i * 3 + 2], vertices[i].position[2]);
+                        Assert::AreEqual(expectedColors[i], vertices[i].color);
+                        Assert::AreEqual(0xDEADBEEF, vertices[i].padding);
+                    }
+
+                    // Triangulated indices can be written directly to a caller-provided buffer of the reported size
+                    std::vector<uint32_t> indices(MeshPrimitiveUtils::GetTriangulatedIndexCount(doc, meshPrimitive));
+                    MeshPrimitiveUtils::GetTriangulatedIndices32(doc, reader, meshPrimitive, StridedSpan<uint32_t>(indices.data(), indices.size()));
+
+                    AreEqual(MeshPrimitiveUtils::GetTriangulatedIndices32(doc, reader, meshPrimitive), indices);
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        MeshPrimitiveUtils::GetTriangulatedIndices32(doc, reader, meshPrimitive, StridedSpan<uint32_t>(indices.data(), indices.size() - 1U));
+                    });
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        MeshPrimitiveUtils::GetPositions(doc, reader, meshPrimitive, StridedSpan<float>(vertices[0].position, vertices.size() - 1U, sizeof(Vertex)));
+                    });
+
+                    // A byte stride smaller than an output element (three floats) would cause consecutive elements to overlap
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        MeshPrimitiveUtils::GetPositions(doc, reader, meshPrimitive, StridedSpan<float>(vertices[0].position, vertices.size(), sizeof(float)));
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(MeshPrimitiveUtilsTests, MeshPrimitiveUtils_Test_NarrowIndices)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+
+                    std::vector<uint32_t> indices(37U);
+                    std::iota(indices.begin(), indices.end(), 1000U);
+
+                    Document doc;
+                    MeshPrimitive meshPrimitive;
+
+                    {
+                        auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                        bufferBuilder.AddBuffer();
+                        bufferBuilder.AddBufferView(BufferViewTarget::ELEMENT_ARRAY_BUFFER);
+                        meshPrimitive.indicesAccessorId = bufferBuilder.AddAccessor(indices, { TYPE_SCALAR, COMPONENT_UNSIGNED_INT }).id;
+
+                        bufferBuilder.Output(doc);
+                    }
+
+                    GLTFResourceReader reader(readerWriter);
+
+                    {
+                        auto bufferBuilder = CreateBufferBuilder(doc, readerWriter);
+                        bufferBuilder.AddBufferView(BufferViewTarget::ELEMENT_ARRAY_BUFFER);
+
+                        Assert::IsTrue(MeshPrimitiveUtils::NarrowIndices(doc, reader, meshPrimitive, bufferBuilder));
+
+                        bufferBuilder.Output(doc);
+                    }
+
+                    const auto& accessor = doc.accessors.Get(meshPrimitive.indicesAccessorId);
+
+                    Assert::IsTrue(accessor.componentType == COMPONENT_UNSIGNED_SHORT);
+                    AreEqual(indices, MeshPrimitiveUtils::GetIndices32(doc, reader, meshPrimitive));
+
+                    // The indices can't be narrowed any further
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+                    Assert::IsFalse(MeshPrimitiveUtils::NarrowIndices(doc, reader, meshPrimitive, bufferBuilder));
+                }
+
+                GLTFSDK_TEST_METHOD(MeshPrimitiveUtilsTests, MeshPrimitiveUtils_Test_NarrowIndices_MaxIndex)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+
+                    // 65535 is reserved for primitive restart in uint16 indices so these indices would map to uint32
+                    const std::vector<uint16_t> indices = { 0U, 1U, 65535U };
+
+                    Document doc;
+                    MeshPrimitive meshPrimitive;
+
+                    {
+                        auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                        bufferBuilder.AddBuffer();
+                        bufferBuilder.AddBufferView(BufferViewTarget::ELEMENT_ARRAY_BUFFER);
+                        meshPrimitive.indicesAccessorId = bufferBuilder.AddAccessor(indices, { TYPE_SCALAR, COMPONENT_UNSIGNED_SHORT }).id;
+
+                        bufferBuilder.Output(doc);
+                    }
+
+                    GLTFResourceReader reader(readerWriter);
+
+                    const std::string indicesAccessorId = meshPrimitive.indicesAccessorId;
+
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+                    bufferBuilder.AddBuffer();
+                    bufferBuilder.AddBufferView(BufferViewTarget::ELEMENT_ARRAY_BUFFER);
+
+                    // The indices must never be widened
+                    Assert::IsFalse(MeshPrimitiveUtils::NarrowIndices(doc, reader, meshPrimitive, bufferBuilder));
+                    Assert::AreEqual(indicesAccessorId, meshPrimitive.indicesAccessorId);
+                    Assert::AreEqual<size_t>(0U, bufferBuilder.GetAccessorCount());
+                }
+
+                GLTFSDK_TEST_METHOD(MeshPrimitiveUtilsTests, MeshPrimitiveUtils_Test_TriangulateIndices_Large)
+                {
+                    // Enough indices that the primitives are expanded in parallel and an odd number of strip triangles
+                    std::vector<uint32_t> indices((1U << 20) + 4U);
+
+                    for (size_t i = 0; i < indices.size(); ++i)
+                    {
+                        indices[i] = static_cast<uint32_t>(i * 7U);
+                    }
+
+                    const size_t triangleCount = indices.size() - 2U;
+
+                    std::vector<uint32_t> expectedStrip;
+                    std::vector<uint32_t> expectedFan;
+                    std::vector<uint32_t> expectedLoop;
+
+                    for (size_t i = 0; i < triangleCount; ++i)
+                    {
+                        const size_t odd = i % 2;
+                        expectedStrip.insert(expectedStrip.end(), { indices[i], indices[i + 1 + odd], indices[i + 2 - odd] });
+                        expectedFan.insert(expectedFan.end(), { indices[0], indices[i + 1], indices[i + 2] });
+                    }
+
+                    for (size_t i = 0; i < indices.size(); ++i)
+                    {
+                        expectedLoop.insert(expectedLoop.end(), { indices[i], indices[(i + 1) % indices.size()] });
+                    }
+
+                    std::vector<uint32_t> output(triangleCount * 3U);
+
+                    MeshPrimitiveUtils::TriangulateIndices32(indices.data(), indices.size(), MESH_TRIANGLE_STRIP, StridedSpan<uint32_t>(output.data(), output.size()));
+                    AreEqual(expectedStrip, output);
+
+                    MeshPrimitiveUtils::TriangulateIndices32(indices.data(), indices.size(), MESH_TRIANGLE_FAN, StridedSpan<uint32_t>(output.data(), output.size()));
+                    AreEqual(expectedFan, output);
+
+                    output.resize(indices.size() * 2U);
+
+                    MeshPrimitiveUtils::SegmentIndices32(indices.data(), indices.size(), MESH_LINE_LOOP, StridedSpan<uint32_t>(output.data(), output.size()));
+                    AreEqual(expectedLoop, output);
+
+                    // Strided output (every other element)
+                    std::vector<uint32_t> strided(expectedStrip.size() * 2U);
+
+                    MeshPrimitiveUtils::TriangulateIndices32(indices.data(), indices.size(), MESH_TRIANGLE_STRIP, StridedSpan<uint32_t>(strided.data(), expectedStrip.size(), sizeof(uint32_t) * 2U));
+
+                    for (size_t i = 0; i < expectedStrip.size(); ++i)
+                    {
+                        Assert::AreEqual(expectedStrip[i], strided[i * 2U]);
+                    }
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        MeshPrimitiveUtils::TriangulateIndices32(indices.data(), indices.size(), MESH_TRIANGLE_STRIP, StridedSpan<uint32_t>(output.data(), output.size()));
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(MeshPrimitiveUtilsTests, MeshPrimitiveUtils_Test_GetTriangulatedIndices_Triangles)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    const std::vector<uint16_t> indices = { 0U, 1U, 2U, 2U, 1U, 3U };
+
+                    bufferBuilder.AddBuffer();
+                    bufferBuilder.AddBufferView(BufferViewTarget::ELEMENT_ARRAY_BUFFER);
+
+                    MeshPrimitive meshPrimitive;
+                    meshPrimitive.indicesAccessorId = bufferBuilder.AddAccessor(indices, { TYPE_SCALAR, COMPONENT_UNSIGNED_SHORT }).id;
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    GLTFResourceReader reader(readerWriter);
+
+                    AreEqual(indices, MeshPrimitiveUtils::GetTriangulatedIndices16(doc, reader, meshPrimitive));
+
+                    std::vector<uint16_t> output(indices.size());
+                    MeshPrimitiveUtils::GetTriangulatedIndices16(doc, reader, meshPrimitive, StridedSpan<uint16_t>(output.data(), output.size()));
+                    AreEqual(indices, output);
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        MeshPrimitiveUtils::GetTriangulatedIndices16(doc, reader, meshPrimitive, StridedSpan<uint16_t>(output.data(), output.size() - 1U));
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(MeshPrimitiveUtilsTests, MeshPrimitiveUtils_Test_TriangulateIndices_PrimitiveRestart)
+                {
+                    const std::vector<uint16_t> stripIndices = { 0U, 1U, 2U, 3U, 0xFFFFU, 4U, 5U, 6U, 7U };
+                    const std::vector<uint16_t> fanIndices = { 0U, 1U, 2U, 3U, 0xFFFFU, 4U, 5U, 6U };
+
+                    std::vector<uint16_t> output((stripIndices.size() - 2U) * 3U);
+
+                    auto result = MeshPrimitiveUtils::TriangulateIndices16(stripIndices.data(), stripIndices.size(), MESH_TRIANGLE_STRIP,
+                        TriangulationFlags::PrimitiveRestart, StridedSpan<uint16_t>(output.data(), output.size()));
+
+                    // The winding order of the second strip is independent of the first
+                    Assert::AreEqual<size_t>(12U, result.indexCount);
+                    Assert::AreEqual<size_t>(0U, result.removedTriangleCount);
+                    AreEqual(std::vector<uint16_t>({ 0U, 1U, 2U, 1U, 3U, 2U, 4U, 5U, 6U, 5U, 7U, 6U }), std::vector<uint16_t>(output.begin(), output.begin() + result.indexCount));
+
+                    result = MeshPrimitiveUtils::TriangulateIndices16(fanIndices.data(), fanIndices.size(), MESH_TRIANGLE_FAN,
+                        TriangulationFlags::PrimitiveRestart, StridedSpan<uint16_t>(output.data(), output.size()));
+
+                    Assert::AreEqual<size_t>(9U, result.indexCount);
+                    AreEqual(std::vector<uint16_t>({ 0U, 1U, 2U, 0U, 2U, 3U, 4U, 5U, 6U }), std::vector<uint16_t>(output.begin(), output.begin() + result.indexCount));
+                }
+
+                GLTFSDK_TEST_METHOD(MeshPrimitiveUtilsTests, MeshPrimitiveUtils_Test_TriangulateIndices_RemoveDegenerateTriangles)
+                {
+                    // Two strips stitched together with degenerate triangles
+                    const std::vector<uint32_t> indices = { 0U, 1U, 2U, 3U, 3U, 4U, 4U, 5U, 6U, 7U };
+
+                    std::vector<uint32_t> output((indices.size() - 2U) * 3U);
+
+                    const auto result = MeshPrimitiveUtils::TriangulateIndices32(indices.data(), indices.size(), MESH_TRIANGLE_STRIP,
+                        TriangulationFlags::RemoveDegenerateTriangles, StridedSpan<uint32_t>(output.data(), output.size()));
+
+                    Assert::AreEqual<size_t>(12U, result.indexCount);
+                    Assert::AreEqual<size_t>(4U, result.removedTriangleCount);
+                    AreEqual(std::vector<uint32_t>({ 0U, 1U, 2U, 1U, 3U, 2U, 4U, 5U, 6U, 5U, 7U, 6U }), std::vector<uint32_t>(output.begin(), output.begin() + result.indexCount));
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        MeshPrimitiveUtils::TriangulateIndices32(indices.data(), indices.size(), MESH_TRIANGLE_STRIP,
+                            TriangulationFlags::RemoveZeroAreaTriangles, StridedSpan<uint32_t>(output.data(), output.size()));
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(MeshPrimitiveUtilsTests, MeshPrimitiveUtils_Test_GetTriangulatedIndices_RemoveZeroAreaTriangles)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+
+                    // The last three positions are collinear
+                    std::vector<float> positions = {
+                        0.0f, 0.0f, 0.0f,
+                        1.0f, 0.0f, 0.0f,
+                        0.0f, 1.0f, 0.0f,
+                        2.0f, -1.0f, 0.0f
+                    };
+                    auto positionsAccessor = bufferBuilder.AddAccessor(positions, { TYPE_VEC3, COMPONENT_FLOAT });
+
+                    // Unsigned byte indices use a primitive restart value of 0xFF
+                    std::vector<uint8_t> indices = {
+                        0U, 1U, 2U, 0xFFU, 1U, 2U, 3U
+                    };
+                    auto indicesAccessor = bufferBuilder.AddAccessor(indices, { TYPE_SCALAR, COMPONENT_UNSIGNED_BYTE });
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    MeshPrimitive meshPrimitive;
+                    meshPrimitive.indicesAccessorId = indicesAccessor.id;
+                    meshPrimitive.attributes[ACCESSOR_POSITION] = positionsAccessor.id;
+                    meshPrimitive.mode = MESH_TRIANGLE_STRIP;
+
+                    GLTFResourceReader reader(readerWriter);
+
+                    size_t removedTriangleCount = 0U;
+
+                    auto output = MeshPrimitiveUtils::GetTriangulatedIndices32(doc, reader, meshPrimitive,
+                        TriangulationFlags::PrimitiveRestart | TriangulationFlags::RemoveZeroAreaTriangles, &removedTriangleCount);
+
+                    AreEqual(std::vector<uint32_t>({ 0U, 1U, 2U }), output);
+                    Assert::AreEqual<size_t>(1U, removedTriangleCount);
+
+                    // Without primitive restart the restart value is out of range of the vertex positions
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        MeshPrimitiveUtils::GetTriangulatedIndices16(doc, reader, meshPrimitive, TriangulationFlags::RemoveZeroAreaTriangles);
+                    });
+                }
             };
         }
     }
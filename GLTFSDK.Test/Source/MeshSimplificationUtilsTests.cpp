@@ -0,0 +1,207 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+#include <GLTFSDK/BufferBuilder.h>
+#include <GLTFSDK/Deserialize.h>
+#include <GLTFSDK/ExtensionsMSFT.h>
+#include <GLTFSDK/GLTF.h>
+#include <GLTFSDK/GLTFResourceReader.h>
+#include <GLTFSDK/GLTFResourceWriter.h>
+#include <GLTFSDK/MeshPrimitiveUtils.h>
+#include <GLTFSDK/MeshSimplificationUtils.h>
+#include <GLTFSDK/Serialize.h>
+
+#include "TestUtils.h"
+
+#include <cmath>
+
+using namespace glTF::UnitTest;
+
+namespace
+{
+    using namespace Microsoft::glTF;
+
+    float GetTriangleNormalZ(const std::vector<uint32_t>& indices, const std::vector<float>& positions, size_t triangle)
+    {
+        const float* p0 = positions.data() + indices[triangle * 3U] * 3U;
+        const float* p1 = positions.data() + indices[triangle * 3U + 1U] * 3U;
+        const float* p2 = positions.data() + indices[triangle * 3U + 2U] * 3U;
+
+        return (p1[0] - p0[0]) * (p2[1] - p0[1]) - (p1[1] - p0[1]) * (p2[0] - p0[0]);
+    }
+}
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Test
+        {
+            GLTFSDK_TEST_CLASS(MeshSimplificationUtilsTests)
+            {
+                GLTFSDK_TEST_METHOD(MeshSimplificationUtilsTests, MeshSimplificationUtils_Test_SimplifyIndices)
+                {
+                    std::vector<uint32_t> indices;
+                    std::vector<float> positions;
+
+                    GenerateGrid(16U, indices, positions);
+
+                    const size_t targetIndexCount = indices.size() / 4U;
+
+                    float error = 1.0f;
+                    const auto simplified = MeshSimplificationUtils::SimplifyIndices(indices, positions, targetIndexCount, 0.001f, &error);
+
+                    Assert::IsTrue(simplified.size() <= targetIndexCount);
+                    Assert::IsTrue(simplified.size() > 0U);
+                    Assert::IsTrue(error < 0.0001f);
+
+                    float area = 0.0f;
+
+                    for (size_t i = 0U; i < simplified.size() / 3U; ++i)
+                    {
+                        // No triangles are flipped
+                        const float normalZ = GetTriangleNormalZ(simplified, positions, i);
+
+                        Assert::IsTrue(normalZ > 0.0f);
+                        area += normalZ * 0.5f;
+                    }
+
+                    // The border (and so the area) is preserved
+                    Assert::AreEqual(256.0f, area);
+                }
+
+                GLTFSDK_TEST_METHOD(MeshSimplificationUtilsTests, MeshSimplificationUtils_Test_SimplifyIndices_Seam)
+                {
+                    std::vector<uint32_t> indices;
+                    std::vector<float> positions;
+
+                    GenerateGrid(16U, indices, positions, nullptr, 8U);
+
+                    const uint32_t seamOffset = 17U * 17U;
+                    const auto simplified = MeshSimplificationUtils::SimplifyIndices(indices, positions, indices.size() / 4U, 0.001f);
+
+                    Assert::IsTrue(simplified.size() <= indices.size() / 4U);
+
+                    for (size_t i = 0U; i < simplified.size(); i += 3U)
+                    {
+                        // Each triangle's vertices remain on the same side of the seam
+                        const bool isRight = simplified[i] >= seamOffset;
+
+                        Assert::AreEqual(isRight, simplified[i + 1U] >= seamOffset);
+                        Assert::AreEqual(isRight, simplified[i + 2U] >= seamOffset);
+
+                        const float centroidX = (positions[simplified[i] * 3U] + positions[simplified[i + 1U] * 3U] + positions[simplified[i + 2U] * 3U]) / 3.0f;
+
+                        Assert::AreEqual(isRight, centroidX > 8.0f);
+                    }
+                }
+
+                GLTFSDK_TEST_METHOD(MeshSimplificationUtilsTests, MeshSimplificationUtils_Test_SimplifyIndices_TargetError)
+                {
+                    std::vector<uint32_t> indices;
+                    std::vector<float> positions;
+
+                    GenerateGrid(16U, indices, positions, [](float x, float y) { return std::sin(x) * std::cos(y); });
+
+                    float error = 1.0f;
+                    const auto simplified = MeshSimplificationUtils::SimplifyIndices(indices, positions, 0U, 0.01f, &error);
+
+                    // Simplification stops before the target index count is reached
+                    Assert::IsTrue(simplified.size() > 0U);
+                    Assert::IsTrue(simplified.size() < indices.size());
+                    Assert::IsTrue(error <= 0.01f);
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        MeshSimplificationUtils::SimplifyIndices({ 0U, 1U }, positions, 0U);
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(MeshSimplificationUtilsTests, MeshSimplificationUtils_Test_AddNodeLods)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+
+                    std::vector<uint32_t> indices;
+                    std::vector<float> positions;
+
+                    GenerateGrid(16U, indices, positions);
+
+                    Document doc;
+                    MeshPrimitive meshPrimitive;
+
+                    {
+                        auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                        bufferBuilder.AddBuffer();
+
+                        bufferBuilder.AddBufferView(BufferViewTarget::ELEMENT_ARRAY_BUFFER);
+                        meshPrimitive.indicesAccessorId = bufferBuilder.AddAccessor(indices, { TYPE_SCALAR, COMPONENT_UNSIGNED_INT }).id;
+
+                        bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+                        meshPrimitive.attributes[ACCESSOR_POSITION] = bufferBuilder.AddAccessor(positions, { TYPE_VEC3, COMPONENT_FLOAT, false, { 0.0f, 0.0f, 0.0f }, { 16.0f, 16.0f, 0.0f } }).id;
+
+                        bufferBuilder.Output(doc);
+                    }
+
+                    Mesh mesh;
+                    mesh.name = "grid";
+                    mesh.primitives.push_back(meshPrimitive);
+
+                    Node node;
+                    node.name = "grid";
+                    node.meshId = doc.meshes.Append(std::move(mesh), AppendIdPolicy::GenerateOnEmpty).id;
+                    node.translation = Vector3(1.0f, 2.0f, 3.0f);
+
+                    const auto nodeId = doc.nodes.Append(std::move(node), AppendIdPolicy::GenerateOnEmpty).id;
+
+                    Scene scene;
+                    scene.nodes.push_back(nodeId);
+                    doc.SetDefaultScene(std::move(scene), AppendIdPolicy::GenerateOnEmpty);
+
+                    GLTFResourceReader reader(readerWriter);
+
+                    {
+                        auto bufferBuilder = CreateBufferBuilder(doc, readerWriter);
+
+                        const auto lodIds = MeshSimplificationUtils::AddNodeLods(doc, reader, nodeId, { 0.25f, 0.5f }, bufferBuilder);
+
+                        Assert::AreEqual<size_t>(2U, lodIds.size());
+                        AreEqual(lodIds, doc.nodes[nodeId].GetExtension<MSFT::Lod>().ids);
+
+                        bufferBuilder.Output(doc);
+                    }
+
+                    Assert::AreEqual<size_t>(3U, doc.meshes.Size());
+                    Assert::AreEqual<size_t>(3U, doc.nodes.Size());
+                    Assert::IsTrue(doc.extensionsUsed.count(MSFT::LOD_NAME) == 1U);
+
+                    const auto& lodIds = doc.nodes[nodeId].GetExtension<MSFT::Lod>().ids;
+
+                    size_t previousIndexCount = indices.size();
+
+                    for (size_t i = 0U; i < lodIds.size(); ++i)
+                    {
+                        const auto& lodNode = doc.nodes[lodIds[i]];
+                        const auto& lodPrimitive = doc.meshes[lodNode.meshId].primitives[0];
+
+                        Assert::AreEqual(std::string("grid_lod") + std::to_string(i + 1U), lodNode.name);
+                        Assert::IsTrue(lodNode.translation == Vector3(1.0f, 2.0f, 3.0f));
+                        Assert::AreEqual(meshPrimitive.GetAttributeAccessorId(ACCESSOR_POSITION), lodPrimitive.GetAttributeAccessorId(ACCESSOR_POSITION));
+
+                        const size_t indexCount = MeshPrimitiveUtils::GetIndices32(doc, reader, lodPrimitive).size();
+
+                        Assert::IsTrue(indexCount < previousIndexCount);
+                        previousIndexCount = indexCount;
+                    }
+
+                    const auto json = Serialize(doc, MSFT::GetMSFTExtensionSerializer());
+                    const auto outputDoc = Deserialize(json, MSFT::GetMSFTExtensionDeserializer());
+
+                    Assert::IsTrue(doc == outputDoc);
+                }
+            };
+        }
+    }
+}
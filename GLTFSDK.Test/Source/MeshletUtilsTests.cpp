@@ -0,0 +1,167 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+#include <GLTFSDK/BufferBuilder.h>
+#include <GLTFSDK/Deserialize.h>
+#include <GLTFSDK/GLTF.h>
+#include <GLTFSDK/GLTFResourceReader.h>
+#include <GLTFSDK/GLTFResourceWriter.h>
+#include <GLTFSDK/MeshletUtils.h>
+#include <GLTFSDK/Serialize.h>
+
+#include "TestUtils.h"
+
+#include <cmath>
+#include <cstring>
+
+using namespace glTF::UnitTest;
+
+namespace
+{
+    using namespace Microsoft::glTF;
+
+    void ValidateMeshlets(const MeshletUtils::MeshletData& meshletData, const std::vector<uint32_t>& indices, const std::vector<float>& positions, size_t maxVertices, size_t maxTriangles)
+    {
+        Assert::AreEqual(meshletData.meshlets.size(), meshletData.bounds.size());
+
+        std::vector<uint32_t> restoredIndices;
+
+        for (size_t i = 0U; i < meshletData.meshlets.size(); ++i)
+        {
+            const auto& meshlet = meshletData.meshlets[i];
+            const auto& bounds = meshletData.bounds[i];
+
+            Assert::IsTrue(meshlet.vertexCount <= maxVertices);
+            Assert::IsTrue(meshlet.triangleCount <= maxTriangles);
+
+            for (size_t j = 0U; j < meshlet.triangleCount * 3U; ++j)
+            {
+                const uint8_t localIndex = meshletData.triangles[meshlet.triangleOffset * 3U + j];
+
+                Assert::IsTrue(localIndex < meshlet.vertexCount);
+                restoredIndices.push_back(meshletData.vertices[meshlet.vertexOffset + localIndex]);
+            }
+
+            for (size_t j = 0U; j < meshlet.vertexCount; ++j)
+            {
+                const float* p = positions.data() + meshletData.vertices[meshlet.vertexOffset + j] * 3U;
+
+                const float dx = p[0] - bounds.center[0];
+                const float dy = p[1] - bounds.center[1];
+                const float dz = p[2] - bounds.center[2];
+
+                Assert::IsTrue(std::sqrt(dx * dx + dy * dy + dz * dz) <= bounds.radius * 1.0001f);
+            }
+
+            // All of the grid's triangles face +z
+            Assert::AreEqual(0.0f, bounds.coneAxis[0]);
+            Assert::AreEqual(0.0f, bounds.coneAxis[1]);
+            Assert::AreEqual(1.0f, bounds.coneAxis[2]);
+            Assert::AreEqual(1.0f, bounds.coneCutoff);
+        }
+
+        // The triangles, including their winding order, are unchanged
+        Assert::IsTrue(indices == restoredIndices);
+    }
+}
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Test
+        {
+            GLTFSDK_TEST_CLASS(MeshletUtilsTests)
+            {
+                GLTFSDK_TEST_METHOD(MeshletUtilsTests, MeshletUtils_Test_BuildMeshlets)
+                {
+                    std::vector<uint32_t> indices;
+                    std::vector<float> positions;
+
+                    GenerateGrid(16U, indices, positions);
+
+                    // Limited by vertex count
+                    const auto meshletData = MeshletUtils::BuildMeshlets(indices, positions);
+
+                    ValidateMeshlets(meshletData, indices, positions, MeshletUtils::DefaultMaxVertices, MeshletUtils::DefaultMaxTriangles);
+                    Assert::IsTrue(meshletData.meshlets.size() > 1U);
+
+                    // Limited by triangle count
+                    ValidateMeshlets(MeshletUtils::BuildMeshlets(indices, positions, 256U, 10U), indices, positions, 256U, 10U);
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        MeshletUtils::BuildMeshlets(indices, positions, MeshletUtils::MaxVertexLimit + 1U);
+                    });
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        MeshletUtils::BuildMeshlets(indices, std::vector<float>(positions.begin(), positions.begin() + 9U));
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(MeshletUtilsTests, MeshletUtils_Test_AddMeshlets_RoundTrip)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+
+                    std::vector<uint32_t> indices;
+                    std::vector<float> positions;
+
+                    GenerateGrid(8U, indices, positions);
+
+                    MeshPrimitive meshPrimitive;
+
+                    bufferBuilder.AddBufferView(BufferViewTarget::ELEMENT_ARRAY_BUFFER);
+                    meshPrimitive.indicesAccessorId = bufferBuilder.AddAccessor(indices, { TYPE_SCALAR, COMPONENT_UNSIGNED_INT }).id;
+
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+                    meshPrimitive.attributes[ACCESSOR_POSITION] = bufferBuilder.AddAccessor(positions, { TYPE_VEC3, COMPONENT_FLOAT, false, { 0.0f, 0.0f, 0.0f }, { 8.0f, 8.0f, 0.0f } }).id;
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    GLTFResourceReader reader(readerWriter);
+
+                    auto meshletBufferBuilder = CreateBufferBuilder(doc, readerWriter);
+
+                    MeshletUtils::AddMeshlets(doc, reader, meshPrimitive, meshletBufferBuilder, 32U, 32U);
+
+                    Mesh mesh;
+                    mesh.primitives.push_back(meshPrimitive);
+
+                    doc.meshes.Append(std::move(mesh), AppendIdPolicy::GenerateOnEmpty);
+                    meshletBufferBuilder.Output(doc);
+
+                    MeshletUtils::AddExtension(doc);
+
+                    const auto& meshlets = doc.meshes[0].primitives[0].GetExtension<MSFT::MeshPrimitives::Meshlets>();
+
+                    Assert::AreEqual<size_t>(32U, meshlets.maxVertices);
+                    Assert::AreEqual<size_t>(32U, meshlets.maxTriangles);
+
+                    const auto expected = MeshletUtils::BuildMeshlets(indices, positions, 32U, 32U);
+                    const auto actual = MeshletUtils::GetMeshlets(doc, reader, meshlets);
+
+                    ValidateMeshlets(actual, indices, positions, 32U, 32U);
+
+                    Assert::AreEqual(expected.meshlets.size(), actual.meshlets.size());
+                    Assert::IsTrue(std::memcmp(expected.meshlets.data(), actual.meshlets.data(), expected.meshlets.size() * sizeof(MeshletUtils::Meshlet)) == 0);
+                    Assert::IsTrue(std::memcmp(expected.bounds.data(), actual.bounds.data(), expected.bounds.size() * sizeof(MeshletUtils::MeshletBounds)) == 0);
+                    AreEqual(expected.vertices, actual.vertices);
+                    AreEqual(expected.triangles, actual.triangles);
+
+                    const auto json = Serialize(doc, MSFT::GetMSFTExtensionSerializer());
+                    const auto outputDoc = Deserialize(json, MSFT::GetMSFTExtensionDeserializer());
+
+                    Assert::IsTrue(doc == outputDoc);
+                    Assert::IsTrue(outputDoc.extensionsUsed.count(MSFT::MeshPrimitives::MESHLETS_NAME) == 1U);
+                }
+            };
+        }
+    }
+}
@@ -0,0 +1,157 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+#include <GLTFSDK/Exceptions.h>
+#include <GLTFSDK/ParallelUtils.h>
+
+#include <atomic>
+#include <vector>
+
+using namespace glTF::UnitTest;
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Test
+        {
+            GLTFSDK_TEST_CLASS(ParallelUtilsTests)
+            {
+                GLTFSDK_TEST_METHOD(ParallelUtilsTests, ParallelUtils_Test_ParallelFor)
+                {
+                    const size_t count = 100003U;
+
+                    std::vector<int> visits(count, 0);
+                    std::atomic<size_t> callCount(0U);
+
+                    ParallelUtils::ParallelFor(count, 1000U, [&](size_t begin, size_t end)
+                    {
+                        Assert::IsTrue(begin < end);
+                        Assert::IsTrue(end - begin >= 1000U);
+
+                        for (size_t i = begin; i < end; ++i)
+                        {
+                            visits[i]++;
+                        }
+
+                        callCount++;
+                    });
+
+                    // Every element is visited exactly once
+                    for (auto visit : visits)
+                    {
+                        Assert::AreEqual(1, visit);
+                    }
+
+                    Assert::IsTrue(callCount <= ParallelUtils::GetConcurrency());
+
+                    // Small ranges are processed by a single call
+                    callCount = 0U;
+
+                    ParallelUtils::ParallelFor(1999U, 1000U, [&](size_t begin, size_t end)
+                    {
+                        Assert::AreEqual<size_t>(0U, begin);
+                        Assert::AreEqual<size_t>(1999U, end);
+
+                        callCount++;
+                    });
+
+                    Assert::AreEqual<size_t>(1U, callCount);
+
+                    ParallelUtils::ParallelFor(0U, 1000U, [&](size_t, size_t)
+                    {
+                        callCount++;
+                    });
+
+                    Assert::AreEqual<size_t>(1U, callCount);
+                }
+
+                GLTFSDK_TEST_METHOD(ParallelUtilsTests, ParallelUtils_Test_ParallelFor_Exception)
+                {
+                    Assert::ExpectException<GLTFException>([]()
+                    {
+                        ParallelUtils::ParallelFor(1U << 20, 1U, [](size_t begin, size_t)
+                        {
+                            if (begin == 0U)
+                            {
+                                throw GLTFException("Range failed");
+                            }
+                        });
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(ParallelUtilsTests, ParallelUtils_Test_ParallelForPhases)
+                {
+                    const std::vector<size_t> counts = { 100003U, 5U, 0U, 50000U };
+
+                    std::vector<int> visits(counts[0], 0);
+                    std::vector<int> sums(counts[3], 0);
+                    std::vector<std::atomic<size_t>> phaseCounts(counts.size());
+
+                    ParallelUtils::ParallelForPhases(counts, 1000U, [&](size_t phase, size_t begin, size_t end)
+                    {
+                        Assert::IsTrue(begin < end);
+                        Assert::IsTrue(end <= counts[phase]);
+
+                        // Every sub-range of the previous phases has been processed
+                        for (size_t i = 0U; i < phase; ++i)
+                        {
+                            Assert::AreEqual<size_t>(counts[i], phaseCounts[i]);
+                        }
+
+                        for (size_t i = begin; i < end; ++i)
+                        {
+                            if (phase == 0U)
+                            {
+                                visits[i]++;
+                            }
+                            else if (phase == 3U)
+                            {
+                                // Reads elements of the first phase written by other sub-ranges
+                                sums[i] = visits[i] + visits[i + 50000U];
+                            }
+                        }
+
+                        phaseCounts[phase] += end - begin;
+                    });
+
+                    for (size_t i = 0U; i < counts.size(); ++i)
+                    {
+                        Assert::AreEqual<size_t>(counts[i], phaseCounts[i]);
+                    }
+
+                    for (auto sum : sums)
+                    {
+                        Assert::AreEqual(2, sum);
+                    }
+                }
+
+                GLTFSDK_TEST_METHOD(ParallelUtilsTests, ParallelUtils_Test_ParallelForPhases_Exception)
+                {
+                    std::atomic<size_t> lastPhaseCount(0U);
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        ParallelUtils::ParallelForPhases({ 1U << 20, 1U << 20 }, 1U, [&](size_t phase, size_t begin, size_t)
+                        {
+                            if (phase == 0U && begin == 0U)
+                            {
+                                throw GLTFException("Range failed");
+                            }
+
+                            if (phase == 1U)
+                            {
+                                lastPhaseCount++;
+                            }
+                        });
+                    });
+
+                    // No phase is started after the one that failed
+                    Assert::AreEqual<size_t>(0U, lastPhaseCount);
+                }
+            };
+        }
+    }
+}
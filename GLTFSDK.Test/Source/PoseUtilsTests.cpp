@@ -0,0 +1,209 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+#include <GLTFSDK/BufferBuilder.h>
+#include <GLTFSDK/GLTF.h>
+#include <GLTFSDK/GLTFResourceReader.h>
+#include <GLTFSDK/GLTFResourceWriter.h>
+#include <GLTFSDK/PoseUtils.h>
+
+#include "TestUtils.h"
+
+#include <cmath>
+
+using namespace glTF::UnitTest;
+
+namespace
+{
+    using namespace Microsoft::glTF;
+
+    // An arm - a shoulder with an upper arm and then a forearm as descendants. The nodes are listed children first.
+    Document CreateArm()
+    {
+        const float s = std::sqrt(0.5f);
+
+        Node forearm;
+        forearm.id = "forearm";
+        forearm.translation = Vector3(0.0f, 2.0f, 0.0f);
+
+        Node upperArm;
+        upperArm.id = "upperArm";
+        upperArm.translation = Vector3(1.0f, 0.0f, 0.0f);
+        upperArm.rotation = Quaternion(0.0f, 0.0f, s, s);
+        upperArm.children = { "forearm" };
+
+        Node shoulder;
+        shoulder.id = "shoulder";
+        shoulder.matrix.values[12] = 5.0f;
+        shoulder.children = { "upperArm" };
+
+        Document doc;
+        doc.nodes.Append(forearm);
+        doc.nodes.Append(upperArm);
+        doc.nodes.Append(shoulder);
+
+        return doc;
+    }
+}
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Test
+        {
+            GLTFSDK_TEST_CLASS(PoseUtilsTests)
+            {
+                GLTFSDK_TEST_METHOD(PoseUtilsTests, PoseUtils_Test_GetNodeHierarchy)
+                {
+                    auto doc = CreateArm();
+
+                    const auto hierarchy = PoseUtils::GetNodeHierarchy(doc);
+
+                    AreEqual(std::vector<size_t>({ 2U, 1U, 0U }), hierarchy.order);
+                    AreEqual(std::vector<size_t>({ 1U, 2U, PoseUtils::NoParent }), hierarchy.parents);
+
+                    // A second parent
+                    Node other;
+                    other.id = "other";
+                    other.children = { "forearm" };
+                    doc.nodes.Append(other);
+
+                    Assert::ExpectException<GLTFException>([&doc]() { PoseUtils::GetNodeHierarchy(doc); });
+
+                    // A cycle
+                    auto cycle = CreateArm();
+                    auto forearm = cycle.nodes["forearm"];
+                    forearm.children = { "shoulder" };
+                    cycle.nodes.Replace(forearm);
+
+                    Assert::ExpectException<GLTFException>([&cycle]() { PoseUtils::GetNodeHierarchy(cycle); });
+                }
+
+                GLTFSDK_TEST_METHOD(PoseUtilsTests, PoseUtils_Test_ComputeWorldTransforms)
+                {
+                    const auto doc = CreateArm();
+                    const auto hierarchy = PoseUtils::GetNodeHierarchy(doc);
+
+                    auto pose = PoseUtils::GetRestPose(doc);
+
+                    std::vector<Matrix4> localTransforms;
+                    std::vector<Matrix4> worldTransforms;
+
+                    PoseUtils::ComputeLocalTransforms(doc, pose, localTransforms);
+                    PoseUtils::ComputeWorldTransforms(hierarchy, localTransforms, worldTransforms);
+
+                    // The shoulder's matrix is used rather than its TRS properties
+                    Assert::IsTrue(doc.nodes["shoulder"].matrix == localTransforms[2]);
+
+                    // The upper arm is rotated a quarter turn about z so the forearm's y offset becomes -x
+                    const auto forearm = Math::TransformPoint(worldTransforms[0], Vector3::ZERO);
+
+                    Assert::IsTrue(std::abs(forearm.x - 4.0f) < 1.0e-5f);
+                    Assert::IsTrue(std::abs(forearm.y) < 1.0e-5f);
+
+                    AreNear(Math::Multiply(worldTransforms[1], localTransforms[0]), worldTransforms[0]);
+
+                    // Posing the upper arm moves the forearm with it
+                    pose.rotations[1] = Quaternion::IDENTITY;
+
+                    PoseUtils::ComputeLocalTransforms(doc, pose, localTransforms);
+                    PoseUtils::ComputeWorldTransforms(hierarchy, localTransforms, worldTransforms);
+
+                    Assert::IsTrue(Vector3(6.0f, 2.0f, 0.0f) == Math::TransformPoint(worldTransforms[0], Vector3::ZERO));
+                }
+
+                GLTFSDK_TEST_METHOD(PoseUtilsTests, PoseUtils_Test_ComputeJointPalettes)
+                {
+                    auto doc = CreateArm();
+                    const auto hierarchy = PoseUtils::GetNodeHierarchy(doc);
+
+                    std::vector<Matrix4> localTransforms;
+                    std::vector<Matrix4> restTransforms;
+
+                    PoseUtils::ComputeLocalTransforms(doc, PoseUtils::GetRestPose(doc), localTransforms);
+                    PoseUtils::ComputeWorldTransforms(hierarchy, localTransforms, restTransforms);
+
+                    // The inverse bind matrices of the upper arm and forearm are the inverses of their rest transforms, which
+                    // are both a quarter turn about z followed by a translation
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+                    bufferBuilder.AddBufferView(BufferViewTarget::UNKNOWN_BUFFER);
+
+                    std::vector<float> inverseBindMatrices;
+
+                    for (size_t joint : { 1U, 0U })
+                    {
+                        const auto& rest = restTransforms[joint].values;
+
+                        const float x = rest[12];
+                        const float y = rest[13];
+
+                        inverseBindMatrices.insert(inverseBindMatrices.end(), {
+                            0.0f, -1.0f, 0.0f, 0.0f,
+                            1.0f, 0.0f, 0.0f, 0.0f,
+                            0.0f, 0.0f, 1.0f, 0.0f,
+                            -y, x, 0.0f, 1.0f });
+                    }
+
+                    Skin skin;
+                    skin.id = "0";
+                    skin.jointIds = { "upperArm", "forearm" };
+                    skin.inverseBindMatricesAccessorId = bufferBuilder.AddAccessor(inverseBindMatrices, { TYPE_MAT4, COMPONENT_FLOAT }).id;
+
+                    bufferBuilder.Output(doc);
+
+                    GLTFResourceReader reader(readerWriter);
+
+                    const auto binding = PoseUtils::GetSkinBinding(doc, reader, skin);
+
+                    AreEqual(std::vector<size_t>({ 1U, 0U }), binding.jointIndices);
+
+                    // The palette is the identity in the rest pose
+                    std::vector<Matrix4> palette(2U);
+
+                    PoseUtils::ComputeJointPalette(binding, restTransforms.data(), palette.data());
+
+                    AreNear(Matrix4::IDENTITY, palette[0]);
+                    AreNear(Matrix4::IDENTITY, palette[1]);
+
+                    // Many instances, each in a different pose, computed as one batch
+                    const size_t instanceCount = 2000U;
+
+                    std::vector<std::vector<Matrix4>> instanceTransforms(instanceCount);
+                    std::vector<Matrix4> palettes(instanceCount * 2U);
+                    std::vector<PoseUtils::PaletteJob> jobs;
+
+                    auto pose = PoseUtils::GetRestPose(doc);
+
+                    for (size_t i = 0U; i < instanceCount; ++i)
+                    {
+                        const float angle = i * 0.01f;
+
+                        pose.rotations[1] = Quaternion(0.0f, 0.0f, std::sin(angle), std::cos(angle));
+                        pose.translations[0] = Vector3(0.0f, 2.0f, i * 0.1f);
+
+                        PoseUtils::ComputeLocalTransforms(doc, pose, localTransforms);
+                        PoseUtils::ComputeWorldTransforms(hierarchy, localTransforms, instanceTransforms[i]);
+
+                        jobs.push_back({ &binding, instanceTransforms[i].data(), palettes.data() + i * 2U });
+                    }
+
+                    PoseUtils::ComputeJointPalettes(jobs);
+
+                    for (size_t i = 0U; i < instanceCount; ++i)
+                    {
+                        const auto& worldTransforms = instanceTransforms[i];
+
+                        AreNear(Math::Multiply(worldTransforms[1], binding.inverseBindMatrices[0]), palettes[i * 2U]);
+                        AreNear(Math::Multiply(worldTransforms[0], binding.inverseBindMatrices[1]), palettes[i * 2U + 1U]);
+                    }
+                }
+            };
+        }
+    }
+}
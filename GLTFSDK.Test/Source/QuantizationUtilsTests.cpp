@@ -0,0 +1,358 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+#include <GLTFSDK/BufferBuilder.h>
+#include <GLTFSDK/ExtensionsKHR.h>
+#include <GLTFSDK/GLTFResourceReader.h>
+#include <GLTFSDK/GLTFResourceWriter.h>
+#include <GLTFSDK/MeshPrimitiveUtils.h>
+#include <GLTFSDK/QuantizationUtils.h>
+#include <GLTFSDK/Validation.h>
+
+#include "TestUtils.h"
+
+using namespace glTF::UnitTest;
+
+namespace
+{
+    using namespace Microsoft::glTF;
+
+    // Deterministic pseudo-random values in the range [lo, hi]
+    std::vector<float> GenerateValues(size_t count, float lo, float hi)
+    {
+        std::vector<float> values(count);
+        uint32_t state = 12345U;
+
+        for (auto& value : values)
+        {
+            state = state * 1664525U + 1013904223U;
+            value = lo + (hi - lo) * (static_cast<float>(state >> 8) / static_cast<float>(1U << 24));
+        }
+
+        return values;
+    }
+
+    std::vector<float> GenerateUnitVectors(size_t count, size_t components)
+    {
+        auto values = GenerateValues(count * components, -1.0f, 1.0f);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            float* v = values.data() + i * components;
+            const float length = std::sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+
+            v[0] /= length;
+            v[1] /= length;
+            v[2] /= length;
+
+            if (components == 4)
+            {
+                v[3] = (i % 2) ? 1.0f : -1.0f;
+            }
+        }
+
+        return values;
+    }
+
+    // Applies a KHR_texture_transform (translation * rotation * scale) to a texture coordinate
+    Vector2 Transform(const KHR::TextureInfos::TextureTransform& transform, const Vector2& uv)
+    {
+        const float c = std::cos(transform.rotation);
+        const float s = std::sin(transform.rotation);
+        const Vector2 scaled(transform.scale.x * uv.x, transform.scale.y * uv.y);
+
+        return Vector2(transform.offset.x + c * scaled.x + s * scaled.y, transform.offset.y - s * scaled.x + c * scaled.y);
+    }
+
+    // Odd vertex counts exercise both the vectorized and scalar code paths
+    const size_t VertexCount = 37U;
+}
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Test
+        {
+            GLTFSDK_TEST_CLASS(QuantizationUtilsTests)
+            {
+                GLTFSDK_TEST_METHOD(QuantizationUtilsTests, QuantizationUtils_Test_Positions)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+                    bufferBuilder.AddBuffer();
+
+                    const auto positions = GenerateValues(VertexCount * 3U, -20.0f, 100.0f);
+                    const auto quantized = QuantizationUtils::QuantizePositions(positions);
+
+                    auto accessor = QuantizationUtils::AddPositionsAccessor(bufferBuilder, quantized);
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    Assert::IsTrue(accessor.componentType == COMPONENT_SHORT);
+                    Assert::IsTrue(accessor.normalized);
+                    Assert::AreEqual<size_t>(8U, doc.bufferViews.Get(accessor.bufferViewId).byteStride);
+                    Assert::AreEqual<size_t>(3U, accessor.min.size());
+                    Assert::AreEqual<size_t>(3U, accessor.max.size());
+
+                    GLTFResourceReader reader(readerWriter);
+                    auto output = MeshPrimitiveUtils::GetPositions(doc, reader, accessor);
+
+                    const float t[3] = { quantized.translation.x, quantized.translation.y, quantized.translation.z };
+
+                    for (size_t i = 0; i < output.size(); ++i)
+                    {
+                        output[i] = t[i % 3U] + quantized.scale * output[i];
+                    }
+
+                    AreNear(positions, output, quantized.scale / 32767.0f);
+                }
+
+                GLTFSDK_TEST_METHOD(QuantizationUtilsTests, QuantizationUtils_Test_NormalsAndTangents)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+                    bufferBuilder.AddBuffer();
+
+                    const auto normals = GenerateUnitVectors(VertexCount, 3U);
+                    const auto tangents = GenerateUnitVectors(VertexCount, 4U);
+
+                    auto normalsAccessor = QuantizationUtils::AddNormalsAccessor(bufferBuilder, QuantizationUtils::QuantizeNormals(normals));
+                    auto tangentsAccessor = QuantizationUtils::AddTangentsAccessor(bufferBuilder, QuantizationUtils::QuantizeTangents(tangents));
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    Assert::AreEqual<size_t>(4U, doc.bufferViews.Get(normalsAccessor.bufferViewId).byteStride);
+
+                    GLTFResourceReader reader(readerWriter);
+
+                    AreNear(normals, MeshPrimitiveUtils::GetNormals(doc, reader, normalsAccessor), 0.5f / 127.0f);
+                    AreNear(tangents, MeshPrimitiveUtils::GetTangents(doc, reader, tangentsAccessor), 0.5f / 127.0f);
+                }
+
+                GLTFSDK_TEST_METHOD(QuantizationUtilsTests, QuantizationUtils_Test_TexCoords)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+                    bufferBuilder.AddBuffer();
+
+                    const auto texCoords = GenerateValues(VertexCount * 2U, 0.0f, 1.0f);
+                    const auto texCoordsTiled = GenerateValues(VertexCount * 2U, -2.0f, 3.0f);
+
+                    const auto quantized = QuantizationUtils::QuantizeTexCoords(texCoords);
+                    const auto quantizedTiled = QuantizationUtils::QuantizeTexCoords(texCoordsTiled);
+
+                    // Texture coordinates within [0, 1] don't require a dequantization transform
+                    Assert::IsTrue(quantized.offset == Vector2::ZERO);
+                    Assert::IsTrue(quantized.scale == Vector2::ONE);
+                    Assert::IsTrue(quantizedTiled.offset != Vector2::ZERO);
+
+                    auto accessor = QuantizationUtils::AddTexCoordsAccessor(bufferBuilder, quantized);
+                    auto accessorTiled = QuantizationUtils::AddTexCoordsAccessor(bufferBuilder, quantizedTiled);
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    GLTFResourceReader reader(readerWriter);
+
+                    AreNear(texCoords, MeshPrimitiveUtils::GetTexCoords(doc, reader, accessor), 0.5f / 65535.0f);
+
+                    auto output = MeshPrimitiveUtils::GetTexCoords(doc, reader, accessorTiled);
+
+                    for (size_t i = 0; i < output.size(); i += 2U)
+                    {
+                        output[i] = quantizedTiled.offset.x + quantizedTiled.scale.x * output[i];
+                        output[i + 1U] = quantizedTiled.offset.y + quantizedTiled.scale.y * output[i + 1U];
+                    }
+
+                    AreNear(texCoordsTiled, output, 5.0f / 65535.0f);
+                }
+
+                GLTFSDK_TEST_METHOD(QuantizationUtilsTests, QuantizationUtils_Test_DequantizationTransform)
+                {
+                    const auto quantized = QuantizationUtils::QuantizePositions(GenerateValues(VertexCount * 3U, -5.0f, 5.0f));
+
+                    Document doc;
+
+                    Node node;
+                    node.id = "0";
+                    node.meshId = "0";
+                    node.children.push_back("1");
+                    node.translation = Vector3(1.0f, 2.0f, 3.0f);
+                    node.weights = { 0.5f };
+                    doc.nodes.Append(std::move(node));
+
+                    Node childNode;
+                    childNode.id = "1";
+                    doc.nodes.Append(std::move(childNode));
+
+                    const std::string dequantizationNodeId = QuantizationUtils::ApplyDequantizationTransform(doc, "0", quantized).id;
+
+                    // The mesh moves to a new child node, the node's existing children and transform are unchanged
+                    const auto& parent = doc.nodes["0"];
+                    const auto& dequantizationNode = doc.nodes[dequantizationNodeId];
+
+                    Assert::IsTrue(parent.meshId.empty());
+                    Assert::IsTrue(parent.weights.empty());
+                    Assert::IsTrue(parent.translation == Vector3(1.0f, 2.0f, 3.0f));
+                    Assert::IsTrue(parent.children == std::vector<std::string>({ "1", dequantizationNodeId }));
+
+                    Assert::AreEqual<std::string>("0", dequantizationNode.meshId);
+                    Assert::AreEqual<size_t>(1U, dequantizationNode.weights.size());
+                    Assert::IsTrue(dequantizationNode.translation == quantized.translation);
+                    Assert::IsTrue(dequantizationNode.scale == Vector3(quantized.scale, quantized.scale, quantized.scale));
+
+                    // The transform of a skinned mesh's node is ignored
+                    Node skinnedNode;
+                    skinnedNode.id = "1";
+                    skinnedNode.meshId = "0";
+                    skinnedNode.skinId = "0";
+                    doc.nodes.Replace(std::move(skinnedNode));
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        QuantizationUtils::ApplyDequantizationTransform(doc, "1", quantized);
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(QuantizationUtilsTests, QuantizationUtils_Test_SkinDequantizationTransform)
+                {
+                    const auto quantized = QuantizationUtils::QuantizePositions(GenerateValues(VertexCount * 3U, -5.0f, 5.0f));
+
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+                    bufferBuilder.AddBuffer();
+
+                    // A single joint whose inverse bind matrix is a translation by (1, 2, 3)
+                    bufferBuilder.AddBufferView(BufferViewTarget::UNKNOWN_BUFFER);
+                    const std::vector<float> inverseBindMatrices = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 1.0f, 2.0f, 3.0f, 1.0f };
+
+                    Skin skin;
+                    skin.id = "0";
+                    skin.jointIds.push_back("1");
+                    skin.inverseBindMatricesAccessorId = bufferBuilder.AddAccessor(inverseBindMatrices, { TYPE_MAT4, COMPONENT_FLOAT }).id;
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+                    doc.skins.Append(std::move(skin));
+
+                    Node node;
+                    node.id = "0";
+                    node.meshId = "0";
+                    node.skinId = "0";
+                    doc.nodes.Append(std::move(node));
+
+                    Node joint;
+                    joint.id = "1";
+                    doc.nodes.Append(std::move(joint));
+
+                    auto skinBufferBuilder = CreateBufferBuilder(doc, readerWriter);
+
+                    GLTFResourceReader reader(readerWriter);
+
+                    const std::string skinId = QuantizationUtils::ApplySkinDequantizationTransform(doc, reader, skinBufferBuilder, "0", quantized).id;
+                    skinBufferBuilder.Output(doc);
+
+                    // The node's skin is replaced by a copy, the original skin is unchanged
+                    Assert::AreEqual(skinId, doc.nodes["0"].skinId);
+                    Assert::AreNotEqual<std::string>("0", skinId);
+                    Assert::IsTrue(doc.skins[skinId].jointIds == doc.skins["0"].jointIds);
+                    AreEqual(inverseBindMatrices, reader.ReadBinaryData<float>(doc, doc.accessors[doc.skins["0"].inverseBindMatricesAccessorId]));
+
+                    const auto output = reader.ReadBinaryData<float>(doc, doc.accessors[doc.skins[skinId].inverseBindMatricesAccessorId]);
+
+                    Assert::AreEqual<size_t>(16U, output.size());
+                    Assert::AreEqual(quantized.scale, output[0], 1e-5f);
+                    Assert::AreEqual(quantized.scale, output[10], 1e-5f);
+                    Assert::AreEqual(1.0f + quantized.translation.x, output[12], 1e-5f);
+                    Assert::AreEqual(2.0f + quantized.translation.y, output[13], 1e-5f);
+                    Assert::AreEqual(3.0f + quantized.translation.z, output[14], 1e-5f);
+                }
+
+                GLTFSDK_TEST_METHOD(QuantizationUtilsTests, QuantizationUtils_Test_TexCoordsDequantizationTransform)
+                {
+                    using KHR::TextureInfos::TextureTransform;
+
+                    const auto quantized = QuantizationUtils::QuantizeTexCoords(GenerateValues(VertexCount * 2U, -2.0f, 3.0f));
+
+                    Document doc;
+
+                    Material material;
+                    material.id = "0";
+                    material.metallicRoughness.baseColorTexture.textureId = "0";
+                    material.normalTexture.textureId = "0";
+                    material.normalTexture.texCoord = 1U;
+                    material.emissiveTexture.textureId = "0";
+
+                    auto existing = std::make_unique<TextureTransform>();
+                    existing->offset = Vector2(0.5f, 0.25f);
+                    existing->rotation = 1.0f;
+                    existing->scale = Vector2(2.0f, 3.0f);
+
+                    const TextureTransform existingCopy(*existing);
+                    material.emissiveTexture.SetExtension(std::move(existing));
+
+                    doc.materials.Append(std::move(material));
+
+                    MeshPrimitive meshPrimitive;
+                    meshPrimitive.materialId = "0";
+
+                    QuantizationUtils::ApplyDequantizationTransform(doc, meshPrimitive, 0U, quantized);
+
+                    const auto& output = doc.materials["0"];
+
+                    Assert::IsTrue(doc.extensionsRequired.count(KHR::TextureInfos::TEXTURETRANSFORM_NAME) == 1U);
+                    Assert::IsFalse(output.normalTexture.HasExtension<TextureTransform>());
+
+                    const auto& baseColorTransform = output.metallicRoughness.baseColorTexture.GetExtension<TextureTransform>();
+
+                    Assert::IsTrue(baseColorTransform.offset == quantized.offset);
+                    Assert::IsTrue(baseColorTransform.scale == quantized.scale);
+
+                    // The combined transform maps normalized texture coordinates as the existing transform maps dequantized ones
+                    const auto& emissiveTransform = output.emissiveTexture.GetExtension<TextureTransform>();
+
+                    for (const auto& normalized : { Vector2(0.0f, 0.0f), Vector2(1.0f, 0.0f), Vector2(0.25f, 1.0f) })
+                    {
+                        const Vector2 dequantized(quantized.offset.x + quantized.scale.x * normalized.x, quantized.offset.y + quantized.scale.y * normalized.y);
+
+                        const Vector2 expected = Transform(existingCopy, dequantized);
+                        const Vector2 actual = Transform(emissiveTransform, normalized);
+
+                        Assert::AreEqual(expected.x, actual.x, 1e-4f);
+                        Assert::AreEqual(expected.y, actual.y, 1e-4f);
+                    }
+                }
+
+                GLTFSDK_TEST_METHOD(QuantizationUtilsTests, QuantizationUtils_Test_Validation)
+                {
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(std::make_shared<const StreamReaderWriter>()));
+                    bufferBuilder.AddBuffer();
+
+                    const auto positions = GenerateValues(VertexCount * 3U, -1.0f, 1.0f);
+                    const auto accessorId = QuantizationUtils::AddPositionsAccessor(bufferBuilder, QuantizationUtils::QuantizePositions(positions)).id;
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    const std::unordered_map<std::string, std::string> attributes = { { ACCESSOR_POSITION, accessorId } };
+
+                    Assert::ExpectException<ValidationException>([&]()
+                    {
+                        Validation::ValidateMeshPrimitiveAttributeAccessors(doc, attributes, VertexCount);
+                    });
+
+                    QuantizationUtils::AddExtension(doc);
+
+                    Assert::IsTrue(doc.extensionsRequired.count(KHR::MeshPrimitives::MESHQUANTIZATION_NAME) == 1U);
+
+                    Validation::ValidateMeshPrimitiveAttributeAccessors(doc, attributes, VertexCount);
+                }
+            };
+        }
+    }
+}
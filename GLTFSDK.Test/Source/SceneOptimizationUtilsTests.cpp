@@ -0,0 +1,326 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+#include <GLTFSDK/BoundsUtils.h>
+#include <GLTFSDK/BufferBuilder.h>
+#include <GLTFSDK/GLTF.h>
+#include <GLTFSDK/GLTFResourceReader.h>
+#include <GLTFSDK/GLTFResourceWriter.h>
+#include <GLTFSDK/MeshPrimitiveUtils.h>
+#include <GLTFSDK/SceneOptimizationUtils.h>
+
+#include "TestUtils.h"
+
+#include <cmath>
+
+using namespace glTF::UnitTest;
+
+namespace
+{
+    using namespace Microsoft::glTF;
+
+    const std::vector<float> QuadPositions = { 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f };
+    const std::vector<uint32_t> QuadIndices = { 0U, 1U, 2U, 0U, 2U, 3U };
+
+    void AddNode(Document& doc, const std::string& id, const std::string& meshId, const std::vector<std::string>& children = {})
+    {
+        Node node;
+        node.id = id;
+        node.meshId = meshId;
+        node.children = children;
+
+        doc.nodes.Append(std::move(node));
+    }
+
+    void AnimateNode(Document& doc, const std::string& nodeId)
+    {
+        AnimationChannel channel;
+        channel.id = "0";
+        channel.target.nodeId = nodeId;
+        channel.target.path = TARGET_TRANSLATION;
+
+        Animation animation;
+        animation.channels.Append(std::move(channel));
+        doc.animations.Append(std::move(animation), AppendIdPolicy::GenerateOnEmpty);
+    }
+
+    // A unit quad in the xy plane facing +z, with counter-clockwise triangles
+    MeshPrimitive AddQuad(BufferBuilder& bufferBuilder, const std::string& materialId)
+    {
+        MeshPrimitive meshPrimitive;
+        meshPrimitive.materialId = materialId;
+
+        bufferBuilder.AddBufferView(BufferViewTarget::ELEMENT_ARRAY_BUFFER);
+        meshPrimitive.indicesAccessorId = bufferBuilder.AddAccessor(QuadIndices, { TYPE_SCALAR, COMPONENT_UNSIGNED_INT }).id;
+
+        bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+        meshPrimitive.attributes[ACCESSOR_POSITION] = bufferBuilder.AddAccessor(QuadPositions, { TYPE_VEC3, COMPONENT_FLOAT, false, { 0.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 0.0f } }).id;
+
+        bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+        meshPrimitive.attributes[ACCESSOR_NORMAL] = bufferBuilder.AddAccessor(std::vector<float>({ 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f }), { TYPE_VEC3, COMPONENT_FLOAT }).id;
+
+        return meshPrimitive;
+    }
+
+    void AddMesh(Document& doc, const std::string& id, std::vector<MeshPrimitive> meshPrimitives)
+    {
+        Mesh mesh;
+        mesh.id = id;
+        mesh.primitives = std::move(meshPrimitives);
+
+        doc.meshes.Append(std::move(mesh));
+    }
+
+    // Checks the primitive's triangles against the quad's triangles transformed by each of the transforms, in order
+    void CheckTriangles(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, const std::vector<Matrix4>& transforms)
+    {
+        Assert::IsTrue(meshPrimitive.mode == MESH_TRIANGLES);
+
+        const auto positions = MeshPrimitiveUtils::GetPositions(doc, reader, meshPrimitive);
+        const auto normals = MeshPrimitiveUtils::GetNormals(doc, reader, meshPrimitive);
+        const auto indices = MeshPrimitiveUtils::GetTriangulatedIndices32(doc, reader, meshPrimitive);
+
+        Assert::AreEqual(QuadIndices.size() * transforms.size(), indices.size());
+
+        for (size_t i = 0U; i < indices.size(); i += 3U)
+        {
+            const auto& transform = transforms[i / QuadIndices.size()];
+            const size_t triangle = i % QuadIndices.size();
+
+            Vector3 p[3];
+
+            for (size_t j = 0U; j < 3U; ++j)
+            {
+                const float* position = positions.data() + indices[i + j] * 3U;
+                p[j] = Vector3(position[0], position[1], position[2]);
+
+                const float* normal = normals.data() + indices[i + j] * 3U;
+                Test::AreNear(1.0f, normal[2]);
+            }
+
+            // The same corners, whatever the winding
+            for (size_t j = 0U; j < 3U; ++j)
+            {
+                const uint32_t corner = QuadIndices[triangle + j];
+                const auto expected = Math::TransformPoint(transform, Vector3(QuadPositions[corner * 3U], QuadPositions[corner * 3U + 1U], QuadPositions[corner * 3U + 2U]));
+
+                bool isFound = false;
+
+                for (size_t k = 0U; k < 3U; ++k)
+                {
+                    isFound |= Test::IsNear(expected, p[k]);
+                }
+
+                Assert::IsTrue(isFound);
+            }
+
+            // The triangles still face the way their normals point
+            const float crossZ = (p[1].x - p[0].x) * (p[2].y - p[0].y) - (p[1].y - p[0].y) * (p[2].x - p[0].x);
+
+            Assert::IsTrue(crossZ > 0.0f);
+        }
+    }
+}
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Test
+        {
+            GLTFSDK_TEST_CLASS(SceneOptimizationUtilsTests)
+            {
+                GLTFSDK_TEST_METHOD(SceneOptimizationUtilsTests, SceneOptimizationUtils_Test_CollapseNodes)
+                {
+                    Document doc;
+
+                    Mesh mesh;
+                    mesh.id = "0";
+                    doc.meshes.Append(std::move(mesh));
+
+                    AddNode(doc, "group", "", { "a", "empty", "chain" });
+                    AddNode(doc, "a", "0");
+                    AddNode(doc, "empty", "");
+                    AddNode(doc, "chain", "", { "inner" });
+                    AddNode(doc, "inner", "", { "b" });
+                    AddNode(doc, "b", "0");
+                    AddNode(doc, "x", "");
+                    AddNode(doc, "orphan", "");
+                    AddNode(doc, "hollow", "", { "leaf" });
+                    AddNode(doc, "leaf", "");
+
+                    // Empty leaves are removed whatever their transform, but a node with children is only removed if it has
+                    // an identity transform
+                    auto empty = doc.nodes["empty"];
+                    empty.translation = Vector3(0.0f, 1.0f, 0.0f);
+                    doc.nodes.Replace(empty);
+
+                    auto inner = doc.nodes["inner"];
+                    inner.translation = Vector3(0.0f, 0.0f, 1.0f);
+                    doc.nodes.Replace(inner);
+
+                    auto leaf = doc.nodes["leaf"];
+                    leaf.scale = Vector3(2.0f, 2.0f, 2.0f);
+                    doc.nodes.Replace(leaf);
+
+                    AnimateNode(doc, "x");
+
+                    Scene scene;
+                    scene.id = "0";
+                    scene.nodes = { "group", "x", "hollow" };
+
+                    doc.SetDefaultScene(std::move(scene));
+
+                    Assert::AreEqual<size_t>(5U, SceneOptimizationUtils::CollapseNodes(doc));
+
+                    Assert::AreEqual<size_t>(5U, doc.nodes.Size());
+                    Assert::IsTrue(std::vector<std::string>({ "a", "inner", "x" }) == doc.GetDefaultScene().nodes);
+                    Assert::IsTrue(std::vector<std::string>({ "b" }) == doc.nodes["inner"].children);
+                    Assert::IsTrue(doc.nodes.Has("orphan"));
+
+                    Assert::AreEqual<size_t>(0U, SceneOptimizationUtils::CollapseNodes(doc));
+                }
+
+                GLTFSDK_TEST_METHOD(SceneOptimizationUtilsTests, SceneOptimizationUtils_Test_MergePrimitives)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+
+                    Mesh mesh;
+                    mesh.primitives.push_back(AddQuad(bufferBuilder, "m"));
+                    mesh.primitives.push_back(AddQuad(bufferBuilder, "n"));
+
+                    // A non-indexed strip of the same triangles
+                    MeshPrimitive strip;
+                    strip.materialId = "m";
+                    strip.mode = MESH_TRIANGLE_STRIP;
+
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+                    strip.attributes[ACCESSOR_POSITION] = bufferBuilder.AddAccessor(std::vector<float>({ 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f }), { TYPE_VEC3, COMPONENT_FLOAT, false, { 0.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 0.0f } }).id;
+
+                    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+                    strip.attributes[ACCESSOR_NORMAL] = bufferBuilder.AddAccessor(std::vector<float>({ 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f }), { TYPE_VEC3, COMPONENT_FLOAT }).id;
+
+                    mesh.primitives.push_back(strip);
+
+                    Document doc;
+                    bufferBuilder.Output(doc);
+
+                    GLTFResourceReader reader(readerWriter);
+
+                    auto mergeBufferBuilder = CreateBufferBuilder(doc, readerWriter);
+
+                    const auto unmerged = mesh.primitives[1];
+
+                    Assert::AreEqual<size_t>(1U, SceneOptimizationUtils::MergePrimitives(doc, reader, mesh, mergeBufferBuilder));
+
+                    mergeBufferBuilder.Output(doc);
+
+                    Assert::AreEqual<size_t>(2U, mesh.primitives.size());
+                    Assert::AreEqual(std::string("m"), mesh.primitives[0].materialId);
+                    Assert::IsTrue(unmerged == mesh.primitives[1]);
+
+                    CheckTriangles(doc, reader, mesh.primitives[0], { Matrix4::IDENTITY, Matrix4::IDENTITY });
+
+                    const auto& positions = doc.accessors[mesh.primitives[0].GetAttributeAccessorId(ACCESSOR_POSITION)];
+
+                    Assert::AreEqual<size_t>(8U, positions.count);
+                    Assert::IsTrue(std::vector<float>({ 0.0f, 0.0f, 0.0f }) == positions.min);
+                    Assert::IsTrue(std::vector<float>({ 1.0f, 1.0f, 0.0f }) == positions.max);
+                }
+
+                GLTFSDK_TEST_METHOD(SceneOptimizationUtilsTests, SceneOptimizationUtils_Test_MergeMeshNodes)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+                    auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                    bufferBuilder.AddBuffer();
+
+                    Document doc;
+
+                    AddMesh(doc, "0", { AddQuad(bufferBuilder, "m") });
+                    AddMesh(doc, "1", { AddQuad(bufferBuilder, "m") });
+                    AddMesh(doc, "2", { AddQuad(bufferBuilder, "n") });
+                    AddMesh(doc, "shared", { AddQuad(bufferBuilder, "m") });
+
+                    bufferBuilder.Output(doc);
+
+                    // The root's children a, b (which mirrors its quad) and c are merged into a. The nodes that share a
+                    // mesh, s0 and s1, are left alone.
+                    AddNode(doc, "root", "", { "a", "s0", "b", "c" });
+                    AddNode(doc, "a", "0");
+                    AddNode(doc, "s0", "shared");
+                    AddNode(doc, "b", "1");
+                    AddNode(doc, "c", "2");
+                    AddNode(doc, "s1", "shared");
+
+                    auto a = doc.nodes["a"];
+                    a.translation = Vector3(2.0f, 0.0f, 0.0f);
+                    doc.nodes.Replace(a);
+
+                    auto b = doc.nodes["b"];
+                    b.translation = Vector3(0.0f, 3.0f, 0.0f);
+                    b.scale = Vector3(-1.0f, 1.0f, 1.0f);
+                    doc.nodes.Replace(b);
+
+                    auto c = doc.nodes["c"];
+                    c.matrix = Math::CreateTransform(Vector3::ZERO, Quaternion(0.0f, 0.0f, std::sqrt(0.5f), std::sqrt(0.5f)), Vector3::ONE);
+                    doc.nodes.Replace(c);
+
+                    const std::vector<Matrix4> transforms = { BoundsUtils::GetLocalTransform(a), BoundsUtils::GetLocalTransform(b), BoundsUtils::GetLocalTransform(c) };
+
+                    Scene scene;
+                    scene.id = "0";
+                    scene.nodes = { "root", "s1" };
+
+                    doc.SetDefaultScene(std::move(scene));
+
+                    GLTFResourceReader reader(readerWriter);
+
+                    auto mergeBufferBuilder = CreateBufferBuilder(doc, readerWriter);
+
+                    Assert::AreEqual<size_t>(2U, SceneOptimizationUtils::MergeMeshNodes(doc, reader, mergeBufferBuilder));
+
+                    mergeBufferBuilder.Output(doc);
+
+                    Assert::IsTrue(std::vector<std::string>({ "a", "s0" }) == doc.nodes["root"].children);
+                    Assert::IsTrue(std::vector<std::string>({ "root", "s1" }) == doc.GetDefaultScene().nodes);
+                    Assert::AreEqual<size_t>(4U, doc.nodes.Size());
+
+                    Assert::AreEqual<size_t>(2U, doc.meshes.Size());
+                    Assert::IsFalse(doc.meshes.Has("1"));
+                    Assert::IsFalse(doc.meshes.Has("2"));
+
+                    const auto& node = doc.nodes["a"];
+
+                    Assert::IsTrue(node.GetTransformationType() == TRANSFORMATION_IDENTITY);
+                    Assert::AreEqual(std::string("0"), node.meshId);
+
+                    const auto& mesh = doc.meshes["0"];
+
+                    Assert::AreEqual<size_t>(2U, mesh.primitives.size());
+                    Assert::AreEqual(std::string("m"), mesh.primitives[0].materialId);
+                    Assert::AreEqual(std::string("n"), mesh.primitives[1].materialId);
+
+                    CheckTriangles(doc, reader, mesh.primitives[0], { transforms[0], transforms[1] });
+                    CheckTriangles(doc, reader, mesh.primitives[1], { transforms[2] });
+
+                    const auto& positions = doc.accessors[mesh.primitives[0].GetAttributeAccessorId(ACCESSOR_POSITION)];
+
+                    Assert::IsTrue(std::vector<float>({ -1.0f, 0.0f, 0.0f }) == positions.min);
+                    Assert::IsTrue(std::vector<float>({ 3.0f, 4.0f, 0.0f }) == positions.max);
+
+                    // The merged node has nothing left to merge or bake
+                    auto nextBufferBuilder = CreateBufferBuilder(doc, readerWriter);
+
+                    Assert::AreEqual<size_t>(0U, SceneOptimizationUtils::MergeMeshNodes(doc, reader, nextBufferBuilder));
+                    Assert::AreEqual<size_t>(0U, nextBufferBuilder.GetAccessorCount());
+                }
+            };
+        }
+    }
+}
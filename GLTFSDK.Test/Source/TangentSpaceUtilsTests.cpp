@@ -0,0 +1,231 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+#include <GLTFSDK/BufferBuilder.h>
+#include <GLTFSDK/GLTF.h>
+#include <GLTFSDK/GLTFResourceReader.h>
+#include <GLTFSDK/GLTFResourceWriter.h>
+#include <GLTFSDK/MeshPrimitiveUtils.h>
+#include <GLTFSDK/TangentSpaceUtils.h>
+
+#include "TestUtils.h"
+
+#include <cmath>
+
+using namespace glTF::UnitTest;
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Test
+        {
+            GLTFSDK_TEST_CLASS(TangentSpaceUtilsTests)
+            {
+                GLTFSDK_TEST_METHOD(TangentSpaceUtilsTests, TangentSpaceUtils_Test_GenerateNormals)
+                {
+                    // The corner of a cube - the +z face is split into two triangles at the origin while the +x and +y faces
+                    // each have a single triangle at the origin
+                    const std::vector<float> positions = {
+                        0.0f, 0.0f, 0.0f,
+                        1.0f, 0.0f, 0.0f,
+                        1.0f, 1.0f, 0.0f,
+                        0.0f, 1.0f, 0.0f,
+                        0.0f, 1.0f, 1.0f,
+                        0.0f, 0.0f, 1.0f,
+                        1.0f, 0.0f, 1.0f,
+                        5.0f, 5.0f, 5.0f // Unreferenced
+                    };
+
+                    const std::vector<uint32_t> indices = {
+                        0U, 1U, 2U, 0U, 2U, 3U, // +z
+                        0U, 3U, 5U, 3U, 4U, 5U, // +x
+                        0U, 5U, 1U, 5U, 6U, 1U  // +y
+                    };
+
+                    // Each face has a right angle at the origin regardless of how it's triangulated...
+                    const auto angleNormals = TangentSpaceUtils::GenerateNormals(indices, positions, TangentSpaceUtils::NormalWeighting::Angle);
+
+                    Assert::AreEqual<size_t>(positions.size(), angleNormals.size());
+
+                    const float a = 1.0f / std::sqrt(3.0f);
+                    AreNear({ a, a, a }, angleNormals.data());
+
+                    // ...but the +z face has twice the area of the +x and +y face triangles at the origin
+                    const auto areaNormals = TangentSpaceUtils::GenerateNormals(indices, positions, TangentSpaceUtils::NormalWeighting::Area);
+
+                    const float b = 1.0f / std::sqrt(6.0f);
+                    AreNear({ b, b, 2.0f * b }, areaNormals.data());
+
+                    // Vertices on a single face have the face normal
+                    AreNear({ 1.0f, 0.0f, 0.0f }, angleNormals.data() + 4U * 3U);
+                    AreNear({ 0.0f, 1.0f, 0.0f }, areaNormals.data() + 6U * 3U);
+
+                    AreNear({ 0.0f, 0.0f, 1.0f }, angleNormals.data() + 7U * 3U);
+
+                    Assert::ExpectException<GLTFException>([&]()
+                    {
+                        TangentSpaceUtils::GenerateNormals({ 0U, 1U, 8U }, positions);
+                    });
+                }
+
+                GLTFSDK_TEST_METHOD(TangentSpaceUtilsTests, TangentSpaceUtils_Test_GenerateTangents)
+                {
+                    for (auto mirrored : { false, true })
+                    {
+                        std::vector<uint32_t> indices;
+                        std::vector<float> positions;
+                        std::vector<float> texCoords;
+
+                        GenerateGrid(4U, indices, positions);
+                        GenerateGridTexCoords(4U, texCoords, mirrored);
+
+                        const auto normals = TangentSpaceUtils::GenerateNormals(indices, positions);
+                        const auto tangents = TangentSpaceUtils::GenerateTangents(indices, positions, normals, texCoords);
+
+                        Assert::AreEqual<size_t>(positions.size() / 3U * 4U, tangents.size());
+
+                        // The tangent follows increasing u and the bitangent, cross(normal, tangent) * w, increasing v
+                        const std::vector<float> expected = mirrored ? std::vector<float>({ -1.0f, 0.0f, 0.0f, -1.0f }) : std::vector<float>({ 1.0f, 0.0f, 0.0f, 1.0f });
+
+                        for (size_t i = 0U; i < tangents.size(); i += 4U)
+                        {
+                            AreNear(expected, tangents.data() + i);
+                        }
+                    }
+                }
+
+                GLTFSDK_TEST_METHOD(TangentSpaceUtilsTests, TangentSpaceUtils_Test_GenerateTangents_ClockwiseWinding)
+                {
+                    std::vector<uint32_t> indices;
+                    std::vector<float> positions;
+                    std::vector<float> texCoords;
+
+                    GenerateGrid(4U, indices, positions);
+                    GenerateGridTexCoords(4U, texCoords);
+
+                    // Reverse the winding of every triangle but keep the normals facing +z - the handedness must follow the
+                    // texture coordinates relative to the normals rather than the winding
+                    for (size_t i = 0U; i < indices.size(); i += 3U)
+                    {
+                        std::swap(indices[i + 1U], indices[i + 2U]);
+                    }
+
+                    std::vector<float> normals;
+
+                    for (size_t i = 0U; i < positions.size() / 3U; ++i)
+                    {
+                        normals.insert(normals.end(), { 0.0f, 0.0f, 1.0f });
+                    }
+
+                    const auto tangents = TangentSpaceUtils::GenerateTangents(indices, positions, normals, texCoords);
+
+                    for (size_t i = 0U; i < tangents.size(); i += 4U)
+                    {
+                        AreNear({ 1.0f, 0.0f, 0.0f, 1.0f }, tangents.data() + i);
+                    }
+                }
+
+                GLTFSDK_TEST_METHOD(TangentSpaceUtilsTests, TangentSpaceUtils_Test_Deterministic)
+                {
+                    // Large enough to be split across several ParallelFor sub-ranges
+                    std::vector<uint32_t> indices;
+                    std::vector<float> positions;
+                    std::vector<float> texCoords;
+
+                    GenerateGrid(128U, indices, positions, [](float x, float y) { return std::sin(x * 0.1f) * std::cos(y * 0.1f); });
+                    GenerateGridTexCoords(128U, texCoords);
+
+                    const auto normals = TangentSpaceUtils::GenerateNormals(indices, positions);
+                    const auto tangents = TangentSpaceUtils::GenerateTangents(indices, positions, normals, texCoords);
+
+                    for (size_t i = 0U; i < 4U; ++i)
+                    {
+                        Assert::IsTrue(normals == TangentSpaceUtils::GenerateNormals(indices, positions));
+                        Assert::IsTrue(tangents == TangentSpaceUtils::GenerateTangents(indices, positions, normals, texCoords));
+                    }
+
+                    for (size_t i = 0U; i < normals.size() / 3U; ++i)
+                    {
+                        const float* n = &normals[i * 3U];
+                        const float* t = &tangents[i * 4U];
+
+                        Assert::IsTrue(std::abs(n[0] * n[0] + n[1] * n[1] + n[2] * n[2] - 1.0f) < 1.0e-5f);
+                        Assert::IsTrue(std::abs(t[0] * t[0] + t[1] * t[1] + t[2] * t[2] - 1.0f) < 1.0e-5f);
+                        Assert::IsTrue(std::abs(n[0] * t[0] + n[1] * t[1] + n[2] * t[2]) < 1.0e-5f);
+                    }
+                }
+
+                GLTFSDK_TEST_METHOD(TangentSpaceUtilsTests, TangentSpaceUtils_Test_GenerateMeshPrimitive)
+                {
+                    auto readerWriter = std::make_shared<const StreamReaderWriter>();
+
+                    std::vector<uint32_t> indices;
+                    std::vector<float> positions;
+                    std::vector<float> texCoords;
+
+                    GenerateGrid(4U, indices, positions);
+                    GenerateGridTexCoords(4U, texCoords);
+
+                    Document doc;
+                    MeshPrimitive meshPrimitive;
+
+                    {
+                        auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(readerWriter));
+
+                        bufferBuilder.AddBuffer();
+
+                        bufferBuilder.AddBufferView(BufferViewTarget::ELEMENT_ARRAY_BUFFER);
+                        meshPrimitive.indicesAccessorId = bufferBuilder.AddAccessor(indices, { TYPE_SCALAR, COMPONENT_UNSIGNED_INT }).id;
+
+                        bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+                        meshPrimitive.attributes[ACCESSOR_POSITION] = bufferBuilder.AddAccessor(positions, { TYPE_VEC3, COMPONENT_FLOAT, false, { 0.0f, 0.0f, 0.0f }, { 4.0f, 4.0f, 0.0f } }).id;
+
+                        bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+                        meshPrimitive.attributes[ACCESSOR_TEXCOORD_0] = bufferBuilder.AddAccessor(texCoords, { TYPE_VEC2, COMPONENT_FLOAT }).id;
+
+                        bufferBuilder.Output(doc);
+                    }
+
+                    GLTFResourceReader reader(readerWriter);
+
+                    {
+                        auto bufferBuilder = CreateBufferBuilder(doc, readerWriter);
+
+                        // Tangents can't be generated without normals
+                        Assert::ExpectException<GLTFException>([&]()
+                        {
+                            TangentSpaceUtils::GenerateTangents(doc, reader, meshPrimitive, bufferBuilder);
+                        });
+
+                        TangentSpaceUtils::GenerateNormals(doc, reader, meshPrimitive, bufferBuilder);
+
+                        bufferBuilder.Output(doc);
+                    }
+
+                    {
+                        auto bufferBuilder = CreateBufferBuilder(doc, readerWriter);
+
+                        TangentSpaceUtils::GenerateTangents(doc, reader, meshPrimitive, bufferBuilder);
+
+                        bufferBuilder.Output(doc);
+                    }
+
+                    const auto normals = MeshPrimitiveUtils::GetNormals(doc, reader, meshPrimitive);
+                    const auto tangents = MeshPrimitiveUtils::GetTangents(doc, reader, meshPrimitive);
+
+                    Assert::AreEqual<size_t>(positions.size(), normals.size());
+                    Assert::AreEqual<size_t>(positions.size() / 3U * 4U, tangents.size());
+
+                    for (size_t i = 0U; i < positions.size() / 3U; ++i)
+                    {
+                        AreNear({ 0.0f, 0.0f, 1.0f }, normals.data() + i * 3U);
+                        AreNear({ 1.0f, 0.0f, 0.0f, 1.0f }, tangents.data() + i * 4U);
+                    }
+                }
+            };
+        }
+    }
+}
@@ -8,11 +8,18 @@
 #include <GLTFSDK/GLTFResourceWriter.h>
 #include <GLTFSDK/IStreamReader.h>
 #include <GLTFSDK/IStreamWriter.h>
+#include <GLTFSDK/Math.h>
 
+#include <algorithm>
+#include <cmath>
 #include <fstream>
+#include <functional>
+#include <limits>
 #include <memory>
 #include <unordered_map>
 #include <sstream>
+#include <string>
+#include <vector>
 
 using namespace glTF::UnitTest;
 
@@ -28,6 +35,60 @@ namespace Microsoft
                 Assert::IsTrue(a == b, message);
             }
 
+            const float DefaultTolerance = 1.0e-5f;
+
+            inline bool IsNear(float expected, float actual, float tolerance = DefaultTolerance)
+            {
+                return std::abs(expected - actual) <= tolerance;
+            }
+
+            inline bool IsNear(const Vector3& expected, const Vector3& actual, float tolerance = DefaultTolerance)
+            {
+                return IsNear(expected.x, actual.x, tolerance)
+                    && IsNear(expected.y, actual.y, tolerance)
+                    && IsNear(expected.z, actual.z, tolerance);
+            }
+
+            inline void AreNear(float expected, float actual, float tolerance = DefaultTolerance)
+            {
+                Assert::IsTrue(IsNear(expected, actual, tolerance));
+            }
+
+            inline void AreNear(const Vector3& expected, const Vector3& actual, float tolerance = DefaultTolerance)
+            {
+                Assert::IsTrue(IsNear(expected, actual, tolerance));
+            }
+
+            // Compares the rotations rather than the quaternions, as q and -q are the same rotation
+            inline void AreNear(const Quaternion& expected, const Quaternion& actual, float tolerance = DefaultTolerance)
+            {
+                AreNear(1.0f, std::abs(expected.x * actual.x + expected.y * actual.y + expected.z * actual.z + expected.w * actual.w), tolerance);
+            }
+
+            inline void AreNear(const Matrix4& expected, const Matrix4& actual, float tolerance = DefaultTolerance)
+            {
+                for (size_t i = 0U; i < 16U; ++i)
+                {
+                    AreNear(expected.values[i], actual.values[i], tolerance);
+                }
+            }
+
+            // Compares the expected values with as many values starting at actual (e.g. one element of a larger array)
+            inline void AreNear(const std::vector<float>& expected, const float* actual, float tolerance = DefaultTolerance)
+            {
+                for (size_t i = 0U; i < expected.size(); ++i)
+                {
+                    AreNear(expected[i], actual[i], tolerance);
+                }
+            }
+
+            inline void AreNear(const std::vector<float>& expected, const std::vector<float>& actual, float tolerance = DefaultTolerance)
+            {
+                Assert::AreEqual(expected.size(), actual.size());
+
+                AreNear(expected, actual.data(), tolerance);
+            }
+
             class StreamReaderWriter : public Microsoft::glTF::IStreamWriter, public Microsoft::glTF::IStreamReader
             {
             public:
@@ -135,6 +196,95 @@ namespace Microsoft
                 auto json = std::string(std::istreambuf_iterator<char>(*input), std::istreambuf_iterator<char>());
                 return json;
             }
+
+            // Creates a BufferBuilder, with a buffer already added, whose generated ids follow on from the ids of the document's
+            // existing buffers, buffer views and accessors - for tests that add resources to a document. The document must
+            // outlive the BufferBuilder.
+            inline BufferBuilder CreateBufferBuilder(const Document& doc, std::shared_ptr<const IStreamWriter> streamWriter)
+            {
+                auto bufferBuilder = BufferBuilder(std::make_unique<GLTFResourceWriter>(std::move(streamWriter)),
+                    [&doc](const BufferBuilder& builder) { return std::to_string(doc.buffers.Size() + builder.GetBufferCount()); },
+                    [&doc](const BufferBuilder& builder) { return std::to_string(doc.bufferViews.Size() + builder.GetBufferViewCount()); },
+                    [&doc](const BufferBuilder& builder) { return std::to_string(doc.accessors.Size() + builder.GetAccessorCount()); });
+
+                bufferBuilder.AddBuffer();
+
+                return bufferBuilder;
+            }
+
+            // Generates a size x size grid of unit quads, each quad split into two triangles facing +z. The optional height
+            // function displaces each vertex along z. When seamColumn is less than size the vertices are duplicated and the quads
+            // from seamColumn onwards use the second copy, producing an attribute seam (split vertices) along that column.
+            inline void GenerateGrid(size_t size, std::vector<uint32_t>& indices, std::vector<float>& positions,
+                const std::function<float(float, float)>& height = nullptr, size_t seamColumn = std::numeric_limits<size_t>::max())
+            {
+                const uint32_t rowLength = static_cast<uint32_t>(size + 1U);
+                const uint32_t seamOffset = rowLength * rowLength;
+                const size_t copyCount = seamColumn < size ? 2U : 1U;
+
+                indices.clear();
+                positions.clear();
+
+                for (size_t copy = 0U; copy < copyCount; ++copy)
+                {
+                    for (size_t y = 0U; y <= size; ++y)
+                    {
+                        for (size_t x = 0U; x <= size; ++x)
+                        {
+                            const float fx = static_cast<float>(x);
+                            const float fy = static_cast<float>(y);
+
+                            positions.insert(positions.end(), { fx, fy, height ? height(fx, fy) : 0.0f });
+                        }
+                    }
+                }
+
+                for (uint32_t y = 0U; y < size; ++y)
+                {
+                    for (uint32_t x = 0U; x < size; ++x)
+                    {
+                        const uint32_t v = y * rowLength + x + (x >= seamColumn ? seamOffset : 0U);
+
+                        indices.insert(indices.end(), { v, v + 1U, v + rowLength, v + 1U, v + rowLength + 1U, v + rowLength });
+                    }
+                }
+            }
+
+            // Generates texture coordinates spanning [0, 1] for the vertices of a GenerateGrid grid without a seam. If mirrored is
+            // true then the u texture coordinate decreases along x.
+            inline void GenerateGridTexCoords(size_t size, std::vector<float>& texCoords, bool mirrored = false)
+            {
+                texCoords.clear();
+
+                for (size_t y = 0U; y <= size; ++y)
+                {
+                    for (size_t x = 0U; x <= size; ++x)
+                    {
+                        const float u = static_cast<float>(x) / size;
+                        const float v = static_cast<float>(y) / size;
+
+                        texCoords.insert(texCoords.end(), { mirrored ? 1.0f - u : u, v });
+                    }
+                }
+            }
+
+            // Reorders the triangles into a cache unfriendly (scattered) order. A fixed stride that's coprime with the triangle
+            // count gives a deterministic permutation.
+            inline void ScatterTriangles(std::vector<uint32_t>& indices)
+            {
+                const size_t triangleCount = indices.size() / 3U;
+
+                std::vector<uint32_t> scattered;
+                scattered.reserve(indices.size());
+
+                for (size_t i = 0U; i < triangleCount; ++i)
+                {
+                    const auto triangle = indices.begin() + ((i * 7919U) % triangleCount) * 3U;
+                    scattered.insert(scattered.end(), triangle, triangle + 3U);
+                }
+
+                indices = std::move(scattered);
+            }
         }
     }
 }
\ No newline at end of file
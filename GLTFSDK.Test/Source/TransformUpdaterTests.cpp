@@ -0,0 +1,134 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "stdafx.h"
+
+#include <GLTFSDK/TransformUpdater.h>
+
+#include "TestUtils.h"
+
+#include <cmath>
+
+using namespace glTF::UnitTest;
+
+namespace
+{
+    using namespace Microsoft::glTF;
+
+    // A scene with a single root and a complete tree of nodes below it, each with four children
+    Document CreateDocument(size_t nodeCount)
+    {
+        Document doc;
+
+        for (size_t i = 0U; i < nodeCount; ++i)
+        {
+            Node node;
+            node.id = std::to_string(i);
+            node.translation = Vector3(1.0f, static_cast<float>(i % 3U), 0.0f);
+            node.rotation = Quaternion(0.0f, std::sin(0.1f), 0.0f, std::cos(0.1f));
+
+            for (size_t child = i * 4U + 1U; child <= i * 4U + 4U && child < nodeCount; ++child)
+            {
+                node.children.push_back(std::to_string(child));
+            }
+
+            doc.nodes.Append(std::move(node));
+        }
+
+        Scene scene;
+        scene.id = "0";
+        scene.nodes = { "0" };
+
+        doc.SetDefaultScene(std::move(scene));
+
+        return doc;
+    }
+
+    // Returns the world transforms computed serially from the updater's local transforms
+    std::vector<Matrix4> GetExpectedWorldTransforms(const FlatSceneGraph& sceneGraph, const TransformUpdater& updater)
+    {
+        std::vector<Matrix4> localTransforms;
+        std::vector<Matrix4> worldTransforms(sceneGraph.GetNodeCount());
+
+        for (size_t i = 0U; i < sceneGraph.GetNodeCount(); ++i)
+        {
+            localTransforms.push_back(updater.GetLocalTransform(i));
+        }
+
+        sceneGraph.ComputeWorldTransforms(localTransforms.data(), worldTransforms.data());
+
+        return worldTransforms;
+    }
+
+    Matrix4 CreateTranslation(float x, float y, float z)
+    {
+        return Math::CreateTransform(Vector3(x, y, z), Quaternion::IDENTITY, Vector3::ONE);
+    }
+}
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace Test
+        {
+            GLTFSDK_TEST_CLASS(TransformUpdaterTests)
+            {
+                GLTFSDK_TEST_METHOD(TransformUpdaterTests, TransformUpdater_Test_UpdateAll)
+                {
+                    const auto doc = CreateDocument(20000U);
+                    const FlatSceneGraph sceneGraph(doc);
+
+                    TransformUpdater updater(sceneGraph, sceneGraph.GetLocalTransforms(doc));
+
+                    // 1 + 4 + 16 + ... + 4^7 > 20000
+                    Assert::AreEqual<size_t>(8U, updater.GetLevelCount());
+                    Assert::IsFalse(updater.IsDirty());
+
+                    // The wide levels are updated in parallel but with the same operations as a serial update
+                    Assert::IsTrue(GetExpectedWorldTransforms(sceneGraph, updater) == updater.GetWorldTransforms());
+                }
+
+                GLTFSDK_TEST_METHOD(TransformUpdaterTests, TransformUpdater_Test_Update)
+                {
+                    const auto doc = CreateDocument(20000U);
+                    const FlatSceneGraph sceneGraph(doc);
+
+                    TransformUpdater updater(sceneGraph, sceneGraph.GetLocalTransforms(doc));
+
+                    Assert::AreEqual<size_t>(0U, updater.Update());
+
+                    // A few small subtrees, one of which contains another dirty node
+                    const size_t leaf = sceneGraph.GetNodeCount() - 1U;
+                    const size_t parent = sceneGraph.GetParent(leaf);
+                    const size_t other = sceneGraph.GetFlatIndex(doc.nodes.GetIndex("100"));
+
+                    updater.SetLocalTransform(leaf, CreateTranslation(0.0f, 1.0f, 0.0f));
+                    updater.SetLocalTransform(parent, CreateTranslation(0.0f, 2.0f, 0.0f));
+                    updater.SetLocalTransform(other, CreateTranslation(0.0f, 3.0f, 0.0f));
+                    updater.SetLocalTransform(other, CreateTranslation(0.0f, 4.0f, 0.0f));
+
+                    Assert::IsTrue(updater.IsDirty());
+                    Assert::AreEqual(sceneGraph.GetSubtreeSize(parent) + sceneGraph.GetSubtreeSize(other), updater.Update());
+                    Assert::IsFalse(updater.IsDirty());
+                    Assert::IsTrue(GetExpectedWorldTransforms(sceneGraph, updater) == updater.GetWorldTransforms());
+
+                    // Several large subtrees
+                    for (const auto nodeId : { "1", "2", "3" })
+                    {
+                        updater.SetLocalTransform(sceneGraph.GetFlatIndex(doc.nodes.GetIndex(nodeId)), CreateTranslation(1.0f, 0.0f, 0.0f));
+                    }
+
+                    Assert::AreEqual<size_t>(3U * sceneGraph.GetSubtreeSize(1U), updater.Update());
+                    Assert::IsTrue(GetExpectedWorldTransforms(sceneGraph, updater) == updater.GetWorldTransforms());
+
+                    // The whole scene
+                    updater.SetLocalTransform(0U, CreateTranslation(0.0f, 0.0f, 1.0f));
+
+                    Assert::AreEqual(sceneGraph.GetNodeCount(), updater.Update());
+                    Assert::IsTrue(GetExpectedWorldTransforms(sceneGraph, updater) == updater.GetWorldTransforms());
+                }
+            };
+        }
+    }
+}
@@ -7,6 +7,8 @@
 #include <GLTFSDK/ExtensionsKHR.h>
 #include <GLTFSDK/Visitor.h>
 
+#include <atomic>
+
 using namespace glTF::UnitTest;
 
 namespace
@@ -185,6 +187,53 @@ namespace
     ]
 }
 )";
+
+    // A scene with many root nodes, each with a child, that reference a few meshes (with ids that aren't indices) which
+    // in turn share a material
+    Microsoft::glTF::Document CreateInstancedDocument(size_t rootCount, size_t meshCount)
+    {
+        using namespace Microsoft::glTF;
+
+        Document gltfDoc;
+
+        Material material;
+        material.id = "material";
+        gltfDoc.materials.Append(std::move(material));
+
+        for (size_t i = 0U; i < meshCount; ++i)
+        {
+            MeshPrimitive meshPrimitive;
+            meshPrimitive.materialId = "material";
+
+            Mesh mesh;
+            mesh.id = "mesh_" + std::to_string(i);
+            mesh.primitives.push_back(meshPrimitive);
+            gltfDoc.meshes.Append(std::move(mesh));
+        }
+
+        Scene scene;
+        scene.id = "scene";
+
+        for (size_t i = 0U; i < rootCount; ++i)
+        {
+            Node child;
+            child.id = "child_" + std::to_string(i);
+            child.meshId = "mesh_" + std::to_string(i % meshCount);
+
+            Node root;
+            root.id = "root_" + std::to_string(i);
+            root.children.push_back(child.id);
+
+            gltfDoc.nodes.Append(std::move(child));
+            gltfDoc.nodes.Append(std::move(root));
+
+            scene.nodes.push_back("root_" + std::to_string(i));
+        }
+
+        gltfDoc.SetDefaultScene(std::move(scene));
+
+        return gltfDoc;
+    }
 }
 
 namespace Microsoft
@@ -396,6 +445,86 @@ namespace Microsoft
                     // Reset back to false - just in case the test is run multiple times by the same process
                     g_isVisited = false;
                 }
+
+                GLTFSDK_TEST_METHOD(VisitorTests, TestVisitorNonNumericIds)
+                {
+                    const Document gltfDoc = CreateInstancedDocument(16U, 4U);
+
+                    size_t countNode = 0U;
+                    size_t countMesh = 0U;
+                    size_t countMeshInstances = 0U;
+                    size_t countMaterial = 0U;
+
+                    Visit(gltfDoc, DefaultSceneIndex,
+                        [&countNode](const Node&, const Node*)
+                    {
+                        ++countNode;
+                    },
+                        [&countMesh, &countMeshInstances](const Mesh&, VisitState visitState)
+                    {
+                        countMesh += (visitState == VisitState::New) ? 1 : 0;
+                        countMeshInstances++;
+                    },
+                        [&countMaterial](const Material&, VisitState visitState)
+                    {
+                        countMaterial += (visitState == VisitState::New) ? 1 : 0;
+                    });
+
+                    Assert::AreEqual<size_t>(32U, countNode);
+                    Assert::AreEqual<size_t>(4U, countMesh);
+                    Assert::AreEqual<size_t>(16U, countMeshInstances);
+                    Assert::AreEqual<size_t>(1U, countMaterial);
+                }
+
+                GLTFSDK_TEST_METHOD(VisitorTests, TestParallelVisitor)
+                {
+                    const Document gltfDoc = CreateInstancedDocument(1000U, 10U);
+
+                    std::atomic<size_t> countNode(0U);
+                    std::atomic<size_t> countMesh(0U);
+                    std::atomic<size_t> countMeshInstances(0U);
+                    std::atomic<size_t> countMaterial(0U);
+
+                    ParallelVisit(gltfDoc, DefaultSceneIndex,
+                        [&countNode](const Node& node, const Node* nodeParent)
+                    {
+                        // Children are visited after their parents
+                        Assert::IsTrue(nodeParent == nullptr || nodeParent->children.front() == node.id);
+                        ++countNode;
+                    },
+                        [&countMesh, &countMeshInstances](const Mesh&, VisitState visitState)
+                    {
+                        countMesh += (visitState == VisitState::New) ? 1 : 0;
+                        countMeshInstances++;
+                    },
+                        [&countMaterial](const Material&, VisitState visitState)
+                    {
+                        countMaterial += (visitState == VisitState::New) ? 1 : 0;
+                    });
+
+                    // Meshes and materials shared between threads are still only New once
+                    Assert::AreEqual<size_t>(2000U, countNode);
+                    Assert::AreEqual<size_t>(10U, countMesh);
+                    Assert::AreEqual<size_t>(1000U, countMeshInstances);
+                    Assert::AreEqual<size_t>(1U, countMaterial);
+
+                    // A node with more than one parent is still detected
+                    Document invalidDoc = CreateInstancedDocument(8U, 1U);
+
+                    Node root;
+                    root.id = "root";
+                    root.children.push_back("child_0");
+                    invalidDoc.nodes.Append(std::move(root));
+
+                    Scene scene = invalidDoc.GetDefaultScene();
+                    scene.nodes.push_back("root");
+                    invalidDoc.scenes.Replace(scene);
+
+                    Assert::ExpectException<InvalidGLTFException>([&invalidDoc]()
+                    {
+                        ParallelVisit(invalidDoc, DefaultSceneIndex, [](const Node&, const Node*) {});
+                    });
+                }
             };
         }
     }
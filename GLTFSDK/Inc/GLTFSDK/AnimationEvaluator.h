@@ -0,0 +1,110 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/GLTF.h>
+
+#include <array>
+#include <string>
+#include <vector>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        class Document;
+        class GLTFResourceReader;
+
+        enum class RotationInterpolation
+        {
+            Slerp, // Spherical linear interpolation along the shortest arc, as required by the glTF spec
+            Nlerp  // Normalized linear interpolation - cheaper but doesn't have a constant angular velocity
+        };
+
+        // The keyframes of an animation channel's sampler
+        struct AnimationCurve
+        {
+            TargetPath path = TARGET_UNKNOWN;
+            InterpolationType interpolation = INTERPOLATION_LINEAR;
+
+            // The number of floats per value - 3 for translations and scales, 4 for rotations and the number of morph
+            // targets for weights
+            size_t componentCount = 0U;
+
+            std::vector<float> times;
+            std::vector<float> values; // CUBICSPLINE curves have an in-tangent, value and out-tangent per keyframe
+        };
+
+        // Evaluates every channel of an animation at a given time. The keyframes are read once, on construction, and each
+        // channel keeps a cursor to its most recent keyframe so that playback with increasing (or decreasing) times doesn't
+        // need to search the keyframes.
+        class AnimationEvaluator
+        {
+        public:
+            AnimationEvaluator(const Document& doc, const GLTFResourceReader& reader, const Animation& animation,
+                RotationInterpolation rotationInterpolation = RotationInterpolation::Slerp);
+
+            size_t GetChannelCount() const;
+
+            const std::string& GetNodeId(size_t channelIndex) const;
+            const AnimationCurve& GetCurve(size_t channelIndex) const;
+
+            // The offset of the channel's values in the output for its target path (see GetOutput)
+            size_t GetOutputOffset(size_t channelIndex) const;
+
+            // The earliest and latest keyframe times of all the channels
+            float GetStartTime() const;
+            float GetEndTime() const;
+
+            // Evaluates every channel at the time, clamping to each channel's first and last keyframes. Channels are evaluated
+            // grouped by target path into one contiguous output array per path.
+            void Evaluate(float time);
+
+            // The output of the most recent call to Evaluate for the target path - the values of each channel with that target
+            // path, in channel order
+            const std::vector<float>& GetOutput(TargetPath path) const;
+
+            // Reads the keyframes of the channel's sampler
+            static AnimationCurve ReadCurve(const Document& doc, const GLTFResourceReader& reader, const Animation& animation, const AnimationChannel& channel);
+
+            // Returns the index of the keyframe i such that times[i] <= time < times[i + 1] (clamped to the range [0, count - 2]
+            // or zero if there's only one keyframe). The keyframes adjacent to cursor are checked before a binary search.
+            static size_t FindKeyframe(const std::vector<float>& times, float time, size_t cursor = 0U);
+            static size_t FindKeyframe(const float* times, size_t count, float time, size_t cursor = 0U);
+
+            // Evaluates the curve at the time, writing componentCount floats to output. The cursor is updated to the keyframe
+            // found by FindKeyframe.
+            static void Sample(const AnimationCurve& curve, float time, size_t& cursor, float* output,
+                RotationInterpolation rotationInterpolation = RotationInterpolation::Slerp);
+
+            // Interpolates between two consecutive keyframes, dt apart, at s (in the range [0, 1]). The keyframes are the two
+            // values (2 * componentCount floats) or, for CUBICSPLINE, the in-tangent, value and out-tangent of each keyframe
+            // (6 * componentCount floats).
+            static void Interpolate(TargetPath path, InterpolationType interpolation, size_t componentCount, const float* keyframes, float s, float dt, float* output,
+                RotationInterpolation rotationInterpolation = RotationInterpolation::Slerp);
+
+            // As above but for keyframes in any layout - component c of the keyframes' v-th value is keyframes[v * valueStride +
+            // c * componentStride]. CompiledAnimation uses this to interpolate values that are stored component by component.
+            static void Interpolate(TargetPath path, InterpolationType interpolation, size_t componentCount, const float* keyframes, size_t valueStride,
+                size_t componentStride, float s, float dt, float* output, RotationInterpolation rotationInterpolation = RotationInterpolation::Slerp);
+
+        private:
+            static size_t GetPathIndex(TargetPath path);
+
+            RotationInterpolation m_rotationInterpolation;
+
+            std::vector<std::string> m_nodeIds;
+            std::vector<AnimationCurve> m_curves;
+            std::vector<size_t> m_cursors;
+            std::vector<size_t> m_outputOffsets;
+
+            // The channel indices and output of each target path
+            std::array<std::vector<size_t>, 4> m_pathChannels;
+            std::array<std::vector<float>, 4> m_outputs;
+
+            float m_startTime;
+            float m_endTime;
+        };
+    }
+}
@@ -0,0 +1,48 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/AnimationEvaluator.h>
+
+#include <cstddef>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        class BufferBuilder;
+        class Document;
+        class GLTFResourceReader;
+
+        // Removal of redundant animation keyframes (e.g. from curves baked at a fixed frame rate) and quantization of rotations
+        namespace AnimationOptimizationUtils
+        {
+            struct Options
+            {
+                // The maximum error introduced by removing keyframes, for each target path
+                float translationTolerance = 1.0e-4f; // Distance
+                float rotationTolerance = 1.0e-3f;    // Angle in radians
+                float scaleTolerance = 1.0e-4f;       // Per component difference
+                float weightTolerance = 1.0e-3f;      // Per component difference
+
+                // Writes rotations as normalized SHORT components rather than FLOAT
+                bool quantizeRotations = false;
+            };
+
+            // Returns the tolerance in the options for the target path
+            float GetTolerance(const Options& options, TargetPath path);
+
+            // Returns the curve with every keyframe removed that can be reconstructed, within the tolerance, by evaluating the
+            // remaining keyframes (see AnimationEvaluator::Sample). The first and last keyframes are always kept. CUBICSPLINE
+            // curves are returned unchanged.
+            AnimationCurve ReduceKeyframes(const AnimationCurve& curve, float tolerance);
+
+            // Reduces the keyframes of each of the animation's samplers (using the tolerance for the target path of the first
+            // channel that uses the sampler) and writes the new keyframe times and values with the BufferBuilder, updating the
+            // samplers' accessor ids. Identical keyframe times are only written once. Returns the number of keyframes removed.
+            size_t OptimizeAnimation(const Document& doc, const GLTFResourceReader& reader, Animation& animation, BufferBuilder& bufferBuilder,
+                const Options& options = Options());
+        }
+    }
+}
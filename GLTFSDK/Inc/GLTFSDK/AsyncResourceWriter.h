@@ -0,0 +1,106 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/ResourceWriter.h>
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        // Decorates another ResourceWriter so that writes don't block on I/O. Data written to
+        // buffers (or via WriteExternal) is accumulated into fixed size blocks that are queued
+        // and written to the wrapped ResourceWriter's streams by a background thread.
+        //
+        // At most maxQueuedBlocks blocks are queued at once, when the queue is full writes block
+        // until the background thread has written the oldest block. Errors raised by the background
+        // thread are rethrown by the next write or by Flush.
+        //
+        // Flush must be called once all data has been written, it is the only point at which the
+        // wrapped ResourceWriter's streams are flushed and at which all write errors are reported.
+        // Data that hasn't been flushed when the AsyncResourceWriter is destroyed is still written
+        // (though the wrapped streams aren't flushed) but errors can't be thrown by the destructor,
+        // so an error that was never reported by a write or by Flush fails an assert instead.
+        //
+        // The wrapped ResourceWriter must not be used directly until Flush has been called (e.g.
+        // before calling GLBResourceWriter::Flush) and must not have been written to beforehand.
+        class AsyncResourceWriter : public ResourceWriter
+        {
+        public:
+            static const size_t DefaultBlockByteLength = 4U * 1024U * 1024U;
+            static const size_t DefaultMaxQueuedBlocks = 2U;
+
+            AsyncResourceWriter(std::unique_ptr<ResourceWriter> resourceWriter,
+                size_t blockByteLength = DefaultBlockByteLength,
+                size_t maxQueuedBlocks = DefaultMaxQueuedBlocks);
+            ~AsyncResourceWriter() override;
+
+            std::string GenerateBufferUri(const std::string& bufferId) const override;
+
+            // Queues any partially filled blocks, waits until all queued blocks have been written and then flushes
+            // the wrapped ResourceWriter's streams. Throws a GLTFException if any write failed.
+            void Flush();
+
+            ResourceWriter& GetResourceWriter();
+            const ResourceWriter& GetResourceWriter() const;
+
+        protected:
+            std::ostream*  GetBufferStream(const std::string& bufferId) override;
+            std::streamoff GetBufferOffset(const std::string& bufferId) override;
+            void           SetBufferOffset(const std::string& bufferId, std::streamoff offset) override;
+
+        private:
+            class BlockStream;
+            class BlockStreamBuf;
+            class StreamWriterCache;
+
+            struct Block
+            {
+                const BlockStream* stream;
+                std::vector<char> data;
+            };
+
+            BlockStream& GetStream(std::unordered_map<std::string, std::unique_ptr<BlockStream>>& streams, const std::string& id, bool isExternal);
+
+            std::vector<char> AcquireBlock();
+            void SubmitBlock(const BlockStream& stream, std::vector<char> data);
+            void SubmitBlocks();
+
+            void Run();
+            void WriteBlock(const Block& block);
+            static void WriteBlockData(std::ostream& stream, const std::vector<char>& data);
+            static void FlushStream(std::ostream* stream);
+
+            std::unique_ptr<ResourceWriter> m_resourceWriter;
+
+            const size_t m_blockByteLength;
+            const size_t m_maxQueuedBlocks;
+
+            std::unordered_map<std::string, std::unique_ptr<BlockStream>> m_bufferStreams;
+            std::unordered_map<std::string, std::unique_ptr<BlockStream>> m_externalStreams;
+            std::unordered_map<std::string, std::streamoff> m_streamOffsets;
+
+            std::mutex m_mutex;
+            std::condition_variable m_producerCondition;
+            std::condition_variable m_consumerCondition;
+            std::deque<Block> m_queue;
+            std::vector<std::vector<char>> m_freeBlocks;
+            std::exception_ptr m_error;
+            bool m_errorReported;
+            bool m_busy;
+            bool m_stop;
+
+            std::thread m_thread;
+        };
+    }
+}
@@ -0,0 +1,129 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/Math.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        class Document;
+        class GLTFResourceReader;
+        struct Mesh;
+        struct MeshPrimitive;
+        struct Node;
+        struct Scene;
+
+        namespace PoseUtils
+        {
+            struct NodeHierarchy;
+        }
+
+        // Axis aligned bounding boxes of mesh primitives, meshes, nodes and scenes, and a bounding volume hierarchy of the mesh
+        // instances in a scene for picking and culling
+        namespace BoundsUtils
+        {
+            struct BoundingBox
+            {
+                // Constructs an empty bounding box (min is +infinity and max is -infinity)
+                BoundingBox();
+                BoundingBox(const Vector3& min, const Vector3& max);
+
+                bool IsEmpty() const;
+
+                Vector3 GetCenter() const;
+                float GetSurfaceArea() const; // Zero if the bounding box is empty
+
+                void Merge(const Vector3& point);
+                void Merge(const BoundingBox& other);
+
+                bool Intersects(const BoundingBox& other) const;
+
+                bool operator==(const BoundingBox& other) const;
+                bool operator!=(const BoundingBox& other) const;
+
+                Vector3 min;
+                Vector3 max;
+            };
+
+            // Returns the bounding box of the transformed bounding box
+            BoundingBox Transform(const BoundingBox& boundingBox, const Matrix4& matrix);
+
+            // Returns the bounding box of count points (three floats each)
+            BoundingBox ComputeBounds(const float* positions, size_t count);
+
+            // Returns the bounding box of the mesh primitive's POSITION accessor, using the accessor's min and max values if it
+            // has them (and its components are floats). Morph target displacements are included, assuming weights in [0, 1].
+            // Skinning is not taken into account.
+            BoundingBox GetBounds(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive);
+            BoundingBox GetBounds(const Document& doc, const GLTFResourceReader& reader, const Mesh& mesh);
+
+            // Returns the transform of the node relative to its parent, from either its matrix or its TRS properties
+            Matrix4 GetLocalTransform(const Node& node);
+
+            // Returns the transform of the node relative to the scene root, by following the node's ancestors. Each call builds
+            // the document's node hierarchy, which is linear in the number of nodes - to find the world transforms of many nodes
+            // compute the hierarchy once with PoseUtils::GetNodeHierarchy and use the overload below.
+            Matrix4 GetWorldTransform(const Document& doc, const std::string& nodeId);
+            Matrix4 GetWorldTransform(const Document& doc, const PoseUtils::NodeHierarchy& hierarchy, const std::string& nodeId);
+
+            // A node with a mesh, along with its world transform and the world space bounding box of its mesh
+            struct MeshInstance
+            {
+                std::string nodeId;
+                std::string meshId;
+                Matrix4 worldTransform;
+                BoundingBox bounds;
+            };
+
+            // Returns every mesh instance in the scene, in depth first order. The bounds of each mesh are only computed once.
+            std::vector<MeshInstance> GetMeshInstances(const Document& doc, const GLTFResourceReader& reader, const Scene& scene);
+
+            // Returns the world space bounding box of every mesh in the scene
+            BoundingBox GetSceneBounds(const Document& doc, const GLTFResourceReader& reader, const Scene& scene);
+
+            // Returns the world space bounding box of every mesh in the node's subtree
+            BoundingBox GetNodeBounds(const Document& doc, const GLTFResourceReader& reader, const std::string& nodeId);
+
+            // A node of a bounding volume hierarchy. Interior nodes have an itemCount of zero, their first child immediately
+            // follows them and offset is the index of their second child. Leaf nodes reference itemCount items starting at
+            // offset in Bvh::items.
+            struct BvhNode
+            {
+                BoundingBox bounds;
+                uint32_t offset;
+                uint32_t itemCount;
+
+                bool IsLeaf() const { return itemCount != 0U; }
+            };
+
+            struct Bvh
+            {
+                std::vector<BvhNode> nodes; // The first node is the root (if there are any items)
+                std::vector<uint32_t> items; // Indices into the bounding boxes the hierarchy was built from
+                std::vector<BoundingBox> itemBounds; // The bounding boxes the hierarchy was built from
+            };
+
+            constexpr size_t DefaultMaxLeafSize = 4U;
+
+            // Builds a bounding volume hierarchy by recursively splitting the items where the surface area heuristic, evaluated
+            // at a fixed number of bins along each axis, is lowest. Empty bounding boxes are excluded.
+            Bvh BuildBvh(const std::vector<BoundingBox>& bounds, size_t maxLeafSize = DefaultMaxLeafSize);
+            Bvh BuildBvh(const std::vector<MeshInstance>& meshInstances, size_t maxLeafSize = DefaultMaxLeafSize);
+
+            // Returns the items whose bounding boxes intersect the bounding box
+            std::vector<uint32_t> QueryBvh(const Bvh& bvh, const BoundingBox& boundingBox);
+
+            // Returns the items whose bounding boxes the ray (from origin, through origin + direction) intersects, ordered by
+            // the distance along the ray at which it enters the bounding box
+            std::vector<uint32_t> QueryBvh(const Bvh& bvh, const Vector3& origin, const Vector3& direction);
+        }
+    }
+}
@@ -5,7 +5,9 @@
 
 #include <GLTFSDK/GLTF.h>
 
+#include <array>
 #include <functional>
+#include <unordered_map>
 
 namespace Microsoft
 {
@@ -49,6 +51,11 @@ namespace Microsoft
             const BufferView& AddBufferView(BufferViewTarget target);
             const BufferView& AddBufferView(const void* data, size_t byteLength, size_t byteStride = 0, BufferViewTarget target = BufferViewTarget::UNKNOWN_BUFFER);
 
+            // Streams byteLength bytes into a new buffer view (e.g. to embed an image file in a GLB's BIN chunk). Streamed
+            // buffer views are never deduplicated as that would require their contents to be held in memory. Throws a
+            // GLTFException if fewer than byteLength bytes can be read, in which case no buffer view is added.
+            const BufferView& AddBufferView(std::istream& stream, size_t byteLength, size_t byteStride = 0, BufferViewTarget target = BufferViewTarget::UNKNOWN_BUFFER);
+
             template<typename T>
             const BufferView& AddBufferView(const std::vector<T>& data, size_t byteStride = 0, BufferViewTarget target = BufferViewTarget::UNKNOWN_BUFFER)
             {
@@ -70,12 +77,29 @@ namespace Microsoft
                 return AddAccessor(data.data(), data.size() / accessorTypeSize, std::move(accessorDesc));
             }
 
+            // Adds an index accessor to the current buffer view using the narrowest component type able to represent the indices.
+            // The maximum value of each component type is reserved for primitive restart so e.g. uint8 indices must be less than 255.
+            const Accessor& AddIndicesAccessor(const uint32_t* indices, size_t count);
+
+            const Accessor& AddIndicesAccessor(const std::vector<uint32_t>& indices)
+            {
+                return AddIndicesAccessor(indices.data(), indices.size());
+            }
+
+            // As above but with a component type already returned by GetIndicesComponentType, so the indices aren't searched again
+            const Accessor& AddIndicesAccessor(const uint32_t* indices, size_t count, ComponentType componentType);
+
+            // Returns the narrowest component type able to represent the indices (as used by AddIndicesAccessor)
+            static ComponentType GetIndicesComponentType(const uint32_t* indices, size_t count);
+
             void AddAccessors(const void* data, size_t count, size_t byteStride, const AccessorDesc* pDescs, size_t descCount, std::string* pOutIds = nullptr);
 
             void Output(Document& gltfDocument);
 
             const Buffer&     GetCurrentBuffer() const;
+            // Returns the buffer view most recently returned by AddBufferView or used by an accessor returned by AddAccessor
             const BufferView& GetCurrentBufferView() const;
+            // Returns the accessor most recently returned by AddAccessor (i.e. the existing accessor when it was deduplicated)
             const Accessor&   GetCurrentAccessor() const;
 
             size_t GetBufferCount() const;
@@ -85,8 +109,52 @@ namespace Microsoft
             ResourceWriter& GetResourceWriter();
             const ResourceWriter& GetResourceWriter() const;
 
+            // When deduplication is enabled, the payloads passed to AddBufferView and to AddAccessor (when it is the first
+            // accessor written to the current buffer view) are identified by a 128-bit content hash. Payloads that match a
+            // previously written buffer view or accessor are not written again and the existing element is returned instead.
+            // A payload with a matching hash is also compared byte for byte with a copy retained when the existing element was
+            // written, so a copy of every unique payload is held in memory until Output is called. A buffer view left empty
+            // because its accessor was deduplicated is reused by the next buffer view added, or dropped by Output.
+            void SetDeduplication(bool enabled);
+            bool GetDeduplication() const;
+
+            // The number of bytes that deduplication avoided writing to the ResourceWriter
+            size_t GetDeduplicatedByteLength() const;
+
         private:
+            struct ContentKey
+            {
+                std::array<uint64_t, 2> hash;
+                size_t byteLength;
+                size_t byteStride;
+                BufferViewTarget target;
+
+                bool operator==(const ContentKey& other) const;
+            };
+
+            struct ContentKeyHash
+            {
+                size_t operator()(const ContentKey& key) const;
+            };
+
+            struct ContentEntry
+            {
+                std::vector<uint8_t> content;
+                std::string id;
+            };
+
+            typedef std::unordered_multimap<ContentKey, ContentEntry, ContentKeyHash> ContentMap;
+
+            // Returns the id of the element whose retained content matches descBytes followed by the data, or nullptr if there is none
+            static const std::string* FindContent(const ContentMap& contentMap, const ContentKey& key, const void* data, size_t byteLength, const std::vector<uint8_t>& descBytes = {});
+
+            // Appends a buffer view at the end of the current buffer and extends the buffer's length to include it (reusing an unused buffer view)
+            const BufferView& AppendBufferView(size_t byteLength, size_t byteStride, BufferViewTarget target);
+            typedef std::function<void(const BufferView&, const Accessor&)> FnWrite;
+
             const Accessor& AddAccessor(size_t count, AccessorDesc desc);
+            // The content (used to identify the accessor when deduplicating) is written to the buffer view by fnWrite
+            const Accessor& AddAccessor(const void* content, size_t contentByteLength, size_t count, AccessorDesc desc, const FnWrite& fnWrite);
 
             std::unique_ptr<ResourceWriter> m_resourceWriter;
 
@@ -97,6 +165,16 @@ namespace Microsoft
             FnGenId m_fnGenBufferId;
             FnGenId m_fnGenBufferViewId;
             FnGenId m_fnGenAccessorId;
+
+            bool m_deduplication;
+            size_t m_deduplicatedByteLength;
+
+            bool m_isCurrentBufferViewUnused;
+            std::string m_currentBufferViewId;
+            std::string m_currentAccessorId;
+
+            ContentMap m_bufferViewsByContent;
+            ContentMap m_accessorsByContent;
         };
     }
 }
@@ -0,0 +1,86 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/AnimationEvaluator.h>
+
+#include <string>
+#include <vector>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        class Document;
+        class GLTFResourceReader;
+
+        // An animation with every sampler decoded once into contiguous float arrays. Keyframe times are stored as time tracks
+        // that are shared by all the samplers with identical times, and the values of each sampler are stored component by
+        // component (structure of arrays). A CompiledAnimation is immutable once constructed - the playback state (a cursor
+        // per channel) is owned by the caller so a single instance can be sampled concurrently by any number of threads.
+        class CompiledAnimation
+        {
+        public:
+            struct Channel
+            {
+                std::string nodeId;
+                TargetPath path;
+                InterpolationType interpolation;
+
+                size_t componentCount;
+                size_t timeTrack;
+
+                // The values of component c of keyframe k (or, for CUBICSPLINE, the in-tangent, value and out-tangent of
+                // keyframe k for v = 0, 1 and 2) are at GetValues()[valueOffset + c * valueCount + k * valuesPerKeyframe + v]
+                size_t valueOffset;
+                size_t valueCount;
+
+                // The offset of the channel's values in the output of Evaluate
+                size_t outputOffset;
+            };
+
+            CompiledAnimation(const Document& doc, const GLTFResourceReader& reader, const Animation& animation);
+
+            size_t GetChannelCount() const;
+            const Channel& GetChannel(size_t channelIndex) const;
+
+            size_t GetTimeTrackCount() const;
+            size_t GetKeyframeCount(size_t timeTrack) const;
+            const float* GetTimes(size_t timeTrack) const;
+
+            const std::vector<float>& GetValues() const;
+
+            // The total number of floats written by Evaluate
+            size_t GetOutputSize() const;
+
+            // The earliest and latest keyframe times of all the channels
+            float GetStartTime() const;
+            float GetEndTime() const;
+
+            // Evaluates a channel at the time, clamping to its first and last keyframes, and writes componentCount floats to
+            // output. The cursor is the caller's playback state for the channel (see AnimationEvaluator::FindKeyframe).
+            void Sample(size_t channelIndex, float time, size_t& cursor, float* output,
+                RotationInterpolation rotationInterpolation = RotationInterpolation::Slerp) const;
+
+            // Evaluates every channel at the time, writing GetOutputSize() floats to output with each channel's values at its
+            // outputOffset. The cursors are resized to the channel count if necessary.
+            void Evaluate(float time, std::vector<size_t>& cursors, float* output,
+                RotationInterpolation rotationInterpolation = RotationInterpolation::Slerp) const;
+
+        private:
+            std::vector<Channel> m_channels;
+
+            std::vector<float> m_times;
+            std::vector<size_t> m_timeTrackOffsets;
+            std::vector<size_t> m_timeTrackCounts;
+
+            std::vector<float> m_values;
+
+            size_t m_outputSize;
+
+            float m_startTime;
+            float m_endTime;
+        };
+    }
+}
@@ -0,0 +1,32 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/GLTF.h>
+
+#include <cstdint>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        // Conversion of raw accessor component data (as read from a buffer) to the formats typically consumed by renderers.
+        // Each function converts an entire array of components in a single pass, using SIMD instructions where available.
+        namespace ConversionUtils
+        {
+            // Converts count components to floats. Normalized components are converted as defined by the glTF 2.0 spec (the
+            // same as AnimationUtils::ComponentToFloat) while unnormalized components are converted as if by static_cast.
+            void ToFloat(const void* components, ComponentType componentType, bool normalized, float* output, size_t count);
+
+            // Converts count normalized components (unsigned byte, unsigned short or float) to 8-bit or 16-bit unsigned
+            // normalized values, rounding to nearest. Float components are clamped to the range [0, 1].
+            void ToUnorm8(const void* components, ComponentType componentType, uint8_t* output, size_t count);
+            void ToUnorm16(const void* components, ComponentType componentType, uint16_t* output, size_t count);
+
+            // Converts count elements, each of three or four normalized components, to RGBA values packed into a uint32_t (with
+            // red in the least significant byte). Elements with three components are assigned an alpha value of 255.
+            void ToRGBA8(const void* components, ComponentType componentType, size_t componentCount, uint32_t* output, size_t count);
+        }
+    }
+}
@@ -0,0 +1,44 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/ExtensionHandlers.h>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace EXT
+        {
+            ExtensionSerializer   GetEXTExtensionSerializer();
+            ExtensionDeserializer GetEXTExtensionDeserializer();
+
+            namespace Nodes
+            {
+                constexpr const char* MESH_GPU_INSTANCING_NAME = "EXT_mesh_gpu_instancing";
+
+                constexpr const char* ACCESSOR_TRANSLATION = "TRANSLATION";
+                constexpr const char* ACCESSOR_ROTATION    = "ROTATION";
+                constexpr const char* ACCESSOR_SCALE       = "SCALE";
+
+                // EXT_mesh_gpu_instancing - the extended node's mesh is drawn once per instance, with the instance's TRS
+                // applied before the node's own transform. Each attribute is an accessor with one element per instance.
+                struct MeshGpuInstancing : Extension, glTFProperty
+                {
+                    std::unordered_map<std::string, std::string> attributes;
+
+                    std::unique_ptr<Extension> Clone() const override;
+                    bool IsEqual(const Extension& rhs) const override;
+                };
+
+                std::string SerializeMeshGpuInstancing(const MeshGpuInstancing& meshGpuInstancing, const Document& gltfDocument, const ExtensionSerializer& extensionSerializer);
+                std::unique_ptr<Extension> DeserializeMeshGpuInstancing(const std::string& json, const ExtensionDeserializer& extensionDeserializer);
+            }
+        }
+    }
+}
@@ -69,6 +69,11 @@ namespace Microsoft
 
                 std::string SerializeDracoMeshCompression(const DracoMeshCompression& dracoMeshCompression, const Document& gltfDocument, const ExtensionSerializer& extensionSerializer);
                 std::unique_ptr<Extension> DeserializeDracoMeshCompression(const std::string& json, const ExtensionDeserializer& extensionDeserializer);
+
+                constexpr const char* MESHQUANTIZATION_NAME = "KHR_mesh_quantization";
+
+                // KHR_mesh_quantization has no extension object, it is only declared via extensionsUsed and extensionsRequired
+                // (see QuantizationUtils::AddExtension). Declaring it permits quantized vertex attribute component types.
             }
 
             namespace TextureInfos
@@ -0,0 +1,64 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/ExtensionHandlers.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace MSFT
+        {
+            ExtensionSerializer   GetMSFTExtensionSerializer();
+            ExtensionDeserializer GetMSFTExtensionDeserializer();
+
+            constexpr const char* LOD_NAME = "MSFT_lod";
+
+            // MSFT_lod - the ids of the nodes or materials that are progressively lower levels of detail of the extended node or
+            // material. The extension applies to both, so unlike the other extensions it isn't scoped to a property namespace.
+            struct Lod : Extension, glTFProperty
+            {
+                std::vector<std::string> ids;
+
+                std::unique_ptr<Extension> Clone() const override;
+                bool IsEqual(const Extension& rhs) const override;
+            };
+
+            std::string SerializeNodeLod(const Lod& lod, const Document& gltfDocument, const ExtensionSerializer& extensionSerializer);
+            std::string SerializeMaterialLod(const Lod& lod, const Document& gltfDocument, const ExtensionSerializer& extensionSerializer);
+            std::unique_ptr<Extension> DeserializeLod(const std::string& json, const ExtensionDeserializer& extensionDeserializer);
+
+            namespace MeshPrimitives
+            {
+                constexpr const char* MESHLETS_NAME = "MSFT_meshlets";
+
+                // MSFT_meshlets - partitions a triangle list primitive into clusters (meshlets) that can be culled independently.
+                // See MeshletUtils for the layout of the data referenced by each accessor.
+                struct Meshlets : Extension, glTFProperty
+                {
+                    Meshlets();
+
+                    size_t maxVertices;
+                    size_t maxTriangles;
+
+                    std::string meshletsAccessorId;
+                    std::string verticesAccessorId;
+                    std::string trianglesAccessorId;
+                    std::string boundsAccessorId;
+
+                    std::unique_ptr<Extension> Clone() const override;
+                    bool IsEqual(const Extension& rhs) const override;
+                };
+
+                std::string SerializeMeshlets(const Meshlets& meshlets, const Document& gltfDocument, const ExtensionSerializer& extensionSerializer);
+                std::unique_ptr<Extension> DeserializeMeshlets(const std::string& json, const ExtensionDeserializer& extensionDeserializer);
+            }
+        }
+    }
+}
@@ -0,0 +1,76 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/Document.h>
+#include <GLTFSDK/PoseUtils.h>
+
+#include <limits>
+#include <vector>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        // The node hierarchy of a scene stored as contiguous arrays in depth first order. Each node's descendants immediately
+        // follow it, so traversals, transform propagation and subtree queries are linear scans rather than walks that look
+        // up each child by id. Nodes are identified by their position in this order (the 'flat index') and the nodes' index
+        // in Document.nodes is available from GetNodeIndex.
+        class FlatSceneGraph
+        {
+        public:
+            static constexpr size_t NoParent = std::numeric_limits<size_t>::max();
+            static constexpr size_t NotInScene = std::numeric_limits<size_t>::max();
+
+            // Flattens the document's default scene. Throws a GLTFException if a node is reachable more than once.
+            explicit FlatSceneGraph(const Document& doc);
+            FlatSceneGraph(const Document& doc, const Scene& scene);
+
+            // Flattens the scene using the document's hierarchy from PoseUtils::GetNodeHierarchy, which can be shared when
+            // flattening several scenes
+            FlatSceneGraph(const Document& doc, const Scene& scene, const PoseUtils::NodeHierarchy& hierarchy);
+
+            size_t GetNodeCount() const;
+
+            size_t GetNodeIndex(size_t flatIndex) const;
+            size_t GetParent(size_t flatIndex) const;
+            size_t GetSubtreeSize(size_t flatIndex) const; // Including the node itself
+            size_t GetDepth(size_t flatIndex) const;       // Zero for the scene's root nodes
+
+            // Returns the flat index of the node with the index in Document.nodes, or NotInScene if it isn't in the scene
+            size_t GetFlatIndex(size_t nodeIndex) const;
+
+            bool IsAncestor(size_t ancestor, size_t descendant) const;
+
+            const std::vector<size_t>& GetNodeIndices() const;
+            const std::vector<size_t>& GetParents() const;
+            const std::vector<size_t>& GetSubtreeSizes() const;
+
+            // Returns the local transform of each node in flat order
+            std::vector<Matrix4> GetLocalTransforms(const Document& doc) const;
+
+            // Computes the world transform of each node from the local transforms, both in flat order
+            void ComputeWorldTransforms(const Matrix4* localTransforms, Matrix4* worldTransforms) const;
+
+            // Calls fn(const Node& node, const Node* parent) for each node in depth first order, as Traverse does
+            template<typename Fn>
+            void Traverse(const Document& doc, Fn&& fn) const
+            {
+                for (size_t i = 0U; i < m_nodeIndices.size(); ++i)
+                {
+                    const size_t parent = m_parents[i];
+
+                    fn(doc.nodes[m_nodeIndices[i]], parent == NoParent ? nullptr : &doc.nodes[m_nodeIndices[parent]]);
+                }
+            }
+
+        private:
+            std::vector<size_t> m_nodeIndices;
+            std::vector<size_t> m_parents;
+            std::vector<size_t> m_subtreeSizes;
+            std::vector<size_t> m_depths;
+            std::vector<size_t> m_flatIndices;
+        };
+    }
+}
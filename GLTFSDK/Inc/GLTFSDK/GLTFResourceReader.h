@@ -8,9 +8,11 @@
 #include <GLTFSDK/ResourceReaderUtils.h>
 #include <GLTFSDK/StreamCacheLRU.h>
 #include <GLTFSDK/StreamUtils.h>
+#include <GLTFSDK/StridedSpan.h>
 #include <GLTFSDK/Validation.h>
 
 #include <cassert>
+#include <cstring>
 
 namespace Microsoft
 {
@@ -69,45 +71,86 @@ namespace Microsoft
             template<typename T>
             std::vector<T> ReadBinaryData(const Document& gltfDocument, const Accessor& accessor) const
             {
-                bool isValid;
+                ValidateAccessor<T>(gltfDocument, accessor);
 
-                switch (accessor.componentType)
+                std::vector<T> data(accessor.count * Accessor::GetTypeCount(accessor.type));
+
+                if (accessor.sparse.count > 0U)
                 {
-                case COMPONENT_BYTE:
-                    isValid = std::is_same<T, int8_t>::value;
-                    break;
-                case COMPONENT_UNSIGNED_BYTE:
-                    isValid = std::is_same<T, uint8_t>::value;
-                    break;
-                case COMPONENT_SHORT:
-                    isValid = std::is_same<T, int16_t>::value;
-                    break;
-                case COMPONENT_UNSIGNED_SHORT:
-                    isValid = std::is_same<T, uint16_t>::value;
-                    break;
-                case COMPONENT_UNSIGNED_INT:
-                    isValid = std::is_same<T, uint32_t>::value;
-                    break;
-                case COMPONENT_FLOAT:
-                    isValid = std::is_same<T, float>::value;
-                    break;
-                default:
-                    throw GLTFException("Unsupported accessor ComponentType");
+                    ReadSparseAccessor<T>(gltfDocument, accessor, StridedSpan<T>(data.data(), accessor.count));
+                }
+                else
+                {
+                    ReadAccessor<T>(gltfDocument, accessor, StridedSpan<T>(data.data(), accessor.count));
                 }
 
-                if (!isValid)
+                return data;
+            }
+
+            // Reads the accessor's elements directly into caller-provided memory. The output must have room for at least
+            // accessor.count elements and its byte stride (if non-zero) must be at least as large as an accessor element.
+            template<typename T>
+            void ReadBinaryData(const Document& gltfDocument, const Accessor& accessor, StridedSpan<T> output) const
+            {
+                ValidateAccessor<T>(gltfDocument, accessor);
+
+                const size_t elementSize = sizeof(T) * Accessor::GetTypeCount(accessor.type);
+
+                if (output.count < accessor.count)
                 {
-                    throw GLTFException("ReadAccessorData: Template type T does not match accessor ComponentType");
+                    throw GLTFException("The output span has fewer elements than accessor " + accessor.id);
                 }
 
-                Validation::ValidateAccessor(gltfDocument, accessor);
+                if (output.GetByteStride(elementSize) < elementSize)
+                {
+                    throw GLTFException("The output span's byte stride is less than the element size of accessor " + accessor.id);
+                }
 
                 if (accessor.sparse.count > 0U)
                 {
-                    return ReadSparseAccessor<T>(gltfDocument, accessor);
+                    ReadSparseAccessor<T>(gltfDocument, accessor, output);
                 }
+                else
+                {
+                    ReadAccessor<T>(gltfDocument, accessor, output);
+                }
+            }
+
+            // Reads the accessor's elements a chunk at a time, calling fnChunk(components, firstElement, elementCount) with each
+            // chunk's tightly packed components, so that data converted as it is read never needs a copy of the whole accessor.
+            // Sparse accessors are read in full (substituted elements may be anywhere) and passed to fnChunk as a single chunk.
+            template<typename T, typename TFnChunk>
+            void ReadBinaryDataChunked(const Document& gltfDocument, const Accessor& accessor, TFnChunk fnChunk) const
+            {
+                if (accessor.sparse.count > 0U)
+                {
+                    const std::vector<T> data = ReadBinaryData<T>(gltfDocument, accessor);
+                    fnChunk(data.data(), size_t(0U), accessor.count);
+                    return;
+                }
+
+                ValidateAccessor<T>(gltfDocument, accessor);
+
+                const BufferView& bufferView = gltfDocument.bufferViews.Get(accessor.bufferViewId);
+                const Buffer& buffer = gltfDocument.buffers.Get(bufferView.bufferId);
+
+                const auto typeCount = Accessor::GetTypeCount(accessor.type);
+                const size_t elementSize = sizeof(T) * typeCount;
+                const size_t stride = (bufferView.byteStride == 0U) ? elementSize : bufferView.byteStride;
+                const size_t chunkElementCount = std::max<size_t>(1U, std::min<size_t>(accessor.count, (64U * 1024U) / elementSize));
 
-                return ReadAccessor<T>(gltfDocument, accessor);
+                std::vector<T> chunk(chunkElementCount * typeCount);
+                std::streamoff offset = accessor.byteOffset + bufferView.byteOffset;
+
+                for (size_t i = 0U; i < accessor.count; i += chunkElementCount)
+                {
+                    const size_t count = std::min(chunkElementCount, accessor.count - i);
+
+                    ReadBinaryData<T>(buffer, offset, count, typeCount, bufferView.byteStride, StridedSpan<T>(chunk.data(), count));
+                    fnChunk(static_cast<const T*>(chunk.data()), i, count);
+
+                    offset += count * stride;
+                }
             }
 
             template<typename T>
@@ -127,75 +170,62 @@ namespace Microsoft
             template<typename T>
             std::vector<T> ReadAccessor(const Document& gltfDocument, const Accessor& accessor) const
             {
-                const auto typeCount = Accessor::GetTypeCount(accessor.type);
-                const auto elementSize = sizeof(T) * typeCount;
-
-                std::vector<T> data;
+                std::vector<T> data(accessor.count * Accessor::GetTypeCount(accessor.type));
+                ReadAccessor<T>(gltfDocument, accessor, StridedSpan<T>(data.data(), accessor.count));
+                return data;
+            }
 
+            template<typename T>
+            void ReadAccessor(const Document& gltfDocument, const Accessor& accessor, StridedSpan<T> output) const
+            {
                 const BufferView& bufferView = gltfDocument.bufferViews.Get(accessor.bufferViewId);
                 const Buffer& buffer = gltfDocument.buffers.Get(bufferView.bufferId);
 
                 const size_t offset = accessor.byteOffset + bufferView.byteOffset;
 
-                if (bufferView.byteStride == 0U ||
-                    bufferView.byteStride == elementSize)
-                {
-                    data = ReadBinaryData<T>(buffer, offset, accessor.count * typeCount);
-                }
-                else
-                {
-                    data = ReadBinaryDataInterleaved<T>(buffer, offset, accessor.count, typeCount, bufferView.byteStride);
-                }
+                ReadBinaryData<T>(buffer, offset, accessor.count, Accessor::GetTypeCount(accessor.type), bufferView.byteStride, output);
+            }
 
+            template<typename T>
+            std::vector<T> ReadSparseAccessor(const Document& gltfDocument, const Accessor& accessor) const
+            {
+                std::vector<T> data(accessor.count * Accessor::GetTypeCount(accessor.type));
+                ReadSparseAccessor<T>(gltfDocument, accessor, StridedSpan<T>(data.data(), accessor.count));
                 return data;
             }
 
             template<typename T>
-            std::vector<T> ReadSparseAccessor(const Document& gltfDocument, const Accessor& accessor) const
+            void ReadSparseAccessor(const Document& gltfDocument, const Accessor& accessor, StridedSpan<T> output) const
             {
                 const auto typeCount = Accessor::GetTypeCount(accessor.type);
                 const auto elementSize = sizeof(T) * typeCount;
 
-                std::vector<T> baseData;
-
                 if (accessor.bufferViewId.empty())
                 {
-                    baseData.resize(typeCount * accessor.count, T());
+                    for (size_t i = 0; i < accessor.count; i++)
+                    {
+                        std::fill_n(output.GetElement(i, elementSize), typeCount, T());
+                    }
                 }
                 else
                 {
-                    const BufferView& bufferView = gltfDocument.bufferViews.Get(accessor.bufferViewId);
-                    const Buffer& buffer = gltfDocument.buffers.Get(bufferView.bufferId);
-
-                    const size_t offset = accessor.byteOffset + bufferView.byteOffset;
-
-                    if (bufferView.byteStride == 0U ||
-                        bufferView.byteStride == elementSize)
-                    {
-                        baseData = ReadBinaryData<T>(buffer, offset, accessor.count * typeCount);
-                    }
-                    else
-                    {
-                        baseData = ReadBinaryDataInterleaved<T>(buffer, offset, accessor.count, typeCount, bufferView.byteStride);
-                    }
+                    ReadAccessor<T>(gltfDocument, accessor, output);
                 }
 
                 switch (accessor.sparse.indicesComponentType)
                 {
                 case COMPONENT_UNSIGNED_BYTE:
-                    ReadSparseBinaryData<T, uint8_t>(gltfDocument, baseData, accessor);
+                    ReadSparseBinaryData<T, uint8_t>(gltfDocument, accessor, output);
                     break;
                 case COMPONENT_UNSIGNED_SHORT:
-                    ReadSparseBinaryData<T, uint16_t>(gltfDocument, baseData, accessor);
+                    ReadSparseBinaryData<T, uint16_t>(gltfDocument, accessor, output);
                     break;
                 case COMPONENT_UNSIGNED_INT:
-                    ReadSparseBinaryData<T, uint32_t>(gltfDocument, baseData, accessor);
+                    ReadSparseBinaryData<T, uint32_t>(gltfDocument, accessor, output);
                     break;
                 default:
                     throw GLTFException("Unsupported sparse indices ComponentType");
                 }
-
-                return baseData;
             }
 
             virtual std::shared_ptr<std::istream> GetBinaryStream(const Buffer& buffer) const
@@ -285,40 +315,62 @@ namespace Microsoft
             }
 
             template<typename T>
-            std::vector<T> ReadBinaryData(const Buffer& buffer, std::streamoff offset, size_t componentCount) const
+            void ValidateAccessor(const Document& gltfDocument, const Accessor& accessor) const
             {
-                std::vector<T> data;
-
-                std::string::const_iterator itBegin;
-                std::string::const_iterator itEnd;
+                bool isValid;
 
-                if (IsUriBase64(buffer.uri, itBegin, itEnd))
+                switch (accessor.componentType)
                 {
-                    data = ReadBinaryDataUri<T>({ itBegin, itEnd }, &offset, &componentCount);
+                case COMPONENT_BYTE:
+                    isValid = std::is_same<T, int8_t>::value;
+                    break;
+                case COMPONENT_UNSIGNED_BYTE:
+                    isValid = std::is_same<T, uint8_t>::value;
+                    break;
+                case COMPONENT_SHORT:
+                    isValid = std::is_same<T, int16_t>::value;
+                    break;
+                case COMPONENT_UNSIGNED_SHORT:
+                    isValid = std::is_same<T, uint16_t>::value;
+                    break;
+                case COMPONENT_UNSIGNED_INT:
+                    isValid = std::is_same<T, uint32_t>::value;
+                    break;
+                case COMPONENT_FLOAT:
+                    isValid = std::is_same<T, float>::value;
+                    break;
+                default:
+                    throw GLTFException("Unsupported accessor ComponentType");
                 }
-                else
-                {
-                    data.resize(componentCount);
-
-                    auto bufferStream = GetBinaryStream(buffer);
-                    auto bufferStreamPos = GetBinaryStreamPos(buffer);
 
-                    bufferStream->seekg(bufferStreamPos);
-                    bufferStream->seekg(offset, std::ios_base::cur);
-
-                    StreamUtils::ReadBinary(*bufferStream, reinterpret_cast<char*>(data.data()), componentCount * sizeof(T));
+                if (!isValid)
+                {
+                    throw GLTFException("ReadAccessorData: Template type T does not match accessor ComponentType");
                 }
 
+                Validation::ValidateAccessor(gltfDocument, accessor);
+            }
+
+            template<typename T>
+            std::vector<T> ReadBinaryData(const Buffer& buffer, std::streamoff offset, size_t componentCount) const
+            {
+                std::vector<T> data(componentCount);
+                ReadBinaryData<T>(buffer, offset, componentCount, 1U, 0U, StridedSpan<T>(data.data(), componentCount));
                 return data;
             }
 
+            // Reads elementCount elements, each of typeCount components, that are byteStride bytes apart in the buffer
+            // (zero meaning tightly packed) into the output span, which may use a different stride.
             template<typename T>
-            std::vector<T> ReadBinaryDataInterleaved(const Buffer& buffer, std::streamoff offset, size_t elementCount, uint8_t typeCount, size_t stride) const
+            void ReadBinaryData(const Buffer& buffer, std::streamoff offset, size_t elementCount, uint8_t typeCount, size_t byteStride, StridedSpan<T> output) const
             {
                 const size_t elementSize = sizeof(T) * typeCount;
-                const size_t componentCount = elementCount * typeCount;
+                const size_t stride = (byteStride == 0U) ? elementSize : byteStride;
 
-                std::vector<T> data(componentCount);
+                if (elementCount == 0U)
+                {
+                    return;
+                }
 
                 std::string::const_iterator itBegin;
                 std::string::const_iterator itEnd;
@@ -327,9 +379,16 @@ namespace Microsoft
                 {
                     Base64StringView encodedData(itBegin, itEnd);
 
-                    for (size_t componentsRead = 0U; componentsRead < componentCount; componentsRead += typeCount, offset += stride)
+                    if (stride == elementSize && output.IsPacked(elementSize))
+                    {
+                        ReadBinaryDataUri(encodedData, Base64BufferView(output.data, elementCount * elementSize), &offset);
+                    }
+                    else
                     {
-                        ReadBinaryDataUri(encodedData, Base64BufferView(data.data() + componentsRead, elementSize), &offset);
+                        for (size_t i = 0U; i < elementCount; ++i, offset += stride)
+                        {
+                            ReadBinaryDataUri(encodedData, Base64BufferView(output.GetElement(i, elementSize), elementSize), &offset);
+                        }
                     }
                 }
                 else
@@ -337,20 +396,38 @@ namespace Microsoft
                     auto bufferStream = GetBinaryStream(buffer);
                     auto bufferStreamPos = GetBinaryStreamPos(buffer) + offset;
 
-                    for (size_t componentsRead = 0U; componentsRead < componentCount; componentsRead += typeCount)
+                    if (stride == elementSize && output.IsPacked(elementSize))
                     {
                         bufferStream->seekg(bufferStreamPos);
-                        bufferStreamPos += stride;
 
-                        StreamUtils::ReadBinary(*bufferStream, reinterpret_cast<char*>(data.data() + componentsRead), elementSize);
+                        StreamUtils::ReadBinary(*bufferStream, reinterpret_cast<char*>(output.data), elementCount * elementSize);
                     }
-                }
+                    else
+                    {
+                        // Source data is read in chunks (spanning the source stride) and then gathered from the chunk and scattered
+                        // to the strided output, this avoids one stream read per element
+                        const size_t chunkElementCount = std::max<size_t>(1U, std::min<size_t>(elementCount, (64U * 1024U) / stride));
+                        std::vector<uint8_t> chunk((chunkElementCount - 1U) * stride + elementSize);
 
-                return data;
+                        for (size_t i = 0U; i < elementCount; i += chunkElementCount)
+                        {
+                            const size_t count = std::min(chunkElementCount, elementCount - i);
+
+                            bufferStream->seekg(bufferStreamPos + static_cast<std::streamoff>(i * stride));
+
+                            StreamUtils::ReadBinary(*bufferStream, reinterpret_cast<char*>(chunk.data()), (count - 1U) * stride + elementSize);
+
+                            for (size_t j = 0U; j < count; ++j)
+                            {
+                                std::memcpy(output.GetElement(i + j, elementSize), chunk.data() + j * stride, elementSize);
+                            }
+                        }
+                    }
+                }
             }
 
             template<typename T, typename I>
-            void ReadSparseBinaryData(const Document& gltfDocument, std::vector<T>& baseData, const Accessor& accessor) const
+            void ReadSparseBinaryData(const Document& gltfDocument, const Accessor& accessor, StridedSpan<T> output) const
             {
                 const auto typeCount = Accessor::GetTypeCount(accessor.type);
                 const auto elementSize = sizeof(T) * typeCount;
@@ -365,36 +442,21 @@ namespace Microsoft
                 const Buffer& valuesBuffer = gltfDocument.buffers.Get(valuesBufferView.bufferId);
                 const size_t valuesOffset = accessor.sparse.valuesByteOffset + valuesBufferView.byteOffset;
 
-                std::vector<I> indices;
+                std::vector<I> indices(count);
+                ReadBinaryData<I>(indicesBuffer, indicesOffset, count, 1U, indicesBufferView.byteStride, StridedSpan<I>(indices.data(), count));
 
-                if (indicesBufferView.byteStride == 0U ||
-                    indicesBufferView.byteStride == sizeof(I))
-                {
-                    indices = ReadBinaryData<I>(indicesBuffer, indicesOffset, count);
-                }
-                else
-                {
-                    indices = ReadBinaryDataInterleaved<I>(indicesBuffer, indicesOffset, count, 1U, indicesBufferView.byteStride);
-                }
-
-                std::vector<T> values;
-
-                if (valuesBufferView.byteStride == 0U ||
-                    valuesBufferView.byteStride == elementSize)
-                {
-                    values = ReadBinaryData<T>(valuesBuffer, valuesOffset, count * typeCount);
-                }
-                else
-                {
-                    values = ReadBinaryDataInterleaved<T>(valuesBuffer, valuesOffset, count, typeCount, valuesBufferView.byteStride);
-                }
+                std::vector<T> values(count * typeCount);
+                ReadBinaryData<T>(valuesBuffer, valuesOffset, count, typeCount, valuesBufferView.byteStride, StridedSpan<T>(values.data(), count));
 
                 for (size_t i = 0; i < indices.size(); i++)
                 {
-                    for (size_t j = 0; j < typeCount; j++)
+                    // The output may be caller-provided memory so out of range indices can't be allowed to write past its end
+                    if (indices[i] >= accessor.count)
                     {
-                        baseData[indices[i] * typeCount + j] = values[i * typeCount + j];
+                        throw GLTFException("Sparse accessor index is out of range");
                     }
+
+                    std::copy_n(values.data() + i * typeCount, typeCount, output.GetElement(indices[i], elementSize));
                 }
             }
 
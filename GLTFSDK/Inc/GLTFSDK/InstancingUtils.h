@@ -0,0 +1,58 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/ExtensionsEXT.h>
+#include <GLTFSDK/Math.h>
+
+#include <string>
+#include <vector>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        class BufferBuilder;
+        class Document;
+        class GLTFResourceReader;
+
+        // Detection of nodes that draw the same mesh and differ only in their transforms, which are replaced by a single node
+        // using the EXT_mesh_gpu_instancing extension.
+        namespace InstancingUtils
+        {
+            constexpr size_t DefaultMinInstanceCount = 2U;
+
+            // Leaf nodes with the same mesh and the same parent (or, for root nodes, the same scene). Only nodes whose sole
+            // content is the mesh and a TRS transform are grouped - nodes with children, a camera, a skin, morph target
+            // weights, a matrix, extensions or extras are left alone, as are animated nodes and skin joints.
+            struct InstanceGroup
+            {
+                std::string meshId;
+                std::string parentId; // Empty if the nodes are roots of the scene
+                std::string sceneId;  // Empty if the nodes have a parent
+                std::vector<std::string> nodeIds;
+            };
+
+            // Returns the groups of at least minInstanceCount nodes, in order of their first node
+            std::vector<InstanceGroup> FindInstanceGroups(const Document& doc, size_t minInstanceCount = DefaultMinInstanceCount);
+
+            // Writes the instances' translations, rotations and scales to new accessors (each in a new buffer view) with the
+            // BufferBuilder and returns the EXT_mesh_gpu_instancing extension that references them. ROTATION and SCALE are
+            // omitted if every instance has the default value.
+            EXT::Nodes::MeshGpuInstancing AddInstances(const Document& doc, const InstanceGroup& group, BufferBuilder& bufferBuilder);
+
+            // Replaces each group with a new node that instances the group's mesh, writing the instances with the BufferBuilder
+            // and declaring the extension. The grouped nodes are removed (their names are lost). Returns the number of nodes
+            // removed from the document.
+            size_t InstanceMeshes(Document& doc, BufferBuilder& bufferBuilder, size_t minInstanceCount = DefaultMinInstanceCount);
+
+            // Reads the instance transforms referenced by an EXT_mesh_gpu_instancing extension
+            std::vector<Matrix4> GetInstanceTransforms(const Document& doc, const GLTFResourceReader& reader, const EXT::Nodes::MeshGpuInstancing& meshGpuInstancing);
+
+            // Adds EXT_mesh_gpu_instancing to the document's extensionsUsed and extensionsRequired - the instanced nodes have
+            // no fallback, so a renderer that ignored the extension would draw a single instance.
+            void AddExtension(Document& document);
+        }
+    }
+}
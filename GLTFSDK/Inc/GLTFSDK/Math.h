@@ -5,6 +5,7 @@
 
 #include <array>
 #include <cmath>
+#include <cstddef>
 
 namespace Microsoft
 {
@@ -107,6 +108,34 @@ namespace Microsoft
             {
                 return static_cast<uint8_t>(value * 255.0f + 0.5f);
             }
+
+            // Matrices are column-major, as in glTF, and transform column vectors - so Multiply(parent, child) transforms by
+            // child and then by parent. Multiply, TransformPoints and TransformBounds are vectorized with SSE2 or NEON (see SIMD.h).
+            Matrix4 Multiply(const Matrix4& lhs, const Matrix4& rhs);
+
+            // Returns the matrix that scales, then rotates and then translates (the transform of a node's TRS properties)
+            Matrix4 CreateTransform(const Vector3& translation, const Quaternion& rotation, const Vector3& scale);
+
+            // Decomposes an affine transform into the translation, rotation and scale that CreateTransform composes. A negative
+            // determinant (a mirroring transform) is represented by negating the x scale. Returns false, leaving the outputs
+            // unchanged, if the matrix has a projection or a zero scale. Shear can't be represented and is lost.
+            bool Decompose(const Matrix4& matrix, Vector3& translation, Quaternion& rotation, Vector3& scale);
+
+            Vector3 TransformPoint(const Matrix4& matrix, const Vector3& point);
+
+            // Transforms count points, stored as three floats each. The output may be the same array as the input.
+            void TransformPoints(const Matrix4& matrix, const float* points, size_t count, float* output);
+
+            // Computes the axis aligned boxes that enclose count (non-empty) boxes, each transformed by its own matrix. The
+            // outputs may be the same arrays as the inputs.
+            void TransformBounds(const Matrix4* matrices, const Vector3* mins, const Vector3* maxs, size_t count, Vector3* outputMins, Vector3* outputMaxs);
+
+            // Spherical linear interpolation along the shortest arc between unit quaternions. Falls back to Nlerp when the
+            // rotations are nearly identical, where slerp's weights would divide by a vanishing sine.
+            Quaternion Slerp(const Quaternion& a, const Quaternion& b, float t);
+
+            // Normalized linear interpolation along the shortest arc - cheaper than Slerp but without a constant angular velocity
+            Quaternion Nlerp(const Quaternion& a, const Quaternion& b, float t);
         }
     }
 }
@@ -0,0 +1,75 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        class BufferBuilder;
+        class Document;
+        class GLTFResourceReader;
+        struct Mesh;
+        struct MeshPrimitive;
+
+        // Reordering of indexed triangle lists to improve GPU vertex processing efficiency. The index based functions operate on
+        // 32-bit triangle list indices (e.g. as returned by MeshPrimitiveUtils::GetTriangulatedIndices32) while OptimizeMeshPrimitive
+        // applies all of them to a MeshPrimitive.
+        namespace MeshOptimizationUtils
+        {
+            // The remap table value of vertices that are not referenced by any index
+            constexpr uint32_t RemovedVertex = 0xFFFFFFFFU;
+
+            constexpr size_t DefaultCacheSize = 16U;
+
+            // Reorders triangles to improve post-transform vertex cache locality using the Tipsify algorithm (Sander, Nehab &
+            // Barczak 2007). The order of the vertices within each triangle, and so the winding order, is preserved.
+            std::vector<uint32_t> OptimizeVertexCache(const std::vector<uint32_t>& indices, size_t vertexCount, size_t cacheSize = DefaultCacheSize);
+
+            // Reorders triangles to reduce overdraw, while mostly preserving vertex cache locality, by splitting the triangles into
+            // clusters at each point the vertex cache is flushed and sorting the clusters so that the outward facing clusters that
+            // are most likely to occlude others are drawn first. Positions are three floats per vertex.
+            std::vector<uint32_t> OptimizeOverdraw(const std::vector<uint32_t>& indices, const std::vector<float>& positions, size_t cacheSize = DefaultCacheSize);
+
+            // Renumbers vertices in the order they're first referenced by the indices (which are updated in place) to improve
+            // vertex fetch locality. Returns a remap table mapping each original vertex to its new index, or to RemovedVertex if
+            // the vertex isn't referenced.
+            std::vector<uint32_t> OptimizeVertexFetch(std::vector<uint32_t>& indices, size_t vertexCount);
+
+            // Returns the average cache miss ratio (the number of vertex shader invocations per triangle) for a FIFO
+            // post-transform vertex cache of the specified size. Values range from 3 (worst) down to approximately 0.5.
+            float ComputeACMR(const std::vector<uint32_t>& indices, size_t vertexCount, size_t cacheSize = DefaultCacheSize);
+
+            // Writes each of the mesh primitive's vertex attributes (and morph target attributes) reordered by the remap table to a
+            // new accessor in a new buffer view and updates the mesh primitive's accessor ids. Several vertices may be mapped to the
+            // same new index (their attribute values are expected to be identical, or nearly so, the first of them provides the
+            // values) and vertices mapped to RemovedVertex are removed.
+            void RemapVertices(const Document& doc, const GLTFResourceReader& reader, MeshPrimitive& meshPrimitive, const std::vector<uint32_t>& remap, BufferBuilder& bufferBuilder);
+
+            // Returns a remap table (suitable for RemapVertices) that maps each vertex to the first vertex with identical values
+            // for every vertex attribute and morph target attribute, numbering the remaining unique vertices in order. If epsilon
+            // is greater than zero then float components are instead compared after snapping them to a grid with a cell size of
+            // epsilon - values in the same cell are treated as equal (so values closer than epsilon that straddle a cell boundary
+            // aren't merged).
+            std::vector<uint32_t> GenerateVertexRemap(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, float epsilon = 0.0f);
+
+            // Merges duplicate vertices (as identified by GenerateVertexRemap), writing the new indices and vertex attributes with
+            // the BufferBuilder and updating the mesh primitive's accessor ids. Returns the new vertex count.
+            size_t WeldVertices(const Document& doc, const GLTFResourceReader& reader, MeshPrimitive& meshPrimitive, BufferBuilder& bufferBuilder, float epsilon = 0.0f);
+
+            // Merges duplicate vertices in each of the mesh's primitives. The duplicates are identified in parallel (see
+            // ParallelUtils::ParallelFor) after all of the vertex data has been read. Returns the total new vertex count.
+            size_t WeldVertices(const Document& doc, const GLTFResourceReader& reader, Mesh& mesh, BufferBuilder& bufferBuilder, float epsilon = 0.0f);
+
+            // Triangulates the mesh primitive and then optimizes it for the vertex cache, overdraw and vertex fetch (in that
+            // order). The new indices and vertex attributes are written with the BufferBuilder and the mesh primitive's mode and
+            // accessor ids are updated.
+            void OptimizeMeshPrimitive(const Document& doc, const GLTFResourceReader& reader, MeshPrimitive& meshPrimitive, BufferBuilder& bufferBuilder, size_t cacheSize = DefaultCacheSize);
+        }
+    }
+}
@@ -6,14 +6,34 @@
 #include <vector>
 
 #include <GLTFSDK/GLTF.h>
+#include <GLTFSDK/StridedSpan.h>
 
 namespace Microsoft
 {
     namespace glTF
     {
+        class BufferBuilder;
         class Document;
         class GLTFResourceReader;
 
+        // PrimitiveRestart -> Treat the maximum value of the indices accessor's component type (e.g. 0xFFFF for unsigned short indices) as
+        //                     a primitive restart value that begins a new triangle strip or fan. The glTF 2.0 spec doesn't permit primitive
+        //                     restart values but they're common in content converted from other formats.
+        // RemoveDegenerateTriangles -> Remove triangles that reference the same vertex more than once (e.g. strip stitching triangles).
+        // RemoveZeroAreaTriangles -> Remove triangles whose vertex positions are collinear or coincident. Requires vertex positions.
+        enum class TriangulationFlags
+        {
+            None = 0x0,
+            PrimitiveRestart = 0x1,
+            RemoveDegenerateTriangles = 0x2,
+            RemoveZeroAreaTriangles = 0x4
+        };
+
+        TriangulationFlags  operator| (TriangulationFlags lhs,  TriangulationFlags rhs);
+        TriangulationFlags& operator|=(TriangulationFlags& lhs, TriangulationFlags rhs);
+        TriangulationFlags  operator& (TriangulationFlags lhs,  TriangulationFlags rhs);
+        TriangulationFlags& operator&=(TriangulationFlags& lhs, TriangulationFlags rhs);
+
         namespace MeshPrimitiveUtils
         {
             std::vector<uint16_t> GetIndices16(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor);
@@ -25,9 +45,20 @@ namespace Microsoft
             std::vector<uint16_t> GetTriangulatedIndices16(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive);
             std::vector<uint32_t> GetTriangulatedIndices32(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive);
 
+            // Triangulates the mesh primitive's indices, recognizing primitive restart values and removing degenerate triangles as
+            // specified by flags. If removedTriangleCount is not null it is set to the number of triangles that were removed.
+            std::vector<uint16_t> GetTriangulatedIndices16(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, TriangulationFlags flags, size_t* removedTriangleCount = nullptr);
+            std::vector<uint32_t> GetTriangulatedIndices32(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, TriangulationFlags flags, size_t* removedTriangleCount = nullptr);
+
             std::vector<uint16_t> GetSegmentedIndices16(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive);
             std::vector<uint32_t> GetSegmentedIndices32(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive);
 
+            // Writes the mesh primitive's indices to a new accessor (in the BufferBuilder's current buffer view) using the narrowest
+            // possible component type and updates meshPrimitive.indicesAccessorId. Returns false, without writing anything, if the
+            // existing indices accessor's component type is already at least as narrow. The indices are read, then scanned for their
+            // maximum value, so two passes are made over them.
+            bool NarrowIndices(const Document& doc, const GLTFResourceReader& reader, MeshPrimitive& meshPrimitive, BufferBuilder& bufferBuilder);
+
             std::vector<float> GetPositions(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor);
             std::vector<float> GetPositions(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive);
             std::vector<float> GetPositions(const Document& doc, const GLTFResourceReader& reader, const MorphTarget& morphTarget);
@@ -57,6 +88,78 @@ namespace Microsoft
             std::vector<uint32_t> GetJointWeights32(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor);
             std::vector<uint32_t> GetJointWeights32_0(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive);
 
+            // The following overloads write directly into caller-provided memory (e.g. a mapped GPU upload buffer) rather than
+            // returning a new vector. Each output element holds the values the equivalent function above returns per index or
+            // per vertex (e.g. three floats for positions, one packed uint32_t for colors) and the output span must have room
+            // for at least accessor.count elements - or the count returned by GetTriangulatedIndexCount/GetSegmentedIndexCount.
+
+            void GetIndices16(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, StridedSpan<uint16_t> output);
+            void GetIndices16(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, StridedSpan<uint16_t> output);
+
+            void GetIndices32(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, StridedSpan<uint32_t> output);
+            void GetIndices32(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, StridedSpan<uint32_t> output);
+
+            size_t GetTriangulatedIndexCount(const Document& doc, const MeshPrimitive& meshPrimitive);
+            void GetTriangulatedIndices16(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, StridedSpan<uint16_t> output);
+            void GetTriangulatedIndices32(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, StridedSpan<uint32_t> output);
+
+            size_t GetSegmentedIndexCount(const Document& doc, const MeshPrimitive& meshPrimitive);
+            void GetSegmentedIndices16(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, StridedSpan<uint16_t> output);
+            void GetSegmentedIndices32(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, StridedSpan<uint32_t> output);
+
+            void GetPositions(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, StridedSpan<float> output);
+            void GetPositions(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, StridedSpan<float> output);
+            void GetPositions(const Document& doc, const GLTFResourceReader& reader, const MorphTarget& morphTarget, StridedSpan<float> output);
+
+            void GetNormals(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, StridedSpan<float> output);
+            void GetNormals(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, StridedSpan<float> output);
+            void GetNormals(const Document& doc, const GLTFResourceReader& reader, const MorphTarget& morphTarget, StridedSpan<float> output);
+
+            void GetTangents(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, StridedSpan<float> output);
+            void GetTangents(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, StridedSpan<float> output);
+            void GetTangents(const Document& doc, const GLTFResourceReader& reader, const MorphTarget& morphTarget, StridedSpan<float> output);
+            void GetMorphTangents(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, StridedSpan<float> output);
+
+            void GetTexCoords(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, StridedSpan<float> output);
+            void GetTexCoords_0(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, StridedSpan<float> output);
+            void GetTexCoords_1(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, StridedSpan<float> output);
+
+            void GetColors(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, StridedSpan<uint32_t> output);
+            void GetColors_0(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, StridedSpan<uint32_t> output);
+
+            void GetJointIndices32(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, StridedSpan<uint32_t> output);
+            void GetJointIndices32_0(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, StridedSpan<uint32_t> output);
+
+            void GetJointIndices64(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, StridedSpan<uint64_t> output);
+            void GetJointIndices64_0(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, StridedSpan<uint64_t> output);
+
+            void GetJointWeights32(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, StridedSpan<uint32_t> output);
+            void GetJointWeights32_0(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, StridedSpan<uint32_t> output);
+
+            // Expand triangle strips and fans (or line strips and loops) that are already in memory into a list of triangles (or
+            // line segments). The output span must have room for at least as many elements as the triangulated (or segmented)
+            // indices. Very large primitives are expanded in parallel.
+            void TriangulateIndices16(const uint16_t* indices, size_t indexCount, MeshMode mode, StridedSpan<uint16_t> output);
+            void TriangulateIndices32(const uint32_t* indices, size_t indexCount, MeshMode mode, StridedSpan<uint32_t> output);
+
+            struct TriangulationResult
+            {
+                size_t indexCount;           // The number of indices written to the output span
+                size_t removedTriangleCount; // The number of triangles removed
+            };
+
+            // As above but recognizing primitive restart values (the maximum value of the index type) and removing degenerate triangles
+            // as specified by flags. Positions (three floats per vertex, for vertexCount vertices) are only required by the
+            // RemoveZeroAreaTriangles flag. The output span must have room for at least as many elements as would be written if
+            // no triangles were removed.
+            TriangulationResult TriangulateIndices16(const uint16_t* indices, size_t indexCount, MeshMode mode, TriangulationFlags flags, StridedSpan<uint16_t> output,
+                const float* positions = nullptr, size_t vertexCount = 0U);
+            TriangulationResult TriangulateIndices32(const uint32_t* indices, size_t indexCount, MeshMode mode, TriangulationFlags flags, StridedSpan<uint32_t> output,
+                const float* positions = nullptr, size_t vertexCount = 0U);
+
+            void SegmentIndices16(const uint16_t* indices, size_t indexCount, MeshMode mode, StridedSpan<uint16_t> output);
+            void SegmentIndices32(const uint32_t* indices, size_t indexCount, MeshMode mode, StridedSpan<uint32_t> output);
+
             std::vector<uint16_t> ReverseTriangulateIndices16(const uint16_t* indices, size_t indexCount, MeshMode mode);
             std::vector<uint32_t> ReverseTriangulateIndices32(const uint32_t* indices, size_t indexCount, MeshMode mode);
 
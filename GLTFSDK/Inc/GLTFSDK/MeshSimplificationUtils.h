@@ -0,0 +1,54 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        class BufferBuilder;
+        class Document;
+        class GLTFResourceReader;
+        struct MeshPrimitive;
+
+        // Mesh simplification by quadric error metric edge collapse (Garland & Heckbert 1997) and generation of MSFT_lod level
+        // of detail chains. Simplification only generates new indices - the simplified triangles reference a subset of the
+        // original vertices so each level of detail can share the original vertex attribute accessors.
+        namespace MeshSimplificationUtils
+        {
+            constexpr float DefaultTargetError = 0.01f;
+
+            // Simplifies a triangle list until it has no more than targetIndexCount indices or no further edge can be collapsed
+            // without exceeding targetError, the maximum allowed deviation relative to the size of the mesh's bounding box.
+            // Positions are three floats per vertex.
+            //
+            // The error metric is geometric only: the quadrics measure distance from the original surface and have no attribute
+            // terms, so smoothly varying UVs, normals or colors across a collapsed region aren't accounted for. Vertices with
+            // identical positions but different attributes (i.e. at UV or normal seams) are only collapsed along the seam and
+            // together with their coincident vertices, so attribute discontinuities are preserved. Vertices on mesh borders are
+            // only collapsed along the border. If resultError is non-null it is set to the relative error of the simplified mesh.
+            std::vector<uint32_t> SimplifyIndices(const std::vector<uint32_t>& indices, const std::vector<float>& positions, size_t targetIndexCount,
+                float targetError = DefaultTargetError, float* resultError = nullptr);
+
+            // Simplifies the mesh primitive's triangulated indices to the specified ratio (between 0 and 1) of its triangles
+            std::vector<uint32_t> SimplifyMeshPrimitive(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, float ratio,
+                float targetError = DefaultTargetError, float* resultError = nullptr);
+
+            // Generates a level of detail for each ratio (in decreasing order) by simplifying each primitive of the node's mesh.
+            // Each level of detail is a new mesh, whose primitives share the original vertex attributes but have new indices
+            // written with the BufferBuilder, and a new node with the original node's transform. The node's MSFT_lod extension
+            // is set to reference the new nodes (whose ids are returned) and MSFT_lod is added to the document's extensionsUsed.
+            //
+            // The new nodes don't include the original node's children. The new meshes reference accessors that are only added
+            // to the document when BufferBuilder::Output is called.
+            std::vector<std::string> AddNodeLods(Document& doc, const GLTFResourceReader& reader, const std::string& nodeId, const std::vector<float>& ratios,
+                BufferBuilder& bufferBuilder, float targetError = DefaultTargetError);
+        }
+    }
+}
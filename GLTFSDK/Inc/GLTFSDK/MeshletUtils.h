@@ -0,0 +1,87 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/ExtensionsMSFT.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        class BufferBuilder;
+        class Document;
+        class GLTFResourceReader;
+        struct MeshPrimitive;
+
+        // Partitioning of triangle lists into meshlets - clusters of triangles with bounded vertex and triangle counts that a
+        // renderer can cull independently (e.g. with mesh shaders). Meshlets are stored using the MSFT_meshlets extension.
+        namespace MeshletUtils
+        {
+            // Triangles refer to meshlet vertices with 8-bit local indices
+            constexpr size_t MaxVertexLimit = 256U;
+            constexpr size_t MaxTriangleLimit = 512U;
+
+            constexpr size_t DefaultMaxVertices = 64U;
+            constexpr size_t DefaultMaxTriangles = 124U;
+
+            // Stored as a VEC4 UNSIGNED_INT accessor element
+            struct Meshlet
+            {
+                uint32_t vertexOffset;  // The offset of the meshlet's first vertex in MeshletData::vertices
+                uint32_t vertexCount;
+                uint32_t triangleOffset; // The offset of the meshlet's first triangle in MeshletData::triangles (in triangles)
+                uint32_t triangleCount;
+            };
+
+            // Stored as two VEC4 FLOAT accessor elements
+            struct MeshletBounds
+            {
+                float center[3];
+                float radius;
+
+                // The cone axis is the average triangle normal. The cone cutoff is the cosine of the cone's half angle, or -1 if
+                // the triangle normals don't all lie within the same hemisphere (in which case the meshlet can't be cone culled).
+                float coneAxis[3];
+                float coneCutoff;
+            };
+
+            struct MeshletData
+            {
+                std::vector<Meshlet> meshlets;
+                std::vector<uint32_t> vertices;  // SCALAR UNSIGNED_INT - the primitive's vertex index for each meshlet vertex
+                std::vector<uint8_t> triangles;  // SCALAR UNSIGNED_BYTE - three meshlet vertex indices per triangle
+                std::vector<MeshletBounds> bounds;
+            };
+
+            // Partitions the triangles (in order, so the indices should first be optimized for the vertex cache - see
+            // MeshOptimizationUtils::OptimizeVertexCache) into meshlets. Positions are three floats per vertex.
+            MeshletData BuildMeshlets(const std::vector<uint32_t>& indices, const std::vector<float>& positions,
+                size_t maxVertices = DefaultMaxVertices, size_t maxTriangles = DefaultMaxTriangles);
+
+            // Builds meshlets from the mesh primitive's triangulated indices and positions
+            MeshletData BuildMeshlets(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive,
+                size_t maxVertices = DefaultMaxVertices, size_t maxTriangles = DefaultMaxTriangles);
+
+            // Writes the meshlet data to new accessors (each in a new buffer view) with the BufferBuilder and returns the
+            // MSFT_meshlets extension that references them
+            MSFT::MeshPrimitives::Meshlets AddMeshlets(const MeshletData& meshletData, size_t maxVertices, size_t maxTriangles, BufferBuilder& bufferBuilder);
+
+            // Builds the mesh primitive's meshlets, writes them with the BufferBuilder and sets the mesh primitive's MSFT_meshlets
+            // extension. AddExtension must also be called to declare the extension.
+            void AddMeshlets(const Document& doc, const GLTFResourceReader& reader, MeshPrimitive& meshPrimitive, BufferBuilder& bufferBuilder,
+                size_t maxVertices = DefaultMaxVertices, size_t maxTriangles = DefaultMaxTriangles);
+
+            // Reads the meshlet data referenced by an MSFT_meshlets extension
+            MeshletData GetMeshlets(const Document& doc, const GLTFResourceReader& reader, const MSFT::MeshPrimitives::Meshlets& meshlets);
+
+            // Adds MSFT_meshlets to the document's extensionsUsed. Renderers without meshlet support can ignore the extension so
+            // it isn't required.
+            void AddExtension(Document& document);
+        }
+    }
+}
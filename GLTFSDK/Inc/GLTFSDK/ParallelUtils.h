@@ -0,0 +1,34 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        namespace ParallelUtils
+        {
+            // Returns the maximum number of threads (including the calling thread) used by ParallelFor
+            size_t GetConcurrency();
+
+            // Divides the range [0, count) into contiguous sub-ranges of at least minRangeSize elements and calls fn(begin, end)
+            // once per sub-range. Sub-ranges are processed concurrently, with the calling thread processing the first one, and
+            // ParallelFor returns once every sub-range has been processed. If fn throws then the first exception is rethrown.
+            // Small ranges (count < 2 * minRangeSize) are processed by a single call to fn on the calling thread.
+            void ParallelFor(size_t count, size_t minRangeSize, const std::function<void(size_t, size_t)>& fn);
+
+            // Processes a sequence of dependent phases in parallel, calling fn(phase, begin, end) for sub-ranges of each phase's
+            // range [0, counts[phase]). Every sub-range of a phase is processed before any sub-range of the next phase, but the
+            // threads are only started once and wait at a barrier between phases rather than being started and joined by a
+            // separate ParallelFor per phase. The number of threads is chosen as for ParallelFor from the largest phase, and
+            // each thread processes the same position in every phase's range (empty sub-ranges are skipped). If fn throws
+            // then no further phases are started and the first exception is rethrown.
+            void ParallelForPhases(const std::vector<size_t>& counts, size_t minRangeSize, const std::function<void(size_t, size_t, size_t)>& fn);
+        }
+    }
+}
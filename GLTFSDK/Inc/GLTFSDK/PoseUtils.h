@@ -0,0 +1,82 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/GLTF.h>
+
+#include <limits>
+#include <vector>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        class CompiledAnimation;
+        class Document;
+        class GLTFResourceReader;
+
+        // Evaluation of node transforms and skin joint palettes for CPU skinning. Nodes are identified by their index in
+        // Document.nodes and all the per-node arrays are in that order.
+        namespace PoseUtils
+        {
+            constexpr size_t NoParent = std::numeric_limits<size_t>::max();
+
+            struct NodeHierarchy
+            {
+                std::vector<size_t> order;   // Every node, with each parent before its children
+                std::vector<size_t> parents; // The index of each node's parent, or NoParent for root nodes
+            };
+
+            // The local translation, rotation and scale of every node
+            struct Pose
+            {
+                std::vector<Vector3> translations;
+                std::vector<Quaternion> rotations;
+                std::vector<Vector3> scales;
+            };
+
+            // The joints of a skin and their inverse bind matrices
+            struct SkinBinding
+            {
+                std::vector<size_t> jointIndices;
+                std::vector<Matrix4> inverseBindMatrices;
+            };
+
+            // A palette to compute with ComputeJointPalettes - the skin's joint matrices for one set of world transforms (e.g.
+            // one instance of a skinned model). The palette must have room for a matrix per joint.
+            struct PaletteJob
+            {
+                const SkinBinding* skin;
+                const Matrix4* worldTransforms;
+                Matrix4* palette;
+            };
+
+            // Throws a GLTFException if a node is the child of more than one node or of itself
+            NodeHierarchy GetNodeHierarchy(const Document& doc);
+
+            // Returns the TRS properties of the nodes
+            Pose GetRestPose(const Document& doc);
+
+            // Overwrites the animated translations, rotations and scales in the pose with the output of
+            // CompiledAnimation::Evaluate. Morph weights are ignored.
+            void ApplyAnimation(const Document& doc, const CompiledAnimation& animation, const float* output, Pose& pose);
+
+            // Computes the local transform of each node from the pose - nodes with a matrix rather than TRS properties use
+            // their matrix
+            void ComputeLocalTransforms(const Document& doc, const Pose& pose, std::vector<Matrix4>& localTransforms);
+
+            // Computes the world transform of each node by visiting the hierarchy in order
+            void ComputeWorldTransforms(const NodeHierarchy& hierarchy, const std::vector<Matrix4>& localTransforms, std::vector<Matrix4>& worldTransforms);
+
+            // The inverse bind matrices are the identity if the skin doesn't have an accessor for them
+            SkinBinding GetSkinBinding(const Document& doc, const GLTFResourceReader& reader, const Skin& skin);
+
+            // Writes the world transform of each joint multiplied by its inverse bind matrix to the palette
+            void ComputeJointPalette(const SkinBinding& skin, const Matrix4* worldTransforms, Matrix4* palette);
+
+            // Computes many joint palettes in parallel, with the joints of all the jobs divided evenly between threads
+            void ComputeJointPalettes(const std::vector<PaletteJob>& jobs);
+        }
+    }
+}
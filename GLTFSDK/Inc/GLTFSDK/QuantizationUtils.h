@@ -0,0 +1,91 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/Math.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        class BufferBuilder;
+        class Document;
+        class GLTFResourceReader;
+        struct Accessor;
+        struct MeshPrimitive;
+        struct Node;
+        struct Skin;
+
+        // Export-side support for KHR_mesh_quantization. Float vertex attributes are converted to normalized integer
+        // types, the resulting accessors are laid out to satisfy the spec's 4-byte vertex attribute alignment rules.
+        namespace QuantizationUtils
+        {
+            struct QuantizedPositions
+            {
+                // Four components per vertex (XYZ and one padding component) - i.e. a byte stride of 8
+                std::vector<int16_t> positions;
+
+                // The dequantization transform: position = translation + scale * normalized
+                Vector3 translation;
+                float scale;
+
+                std::vector<float> minValues;
+                std::vector<float> maxValues;
+            };
+
+            struct QuantizedTexCoords
+            {
+                std::vector<uint16_t> texCoords;
+
+                // The dequantization transform: texCoord = offset + scale * normalized
+                Vector2 offset;
+                Vector2 scale;
+            };
+
+            // Positions are quantized to normalized int16 values within a cube that bounds the mesh, using a uniform scale
+            // means the dequantization transform doesn't affect normal or tangent directions.
+            QuantizedPositions QuantizePositions(const std::vector<float>& positions);
+
+            // Normals are quantized to normalized int8 values, four components per vertex (XYZ and one padding component)
+            std::vector<int8_t> QuantizeNormals(const std::vector<float>& normals);
+
+            // Tangents are quantized to normalized int8 values (XYZW)
+            std::vector<int8_t> QuantizeTangents(const std::vector<float>& tangents);
+
+            // Texture coordinates are quantized to normalized uint16 values. Texture coordinates that lie within [0, 1]
+            // don't require a dequantization transform (i.e. the offset is zero and the scale is one).
+            QuantizedTexCoords QuantizeTexCoords(const std::vector<float>& texCoords);
+
+            // Each function adds a new buffer view (to the BufferBuilder's current buffer) and an accessor
+            const Accessor& AddPositionsAccessor(BufferBuilder& bufferBuilder, const QuantizedPositions& positions);
+            const Accessor& AddNormalsAccessor(BufferBuilder& bufferBuilder, const std::vector<int8_t>& normals);
+            const Accessor& AddTangentsAccessor(BufferBuilder& bufferBuilder, const std::vector<int8_t>& tangents);
+            const Accessor& AddTexCoordsAccessor(BufferBuilder& bufferBuilder, const QuantizedTexCoords& texCoords);
+
+            // Moves the node's mesh (and morph target weights) to a new child node whose transform is the dequantization
+            // transform, the node's own transform and children are unchanged. Returns the new node. The transform of a
+            // skinned mesh's node is ignored so skinned nodes must use ApplySkinDequantizationTransform instead.
+            const Node& ApplyDequantizationTransform(Document& document, const std::string& nodeId, const QuantizedPositions& positions);
+
+            // Assigns the skinned node a copy of its skin whose inverse bind matrices, written with the BufferBuilder, include
+            // the dequantization transform. Returns the new skin, which references an accessor that is only added to the
+            // document when BufferBuilder::Output is called.
+            const Skin& ApplySkinDequantizationTransform(Document& document, const GLTFResourceReader& reader, BufferBuilder& bufferBuilder,
+                const std::string& nodeId, const QuantizedPositions& positions);
+
+            // Applies the dequantization transform, via KHR_texture_transform, to each texture of the primitive's material that
+            // uses the TEXCOORD_<texCoord> attribute (combining it with any existing texture transform) and adds the extension
+            // to the document's extensionsUsed and extensionsRequired. Materials shared by several quantized primitives must
+            // only be transformed once, so those primitives' texture coordinates must share a dequantization transform.
+            void ApplyDequantizationTransform(Document& document, const MeshPrimitive& meshPrimitive, size_t texCoord, const QuantizedTexCoords& texCoords);
+
+            // Adds KHR_mesh_quantization to the document's extensionsUsed and extensionsRequired
+            void AddExtension(Document& document);
+        }
+    }
+}
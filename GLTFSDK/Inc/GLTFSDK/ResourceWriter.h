@@ -8,6 +8,7 @@
 #include <GLTFSDK/IStreamCache.h>
 #include <GLTFSDK/StreamUtils.h>
 
+#include <functional>
 #include <memory>
 
 namespace Microsoft
@@ -19,6 +20,8 @@ namespace Microsoft
         // APIs (e.g. BufferBuilder).
         class ResourceWriter
         {
+            friend class AsyncResourceWriter;
+
         public:
             virtual ~ResourceWriter();
 
@@ -27,6 +30,15 @@ namespace Microsoft
             void Write(const BufferView& bufferView, const void* data);
             void Write(const BufferView& bufferView, const void* data, const Accessor& accessor);
 
+            // Copies bufferView.byteLength bytes from the stream in fixed size chunks. Useful for embedding
+            // large resources (e.g. image files) without loading them into memory in their entirety.
+            void Write(const BufferView& bufferView, std::istream& stream);
+
+            // Writes the accessor's data in fixed size chunks, fnFill is called to fill each chunk (given the chunk's byte
+            // offset and length within the accessor's data) before it is written. Useful for data that is converted as it
+            // is written (e.g. narrowed indices) rather than into a temporary copy. Chunks hold a whole number of elements.
+            void Write(const BufferView& bufferView, const Accessor& accessor, const std::function<void(void* chunk, size_t byteOffset, size_t byteLength)>& fnFill);
+
             template<typename T>
             void Write(const BufferView& bufferView, const std::vector<T>& data)
             {
@@ -76,6 +88,10 @@ namespace Microsoft
             std::unique_ptr<IStreamWriterCache> m_streamWriterCache;
 
         private:
+            std::ostream* PrepareBufferStream(const BufferView& bufferView, std::streamoff totalOffset);
+
+            static void ValidateAccessor(const BufferView& bufferView, const Accessor& accessor);
+
             void WriteImpl(const BufferView& bufferView, const void* data, std::streamoff totalOffset, size_t totalByteLength);
         };
     }
@@ -0,0 +1,17 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+// Selects the instruction set used by the SDK's vectorized code paths, each of which has a scalar fallback. Defines
+// GLTFSDK_SSE2 on x86 and x64 (SSE2 is part of the x64 baseline) or GLTFSDK_NEON on ARM, unless GLTFSDK_NO_SIMD is
+// defined to force the scalar paths. Code paths that only have an SSE2 implementation use the scalar one on ARM.
+#if !defined(GLTFSDK_NO_SIMD)
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define GLTFSDK_SSE2
+#include <emmintrin.h>
+#elif defined(_M_ARM64) || defined(_M_ARM) || defined(__ARM_NEON)
+#define GLTFSDK_NEON
+#include <arm_neon.h>
+#endif
+#endif
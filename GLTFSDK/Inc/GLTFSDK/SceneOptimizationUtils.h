@@ -0,0 +1,42 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstddef>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        class BufferBuilder;
+        class Document;
+        class GLTFResourceReader;
+        struct Mesh;
+
+        // Simplification of the node hierarchy (e.g. the deep chains of grouping nodes exported by content creation tools) and
+        // reduction of draw calls by merging primitives. Animated nodes, skin joints and nodes with a skin, morph target
+        // weights, extensions or extras are never removed or merged. The merged vertex data is written with a BufferBuilder,
+        // which, like the other utilities that write with a BufferBuilder, leaves the original accessors in the document.
+        namespace SceneOptimizationUtils
+        {
+            // Removes the nodes that don't contribute to the scene - nodes without a mesh or camera that either have no
+            // (remaining) children or have an identity transform (see Node::HasIdentityTRS), in which case their children take
+            // their place. Nodes that aren't in a scene or the child of another node are left alone, as they may be referenced
+            // by an extension. Returns the number of nodes removed.
+            size_t CollapseNodes(Document& doc);
+
+            // Merges the mesh's triangle primitives (TRIANGLES, TRIANGLE_STRIP or TRIANGLE_FAN) that share a material and have
+            // the same attributes into single indexed TRIANGLES primitives. Primitives with morph targets or extensions are left
+            // unchanged. Returns the number of primitives removed.
+            size_t MergePrimitives(const Document& doc, const GLTFResourceReader& reader, Mesh& mesh, BufferBuilder& bufferBuilder);
+
+            // Merges the leaf mesh nodes that share a parent (or, for root nodes, a scene) into the first of them, baking each
+            // node's transform into the positions, normals and tangents of its primitives and merging the primitives that share
+            // a material (see MergePrimitives). A single node's transform is also baked. Only nodes whose mesh isn't used by
+            // another node, and whose primitives could all be merged, are merged; the meshes of the other nodes are removed.
+            // Returns the number of nodes removed.
+            size_t MergeMeshNodes(Document& doc, const GLTFResourceReader& reader, BufferBuilder& bufferBuilder);
+        }
+    }
+}
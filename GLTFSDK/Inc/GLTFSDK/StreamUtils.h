@@ -3,7 +3,11 @@
 
 #pragma once
 
+#include <GLTFSDK/Exceptions.h>
+
+#include <algorithm>
 #include <istream>
+#include <memory>
 #include <ostream>
 
 namespace Microsoft
@@ -48,6 +52,38 @@ namespace Microsoft
                 return size;
             }
 
+            // Copies size bytes from one stream to another in fixed size chunks, the data is never held in memory in its entirety
+            static size_t CopyBinary(std::istream& source, std::ostream& destination, size_t size)
+            {
+                const size_t chunkSize = 64U * 1024U;
+
+                if (!destination.good())
+                {
+                    throw GLTFException("The output stream is not in a good state.");
+                }
+
+                const auto chunk = std::make_unique<char[]>(std::min(size, chunkSize));
+
+                for (size_t remaining = size; remaining > 0U;)
+                {
+                    const auto count = std::min(remaining, chunkSize);
+
+                    if (source.read(chunk.get(), count).fail())
+                    {
+                        throw GLTFException("Cannot read the binary data");
+                    }
+
+                    if (destination.write(chunk.get(), count).fail())
+                    {
+                        throw GLTFException("Unable to write to buffer.");
+                    }
+
+                    remaining -= count;
+                }
+
+                return size;
+            }
+
             template<typename T>
             static T ReadBinary(std::istream& stream)
             {
@@ -0,0 +1,47 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        // A non-owning view of caller-provided memory (e.g. a mapped GPU upload buffer) holding 'count' elements. Each element
+        // is one or more contiguous values of type T and consecutive elements begin byteStride bytes apart. A byteStride of
+        // zero means the elements are tightly packed, i.e. the stride is implied by the number of values per element.
+        // Note: intended to be used as a pass-by-value function parameter
+        template<typename T>
+        struct StridedSpan
+        {
+            StridedSpan(T* data, size_t count, size_t byteStride = 0U) :
+                data(data),
+                count(count),
+                byteStride(byteStride)
+            {
+            }
+
+            size_t GetByteStride(size_t elementByteLength) const
+            {
+                return byteStride == 0U ? elementByteLength : byteStride;
+            }
+
+            bool IsPacked(size_t elementByteLength) const
+            {
+                return GetByteStride(elementByteLength) == elementByteLength;
+            }
+
+            T* GetElement(size_t index, size_t elementByteLength) const
+            {
+                return reinterpret_cast<T*>(reinterpret_cast<uint8_t*>(data) + index * GetByteStride(elementByteLength));
+            }
+
+            T* const     data;
+            const size_t count;
+            const size_t byteStride;
+        };
+    }
+}
@@ -0,0 +1,54 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        class BufferBuilder;
+        class Document;
+        class GLTFResourceReader;
+        struct MeshPrimitive;
+
+        // Generation of vertex normals and tangents for mesh primitives that lack them. Triangles and then vertices are processed
+        // in parallel (see ParallelUtils::ParallelForPhases) but each vertex sums its triangles' contributions in a fixed order
+        // so the results don't depend on the number of threads. There is no persistent thread pool: each call starts its own
+        // threads, once for both passes, and only meshes with at least a few thousand triangles are split across threads.
+        namespace TangentSpaceUtils
+        {
+            enum class NormalWeighting
+            {
+                Area,  // Each triangle's normal is weighted by its area
+                Angle  // Each triangle's normal is weighted by the angle of its corner at the vertex
+            };
+
+            // Returns three floats per vertex. Indices are a triangle list and positions are three floats per vertex.
+            // Vertices that aren't referenced by any (non-degenerate) triangle are given the normal (0, 0, 1).
+            std::vector<float> GenerateNormals(const std::vector<uint32_t>& indices, const std::vector<float>& positions, NormalWeighting weighting = NormalWeighting::Angle);
+
+            // Returns four floats per vertex - the tangent and the bitangent sign (w) as required by glTF. Normals are three
+            // floats per vertex and texture coordinates two.
+            //
+            // Each triangle's tangent and orientation are computed as by MikkTSpace and the tangents are projected onto the
+            // plane of each vertex normal and weighted by corner angle. Unlike MikkTSpace vertices are never split, so the
+            // results match MikkTSpace when vertices are already split at UV seams and mirrored UVs (as glTF exporters do).
+            std::vector<float> GenerateTangents(const std::vector<uint32_t>& indices, const std::vector<float>& positions, const std::vector<float>& normals,
+                const std::vector<float>& texCoords);
+
+            // Generates normals for the mesh primitive, writes them to a new accessor with the BufferBuilder and sets the mesh
+            // primitive's NORMAL attribute
+            void GenerateNormals(const Document& doc, const GLTFResourceReader& reader, MeshPrimitive& meshPrimitive, BufferBuilder& bufferBuilder,
+                NormalWeighting weighting = NormalWeighting::Angle);
+
+            // Generates tangents for the mesh primitive (which requires the NORMAL and TEXCOORD_0 attributes), writes them to a
+            // new accessor with the BufferBuilder and sets the mesh primitive's TANGENT attribute
+            void GenerateTangents(const Document& doc, const GLTFResourceReader& reader, MeshPrimitive& meshPrimitive, BufferBuilder& bufferBuilder);
+        }
+    }
+}
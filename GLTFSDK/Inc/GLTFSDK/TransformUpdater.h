@@ -0,0 +1,60 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/FlatSceneGraph.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        // Maintains the world transforms of a scene's nodes as their local transforms change. All the world transforms can
+        // be recomputed (every node at a given depth is independent of the others so wide levels are divided between threads)
+        // or, after a few local transforms have been set, only the subtrees below the changed nodes are.
+        // Nodes are identified by their flat index in the FlatSceneGraph, which must outlive the TransformUpdater.
+        class TransformUpdater
+        {
+        public:
+            // The local transforms are in flat order (see FlatSceneGraph::GetLocalTransforms). The world transforms are
+            // computed on construction.
+            TransformUpdater(const FlatSceneGraph& sceneGraph, std::vector<Matrix4> localTransforms);
+
+            size_t GetLevelCount() const;
+
+            const Matrix4& GetLocalTransform(size_t flatIndex) const;
+            const Matrix4& GetWorldTransform(size_t flatIndex) const;
+
+            const std::vector<Matrix4>& GetWorldTransforms() const;
+
+            // Sets the node's local transform and marks it as dirty. Its world transform, and those of its descendants, aren't
+            // recomputed until the next call to Update or UpdateAll.
+            void SetLocalTransform(size_t flatIndex, const Matrix4& localTransform);
+
+            bool IsDirty() const;
+
+            // Recomputes the world transforms of the dirty nodes' subtrees. Returns the number of world transforms computed.
+            size_t Update();
+
+            // Recomputes every world transform. The nodes are updated in flat order, as by FlatSceneGraph::ComputeWorldTransforms,
+            // unless there are multiple threads and levels wide enough to divide between them, which are updated level by level.
+            void UpdateAll();
+
+        private:
+            const FlatSceneGraph& m_sceneGraph;
+
+            std::vector<Matrix4> m_localTransforms;
+            std::vector<Matrix4> m_worldTransforms;
+
+            // The flat indices of the nodes at each depth, with the nodes of level i at [m_levelOffsets[i], m_levelOffsets[i + 1])
+            std::vector<size_t> m_levelNodes;
+            std::vector<size_t> m_levelOffsets;
+
+            std::vector<uint8_t> m_dirty;
+            std::vector<size_t> m_dirtyNodes;
+        };
+    }
+}
@@ -3,10 +3,14 @@
 
 #pragma once
 
+#include <GLTFSDK/ParallelUtils.h>
 #include <GLTFSDK/Traverse.h>
 
-#include <set>
-#include <typeindex>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <tuple>
+#include <vector>
 
 namespace Microsoft
 {
@@ -49,14 +53,32 @@ namespace Microsoft
                 TryInvokeImpl(Priority1(), std::forward<Fn>(fn), std::forward<TArgs>(args)...);
             }
 
-            // Helper class for keeping track of which entities have been previously visited
+            // Helper class for keeping track of which entities have been previously visited. The visit state of each entity
+            // is a bit in a bitset per entity type, indexed by the entity's position in its Document collection. The bits are
+            // set atomically so a VisitStateSet can be shared by the threads of ParallelVisit.
             class VisitStateSet
             {
             public:
+                explicit VisitStateSet(const Document& gltfDocument) :
+                    entries(
+                        Entry<Node>(gltfDocument.nodes),
+                        Entry<Mesh>(gltfDocument.meshes),
+                        Entry<Material>(gltfDocument.materials),
+                        Entry<Texture>(gltfDocument.textures),
+                        Entry<Image>(gltfDocument.images),
+                        Entry<Sampler>(gltfDocument.samplers),
+                        Entry<Skin>(gltfDocument.skins),
+                        Entry<Camera>(gltfDocument.cameras))
+                {
+                }
+
                 template<typename T>
                 VisitState GetVisitState(const T& t) const
                 {
-                    return visitStateSet.find({ typeid(T), std::stoul(t.id) }) == visitStateSet.end() ?
+                    const auto& entry = std::get<Entry<T>>(entries);
+                    const size_t index = entry.GetIndex(t);
+
+                    return (entry.bits[index / 64U].load(std::memory_order_relaxed) & GetMask(index)) == 0U ?
                         VisitState::New :
                         VisitState::Duplicate;
                 }
@@ -64,19 +86,50 @@ namespace Microsoft
                 template<typename T>
                 VisitState SetVisitState(const T& t)
                 {
-                    // Attempt to insert a unique identifier for the entity instance into the container by
-                    // combining the type information (resolved at compile time) and glTF index property.
-                    const auto result = visitStateSet.emplace(typeid(T), std::stoul(t.id));
+                    auto& entry = std::get<Entry<T>>(entries);
+                    const size_t index = entry.GetIndex(t);
 
-                    // If the insertion succeeded then the entity hasn't yet been visited. Otherwise
-                    // it is a 'duplicate' reference to an object that has already been visited.
-                    return result.second ?
+                    // If the bit wasn't already set then the entity hasn't yet been visited. Otherwise it
+                    // is a 'duplicate' reference to an object that has already been visited.
+                    return (entry.bits[index / 64U].fetch_or(GetMask(index), std::memory_order_relaxed) & GetMask(index)) == 0U ?
                         VisitState::New :
                         VisitState::Duplicate;
                 }
 
             private:
-                std::set<std::pair<std::type_index, size_t>> visitStateSet;
+                template<typename T>
+                struct Entry
+                {
+                    // Value initialization of the vector's elements zeroes every bit
+                    explicit Entry(const IndexedContainer<const T>& container) : container(container), bits((container.Size() + 63U) / 64U)
+                    {
+                    }
+
+                    // Entities are almost always visited through a reference into the Document so the index is found from the
+                    // entity's address. Entities that are copies are found by id instead.
+                    size_t GetIndex(const T& t) const
+                    {
+                        const auto& elements = container.Elements();
+                        const std::less<const T*> less;
+
+                        if (!elements.empty() && !less(&t, elements.data()) && less(&t, elements.data() + elements.size()))
+                        {
+                            return static_cast<size_t>(&t - elements.data());
+                        }
+
+                        return container.GetIndex(t.id);
+                    }
+
+                    const IndexedContainer<const T>& container;
+                    std::vector<std::atomic<uint64_t>> bits;
+                };
+
+                static uint64_t GetMask(size_t index)
+                {
+                    return uint64_t(1U) << (index % 64U);
+                }
+
+                std::tuple<Entry<Node>, Entry<Mesh>, Entry<Material>, Entry<Texture>, Entry<Image>, Entry<Sampler>, Entry<Skin>, Entry<Camera>> entries;
             };
 
             // Gets the 'raw' type of a template parameter so it can be inherited from
@@ -192,13 +245,13 @@ namespace Microsoft
         template<typename Fn>
         void VisitImpl(const Document& gltfDocument, Detail::VisitStateSet& visitStateSet, Fn& fn, const Mesh& mesh)
         {
-            const VisitState visitStateMesh = visitStateSet.GetVisitState(mesh);
+            // Entities are marked as visited before the callbacks are invoked so that, when visited concurrently by ParallelVisit,
+            // exactly one of the visits is New
+            const VisitState visitStateMesh = visitStateSet.SetVisitState(mesh);
 
             Detail::TryInvoke(fn, mesh, visitStateMesh);
             Detail::TryInvoke(fn, mesh, visitStateMesh, VisitDefaultActionImpl<Fn>(gltfDocument, visitStateSet, fn));
 
-            visitStateSet.SetVisitState(mesh);
-
             for (const auto& meshPrimitive : mesh.primitives)
             {
                 if (!meshPrimitive.materialId.empty())
@@ -216,13 +269,11 @@ namespace Microsoft
         template<typename Fn>
         void VisitImpl(const Document& gltfDocument, Detail::VisitStateSet& visitStateSet, Fn& fn, const Material& material)
         {
-            const VisitState visitStateMaterial = visitStateSet.GetVisitState(material);
+            const VisitState visitStateMaterial = visitStateSet.SetVisitState(material);
 
             Detail::TryInvoke(fn, material, visitStateMaterial);
             Detail::TryInvoke(fn, material, visitStateMaterial, VisitDefaultActionImpl<Fn>(gltfDocument, visitStateSet, fn));
 
-            visitStateSet.SetVisitState(material);
-
             for (const auto& textureInfo : material.GetTextures())
             {
                 const auto& textureId = textureInfo.first;
@@ -237,14 +288,12 @@ namespace Microsoft
         template<typename Fn>
         void VisitImpl(const Document& gltfDocument, Detail::VisitStateSet& visitStateSet, Fn& fn, const Texture& texture, TextureType textureType)
         {
-            const VisitState visitStateTexture = visitStateSet.GetVisitState(texture);
+            const VisitState visitStateTexture = visitStateSet.SetVisitState(texture);
 
             // Note that the texture 'callback' also includes a 'type' parameter
             Detail::TryInvoke(fn, texture, textureType, visitStateTexture);
             Detail::TryInvoke(fn, texture, textureType, visitStateTexture, VisitDefaultActionImpl<Fn>(gltfDocument, visitStateSet, fn));
 
-            visitStateSet.SetVisitState(texture);
-
             if (!texture.imageId.empty())
             {
                 VisitImpl(gltfDocument, visitStateSet, fn, gltfDocument.images.Get(texture.imageId));
@@ -259,45 +308,83 @@ namespace Microsoft
         template<typename Fn>
         void VisitImpl(const Document& gltfDocument, Detail::VisitStateSet& visitStateSet, Fn& fn, const Image& image)
         {
-            const VisitState visitStateImage = visitStateSet.GetVisitState(image);
+            const VisitState visitStateImage = visitStateSet.SetVisitState(image);
 
             Detail::TryInvoke(fn, image, visitStateImage);
             Detail::TryInvoke(fn, image, visitStateImage, VisitDefaultActionImpl<Fn>(gltfDocument, visitStateSet, fn));
-
-            visitStateSet.SetVisitState(image);
         }
 
         template<typename Fn>
         void VisitImpl(const Document& gltfDocument, Detail::VisitStateSet& visitStateSet, Fn& fn, const Sampler& sampler)
         {
-            const VisitState visitStateSampler = visitStateSet.GetVisitState(sampler);
+            const VisitState visitStateSampler = visitStateSet.SetVisitState(sampler);
 
             Detail::TryInvoke(fn, sampler, visitStateSampler);
             Detail::TryInvoke(fn, sampler, visitStateSampler, VisitDefaultActionImpl<Fn>(gltfDocument, visitStateSet, fn));
-
-            visitStateSet.SetVisitState(sampler);
         }
 
         template<typename Fn>
         void VisitImpl(const Document& gltfDocument, Detail::VisitStateSet& visitStateSet, Fn& fn, const Skin& skin)
         {
-            const VisitState visitStateSkin = visitStateSet.GetVisitState(skin);
+            const VisitState visitStateSkin = visitStateSet.SetVisitState(skin);
 
             Detail::TryInvoke(fn, skin, visitStateSkin);
             Detail::TryInvoke(fn, skin, visitStateSkin, VisitDefaultActionImpl<Fn>(gltfDocument, visitStateSet, fn));
-
-            visitStateSet.SetVisitState(skin);
         }
 
         template<typename Fn>
         void VisitImpl(const Document& gltfDocument, Detail::VisitStateSet& visitStateSet, Fn& fn, const Camera& camera)
         {
-            const VisitState visitStateCamera = visitStateSet.GetVisitState(camera);
+            const VisitState visitStateCamera = visitStateSet.SetVisitState(camera);
 
             Detail::TryInvoke(fn, camera, visitStateCamera);
             Detail::TryInvoke(fn, camera, visitStateCamera, VisitDefaultActionImpl<Fn>(gltfDocument, visitStateSet, fn));
+        }
 
-            visitStateSet.SetVisitState(camera);
+        namespace Detail
+        {
+            // The Traverse callback used by Visit and ParallelVisit - visits each node and then the entities it references
+            template<typename Fn>
+            class NodeVisitor
+            {
+            public:
+                NodeVisitor(const Document& gltfDocument, VisitStateSet& visitStateSet, Fn fn) : gltfDocument(gltfDocument), visitStateSet(visitStateSet), fn(std::move(fn))
+                {
+                }
+
+                void operator()(const Node& node, const Node* nodeParent)
+                {
+                    // Ensure that the scene hierarchy is a tree rather than a DAG
+                    if (visitStateSet.SetVisitState(node) == VisitState::New)
+                    {
+                        TryInvoke(fn, node, nodeParent);
+                    }
+                    else
+                    {
+                        throw InvalidGLTFException("Node " + node.id + " has already been visited. This is not allowed - nodes may only have a single parent.");
+                    }
+
+                    if (!node.meshId.empty())
+                    {
+                        VisitImpl(gltfDocument, visitStateSet, fn, gltfDocument.meshes.Get(node.meshId));
+                    }
+
+                    if (!node.skinId.empty())
+                    {
+                        VisitImpl(gltfDocument, visitStateSet, fn, gltfDocument.skins.Get(node.skinId));
+                    }
+
+                    if (!node.cameraId.empty())
+                    {
+                        VisitImpl(gltfDocument, visitStateSet, fn, gltfDocument.cameras.Get(node.cameraId));
+                    }
+                }
+
+            private:
+                const Document& gltfDocument;
+                VisitStateSet& visitStateSet;
+                Fn fn;
+            };
         }
 
         // Visit - implements a variant of the visitor pattern.
@@ -341,36 +428,9 @@ namespace Microsoft
         template<TraversalAlgorithm Algorithm = DepthFirst, typename Fn>
         void Visit(const Document& gltfDocument, size_t sceneIndex, Fn&& fn)
         {
-            Detail::VisitStateSet visitStateSet;
-
-            Traverse<Algorithm>(gltfDocument, sceneIndex,
-                [&gltfDocument, &visitStateSet, fn = std::forward<Fn>(fn)](const Node& node, const Node* nodeParent) mutable
-            {
-                // Ensure that the scene hierarchy is a tree rather than a DAG
-                if (visitStateSet.SetVisitState(node) == VisitState::New)
-                {
-                    Detail::TryInvoke(fn, node, nodeParent);
-                }
-                else
-                {
-                    throw InvalidGLTFException("Node " + node.id + " has already been visited. This is not allowed - nodes may only have a single parent.");
-                }
+            Detail::VisitStateSet visitStateSet(gltfDocument);
 
-                if (!node.meshId.empty())
-                {
-                    VisitImpl(gltfDocument, visitStateSet, fn, gltfDocument.meshes.Get(node.meshId));
-                }
-
-                if (!node.skinId.empty())
-                {
-                    VisitImpl(gltfDocument, visitStateSet, fn, gltfDocument.skins.Get(node.skinId));
-                }
-
-                if (!node.cameraId.empty())
-                {
-                    VisitImpl(gltfDocument, visitStateSet, fn, gltfDocument.cameras.Get(node.cameraId));
-                }
-            });
+            Traverse<Algorithm>(gltfDocument, sceneIndex, Detail::NodeVisitor<std::decay_t<Fn>>(gltfDocument, visitStateSet, std::forward<Fn>(fn)));
         }
 
         // Visit - implements a variant of the visitor pattern.
@@ -394,5 +454,54 @@ namespace Microsoft
         {
             Visit<Algorithm>(gltfDocument, sceneIndex, Detail::CombineInvokable<FArgs...>(std::forward<FArgs>(fargs)...));
         }
+
+        // ParallelVisit - a variant of Visit that divides the scene's root nodes between threads.
+        //
+        // Each thread traverses its root nodes (and their descendants) in the order given by the Algorithm template parameter
+        // using its own copy of the visitor object, so the visitor must be copyable and its callbacks must be safe to invoke
+        // concurrently. Entities referenced from more than one thread are still visited as New exactly once, but there is no
+        // ordering between the visits made by different threads. ParallelVisit returns once every thread has finished, and
+        // rethrows the first exception thrown by any of them.
+        //
+        // Example:
+        //
+        // std::atomic<size_t> meshCount(0U);
+        //
+        // ParallelVisit(document, DefaultSceneIndex, [&meshCount](const Mesh&, VisitState visitState)
+        // {
+        //     if (visitState == VisitState::New)
+        //     {
+        //         ++meshCount;
+        //     }
+        // });
+        //
+        template<TraversalAlgorithm Algorithm = DepthFirst, typename Fn>
+        void ParallelVisit(const Document& gltfDocument, size_t sceneIndex, Fn&& fn)
+        {
+            Detail::VisitStateSet visitStateSet(gltfDocument);
+
+            const Scene& scene = (sceneIndex == DefaultSceneIndex) ?
+                gltfDocument.GetDefaultScene() :
+                gltfDocument.scenes[sceneIndex];
+
+            const std::decay_t<Fn> visitor = std::forward<Fn>(fn);
+
+            ParallelUtils::ParallelFor(scene.nodes.size(), 1U, [&gltfDocument, &visitStateSet, &scene, &visitor](size_t begin, size_t end)
+            {
+                Detail::NodeVisitor<std::decay_t<Fn>> nodeVisitor(gltfDocument, visitStateSet, visitor);
+
+                for (size_t i = begin; i < end; ++i)
+                {
+                    Detail::TraverseNode(Detail::TraversalAlgorithmTag<Algorithm>(), gltfDocument.nodes.Get(scene.nodes[i]), gltfDocument, nodeVisitor);
+                }
+            });
+        }
+
+        // ParallelVisit - overload that accepts multiple 'callable' objects
+        template<TraversalAlgorithm Algorithm = DepthFirst, typename ...FArgs>
+        void ParallelVisit(const Document& gltfDocument, size_t sceneIndex, FArgs&& ...fargs)
+        {
+            ParallelVisit<Algorithm>(gltfDocument, sceneIndex, Detail::CombineInvokable<FArgs...>(std::forward<FArgs>(fargs)...));
+        }
     }
 }
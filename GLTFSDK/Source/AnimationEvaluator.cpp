@@ -0,0 +1,338 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/AnimationEvaluator.h>
+
+#include <GLTFSDK/AnimationUtils.h>
+#include <GLTFSDK/Document.h>
+#include <GLTFSDK/GLTFResourceReader.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace Microsoft::glTF;
+
+namespace
+{
+    void Normalize(float* q)
+    {
+        const float length = std::sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+
+        if (length > 0.0f)
+        {
+            const float scale = 1.0f / length;
+
+            q[0] *= scale;
+            q[1] *= scale;
+            q[2] *= scale;
+            q[3] *= scale;
+        }
+    }
+
+    void InterpolateRotation(const float* a, const float* b, float s, RotationInterpolation rotationInterpolation, float* output)
+    {
+        const Quaternion qa(a[0], a[1], a[2], a[3]);
+        const Quaternion qb(b[0], b[1], b[2], b[3]);
+
+        const Quaternion q = rotationInterpolation == RotationInterpolation::Slerp ? Math::Slerp(qa, qb, s) : Math::Nlerp(qa, qb, s);
+
+        output[0] = q.x;
+        output[1] = q.y;
+        output[2] = q.z;
+        output[3] = q.w;
+    }
+
+    std::vector<float> ReadValues(const Document& doc, const GLTFResourceReader& reader, const AnimationSampler& sampler, TargetPath path)
+    {
+        switch (path)
+        {
+        case TARGET_TRANSLATION:
+            return AnimationUtils::GetTranslations(doc, reader, sampler);
+        case TARGET_ROTATION:
+            return AnimationUtils::GetRotations(doc, reader, sampler);
+        case TARGET_SCALE:
+            return AnimationUtils::GetScales(doc, reader, sampler);
+        case TARGET_WEIGHTS:
+            return AnimationUtils::GetMorphWeights(doc, reader, sampler);
+        default:
+            throw GLTFException("Unknown animation channel target path");
+        }
+    }
+}
+
+AnimationEvaluator::AnimationEvaluator(const Document& doc, const GLTFResourceReader& reader, const Animation& animation, RotationInterpolation rotationInterpolation)
+    : m_rotationInterpolation(rotationInterpolation),
+      m_startTime(std::numeric_limits<float>::infinity()),
+      m_endTime(-std::numeric_limits<float>::infinity())
+{
+    for (const auto& channel : animation.channels.Elements())
+    {
+        auto curve = ReadCurve(doc, reader, animation, channel);
+
+        const size_t pathIndex = GetPathIndex(curve.path);
+
+        m_startTime = std::min(m_startTime, curve.times.front());
+        m_endTime = std::max(m_endTime, curve.times.back());
+
+        m_pathChannels[pathIndex].push_back(m_curves.size());
+        m_outputOffsets.push_back(m_outputs[pathIndex].size());
+        m_outputs[pathIndex].resize(m_outputs[pathIndex].size() + curve.componentCount);
+
+        m_nodeIds.push_back(channel.target.nodeId);
+        m_curves.push_back(std::move(curve));
+        m_cursors.push_back(0U);
+    }
+
+    if (m_curves.empty())
+    {
+        m_startTime = m_endTime = 0.0f;
+    }
+}
+
+size_t AnimationEvaluator::GetChannelCount() const
+{
+    return m_curves.size();
+}
+
+const std::string& AnimationEvaluator::GetNodeId(size_t channelIndex) const
+{
+    return m_nodeIds.at(channelIndex);
+}
+
+const AnimationCurve& AnimationEvaluator::GetCurve(size_t channelIndex) const
+{
+    return m_curves.at(channelIndex);
+}
+
+size_t AnimationEvaluator::GetOutputOffset(size_t channelIndex) const
+{
+    return m_outputOffsets.at(channelIndex);
+}
+
+float AnimationEvaluator::GetStartTime() const
+{
+    return m_startTime;
+}
+
+float AnimationEvaluator::GetEndTime() const
+{
+    return m_endTime;
+}
+
+void AnimationEvaluator::Evaluate(float time)
+{
+    for (size_t pathIndex = 0U; pathIndex < m_pathChannels.size(); ++pathIndex)
+    {
+        float* output = m_outputs[pathIndex].data();
+
+        for (auto channelIndex : m_pathChannels[pathIndex])
+        {
+            const auto& curve = m_curves[channelIndex];
+
+            Sample(curve, time, m_cursors[channelIndex], output, m_rotationInterpolation);
+
+            output += curve.componentCount;
+        }
+    }
+}
+
+const std::vector<float>& AnimationEvaluator::GetOutput(TargetPath path) const
+{
+    return m_outputs[GetPathIndex(path)];
+}
+
+AnimationCurve AnimationEvaluator::ReadCurve(const Document& doc, const GLTFResourceReader& reader, const Animation& animation, const AnimationChannel& channel)
+{
+    const auto& sampler = animation.samplers.Get(channel.samplerId);
+
+    AnimationCurve curve;
+
+    curve.path = channel.target.path;
+    curve.interpolation = sampler.interpolation;
+    curve.times = AnimationUtils::GetKeyframeTimes(doc, reader, sampler);
+    curve.values = ReadValues(doc, reader, sampler, curve.path);
+
+    if (curve.times.empty())
+    {
+        throw GLTFException("Animation sampler " + sampler.id + " has no keyframes");
+    }
+
+    if (!std::is_sorted(curve.times.begin(), curve.times.end()))
+    {
+        throw GLTFException("Animation sampler " + sampler.id + " keyframe times are not increasing");
+    }
+
+    const size_t valuesPerKeyframe = curve.interpolation == INTERPOLATION_CUBICSPLINE ? 3U : 1U;
+    const size_t valueCount = curve.times.size() * valuesPerKeyframe;
+
+    if (curve.values.empty() || curve.values.size() % valueCount != 0U)
+    {
+        throw GLTFException("Animation sampler " + sampler.id + " output count doesn't match its keyframe count");
+    }
+
+    curve.componentCount = curve.values.size() / valueCount;
+
+    return curve;
+}
+
+size_t AnimationEvaluator::FindKeyframe(const std::vector<float>& times, float time, size_t cursor)
+{
+    return FindKeyframe(times.data(), times.size(), time, cursor);
+}
+
+size_t AnimationEvaluator::FindKeyframe(const float* times, size_t count, float time, size_t cursor)
+{
+    if (count < 2U)
+    {
+        return 0U;
+    }
+
+    const size_t last = count - 2U;
+
+    cursor = std::min(cursor, last);
+
+    // Check the cursor's keyframe and its neighbors first, as consecutive times are usually close together
+    if (times[cursor] <= time)
+    {
+        if (cursor == last || time < times[cursor + 1U])
+        {
+            return cursor;
+        }
+
+        if (cursor + 1U == last || time < times[cursor + 2U])
+        {
+            return cursor + 1U;
+        }
+    }
+    else if (cursor == 0U)
+    {
+        return 0U;
+    }
+    else if (times[cursor - 1U] <= time)
+    {
+        return cursor - 1U;
+    }
+
+    const size_t upper = static_cast<size_t>(std::upper_bound(times, times + count, time) - times);
+
+    return upper == 0U ? 0U : std::min(upper - 1U, last);
+}
+
+void AnimationEvaluator::Sample(const AnimationCurve& curve, float time, size_t& cursor, float* output, RotationInterpolation rotationInterpolation)
+{
+    const size_t n = curve.componentCount;
+    const size_t valuesPerKeyframe = curve.interpolation == INTERPOLATION_CUBICSPLINE ? 3U : 1U;
+    const size_t keyframeCount = curve.times.size();
+
+    cursor = FindKeyframe(curve.times, time, cursor);
+
+    // Times outside the keyframes are clamped
+    if (keyframeCount == 1U || time <= curve.times.front() || time >= curve.times.back())
+    {
+        const size_t keyframe = time >= curve.times.back() ? keyframeCount - 1U : 0U;
+        const float* value = curve.values.data() + (keyframe * valuesPerKeyframe + valuesPerKeyframe / 2U) * n;
+
+        std::copy(value, value + n, output);
+        return;
+    }
+
+    const float t0 = curve.times[cursor];
+    const float dt = curve.times[cursor + 1U] - t0;
+    const float s = dt > 0.0f ? std::min(1.0f, std::max(0.0f, (time - t0) / dt)) : 0.0f;
+
+    Interpolate(curve.path, curve.interpolation, n, curve.values.data() + cursor * valuesPerKeyframe * n, s, dt, output, rotationInterpolation);
+}
+
+void AnimationEvaluator::Interpolate(TargetPath path, InterpolationType interpolation, size_t componentCount, const float* keyframes, float s, float dt, float* output,
+    RotationInterpolation rotationInterpolation)
+{
+    Interpolate(path, interpolation, componentCount, keyframes, componentCount, 1U, s, dt, output, rotationInterpolation);
+}
+
+void AnimationEvaluator::Interpolate(TargetPath path, InterpolationType interpolation, size_t componentCount, const float* keyframes, size_t valueStride,
+    size_t componentStride, float s, float dt, float* output, RotationInterpolation rotationInterpolation)
+{
+    const size_t n = componentCount;
+
+    switch (interpolation)
+    {
+    case INTERPOLATION_STEP:
+        for (size_t i = 0U; i < n; ++i)
+        {
+            output[i] = keyframes[i * componentStride];
+        }
+        break;
+
+    case INTERPOLATION_CUBICSPLINE:
+    {
+        // Hermite spline with the tangents scaled by the keyframe interval
+        const float* v0 = keyframes + valueStride;
+        const float* b0 = keyframes + 2U * valueStride; // The first keyframe's out-tangent
+        const float* a1 = keyframes + 3U * valueStride; // The second keyframe's in-tangent
+        const float* v1 = keyframes + 4U * valueStride;
+
+        const float s2 = s * s;
+        const float s3 = s2 * s;
+
+        const float h00 = 2.0f * s3 - 3.0f * s2 + 1.0f;
+        const float h10 = (s3 - 2.0f * s2 + s) * dt;
+        const float h01 = -2.0f * s3 + 3.0f * s2;
+        const float h11 = (s3 - s2) * dt;
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+            const size_t c = i * componentStride;
+
+            output[i] = h00 * v0[c] + h10 * b0[c] + h01 * v1[c] + h11 * a1[c];
+        }
+
+        if (path == TARGET_ROTATION)
+        {
+            Normalize(output);
+        }
+    }
+    break;
+
+    default:
+    {
+        const float* v0 = keyframes;
+        const float* v1 = keyframes + valueStride;
+
+        if (path == TARGET_ROTATION)
+        {
+            const float a[4] = { v0[0], v0[componentStride], v0[2U * componentStride], v0[3U * componentStride] };
+            const float b[4] = { v1[0], v1[componentStride], v1[2U * componentStride], v1[3U * componentStride] };
+
+            InterpolateRotation(a, b, s, rotationInterpolation, output);
+        }
+        else
+        {
+            for (size_t i = 0U; i < n; ++i)
+            {
+                const size_t c = i * componentStride;
+
+                output[i] = v0[c] + (v1[c] - v0[c]) * s;
+            }
+        }
+    }
+    break;
+    }
+}
+
+size_t AnimationEvaluator::GetPathIndex(TargetPath path)
+{
+    switch (path)
+    {
+    case TARGET_TRANSLATION:
+        return 0U;
+    case TARGET_ROTATION:
+        return 1U;
+    case TARGET_SCALE:
+        return 2U;
+    case TARGET_WEIGHTS:
+        return 3U;
+    default:
+        throw GLTFException("Unknown animation channel target path");
+    }
+}
@@ -0,0 +1,227 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/AnimationOptimizationUtils.h>
+
+#include <GLTFSDK/AnimationUtils.h>
+#include <GLTFSDK/BufferBuilder.h>
+#include <GLTFSDK/Document.h>
+#include <GLTFSDK/GLTFResourceReader.h>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <unordered_map>
+
+using namespace Microsoft::glTF;
+
+namespace
+{
+    // Returns the error of the actual value relative to the expected value - the angle between rotations, the distance
+    // between translations and the largest component difference otherwise
+    float GetError(TargetPath path, const float* expected, const float* actual, size_t componentCount)
+    {
+        if (path == TARGET_ROTATION)
+        {
+            const float dot = expected[0] * actual[0] + expected[1] * actual[1] + expected[2] * actual[2] + expected[3] * actual[3];
+
+            return 2.0f * std::acos(std::min(1.0f, std::abs(dot)));
+        }
+
+        if (path == TARGET_TRANSLATION)
+        {
+            const float x = expected[0] - actual[0];
+            const float y = expected[1] - actual[1];
+            const float z = expected[2] - actual[2];
+
+            return std::sqrt(x * x + y * y + z * z);
+        }
+
+        float error = 0.0f;
+
+        for (size_t i = 0U; i < componentCount; ++i)
+        {
+            error = std::max(error, std::abs(expected[i] - actual[i]));
+        }
+
+        return error;
+    }
+
+    AccessorType GetAccessorType(TargetPath path)
+    {
+        switch (path)
+        {
+        case TARGET_TRANSLATION:
+        case TARGET_SCALE:
+            return TYPE_VEC3;
+        case TARGET_ROTATION:
+            return TYPE_VEC4;
+        default:
+            return TYPE_SCALAR;
+        }
+    }
+}
+
+float AnimationOptimizationUtils::GetTolerance(const Options& options, TargetPath path)
+{
+    switch (path)
+    {
+    case TARGET_TRANSLATION:
+        return options.translationTolerance;
+    case TARGET_ROTATION:
+        return options.rotationTolerance;
+    case TARGET_SCALE:
+        return options.scaleTolerance;
+    case TARGET_WEIGHTS:
+        return options.weightTolerance;
+    default:
+        throw GLTFException("Unknown animation channel target path");
+    }
+}
+
+AnimationCurve AnimationOptimizationUtils::ReduceKeyframes(const AnimationCurve& curve, float tolerance)
+{
+    const size_t keyframeCount = curve.times.size();
+    const size_t n = curve.componentCount;
+
+    if (curve.interpolation == INTERPOLATION_CUBICSPLINE || keyframeCount <= 2U)
+    {
+        return curve;
+    }
+
+    std::vector<size_t> kept = { 0U };
+
+    if (curve.interpolation == INTERPOLATION_STEP)
+    {
+        // A step keyframe is redundant if it holds the same value as the previous kept keyframe
+        for (size_t i = 1U; i + 1U < keyframeCount; ++i)
+        {
+            if (GetError(curve.path, curve.values.data() + kept.back() * n, curve.values.data() + i * n, n) > tolerance)
+            {
+                kept.push_back(i);
+            }
+        }
+    }
+    else
+    {
+        // Extends a segment from the last kept keyframe for as long as every keyframe it skips can be reconstructed by
+        // interpolating between the segment's ends
+        AnimationCurve segment;
+        segment.path = curve.path;
+        segment.interpolation = curve.interpolation;
+        segment.componentCount = n;
+        segment.times.resize(2U);
+        segment.values.resize(2U * n);
+
+        std::vector<float> value(n);
+
+        for (size_t end = 2U; end < keyframeCount; ++end)
+        {
+            const size_t begin = kept.back();
+
+            segment.times[0] = curve.times[begin];
+            segment.times[1] = curve.times[end];
+
+            std::copy(curve.values.begin() + begin * n, curve.values.begin() + (begin + 1U) * n, segment.values.begin());
+            std::copy(curve.values.begin() + end * n, curve.values.begin() + (end + 1U) * n, segment.values.begin() + n);
+
+            for (size_t i = begin + 1U; i < end; ++i)
+            {
+                size_t cursor = 0U;
+
+                AnimationEvaluator::Sample(segment, curve.times[i], cursor, value.data());
+
+                if (GetError(curve.path, curve.values.data() + i * n, value.data(), n) > tolerance)
+                {
+                    kept.push_back(end - 1U);
+                    break;
+                }
+            }
+        }
+    }
+
+    kept.push_back(keyframeCount - 1U);
+
+    AnimationCurve result;
+    result.path = curve.path;
+    result.interpolation = curve.interpolation;
+    result.componentCount = n;
+    result.times.reserve(kept.size());
+    result.values.reserve(kept.size() * n);
+
+    for (auto i : kept)
+    {
+        result.times.push_back(curve.times[i]);
+        result.values.insert(result.values.end(), curve.values.begin() + i * n, curve.values.begin() + (i + 1U) * n);
+    }
+
+    return result;
+}
+
+size_t AnimationOptimizationUtils::OptimizeAnimation(const Document& doc, const GLTFResourceReader& reader, Animation& animation, BufferBuilder& bufferBuilder,
+    const Options& options)
+{
+    // The first channel that uses each sampler determines its target path (and so its tolerance)
+    std::unordered_map<std::string, const AnimationChannel*> samplerChannels;
+
+    for (const auto& channel : animation.channels.Elements())
+    {
+        samplerChannels.emplace(channel.samplerId, &channel);
+    }
+
+    std::map<std::vector<float>, std::string> timesAccessorIds;
+    std::vector<AnimationSampler> samplers;
+
+    size_t removedCount = 0U;
+
+    for (const auto& sampler : animation.samplers.Elements())
+    {
+        const auto it = samplerChannels.find(sampler.id);
+
+        if (it == samplerChannels.end())
+        {
+            continue;
+        }
+
+        const auto curve = AnimationEvaluator::ReadCurve(doc, reader, animation, *it->second);
+        const auto reduced = ReduceKeyframes(curve, GetTolerance(options, curve.path));
+
+        removedCount += curve.times.size() - reduced.times.size();
+
+        AnimationSampler newSampler = sampler;
+
+        auto& timesAccessorId = timesAccessorIds[reduced.times];
+
+        if (timesAccessorId.empty())
+        {
+            bufferBuilder.AddBufferView(BufferViewTarget::UNKNOWN_BUFFER);
+            timesAccessorId = bufferBuilder.AddAccessor(reduced.times, { TYPE_SCALAR, COMPONENT_FLOAT, false, { reduced.times.front() }, { reduced.times.back() } }).id;
+        }
+
+        newSampler.inputAccessorId = timesAccessorId;
+
+        bufferBuilder.AddBufferView(BufferViewTarget::UNKNOWN_BUFFER);
+
+        if (reduced.path == TARGET_ROTATION && options.quantizeRotations)
+        {
+            std::vector<int16_t> quantized(reduced.values.size());
+
+            std::transform(reduced.values.begin(), reduced.values.end(), quantized.begin(), AnimationUtils::FloatToComponent<int16_t>);
+
+            newSampler.outputAccessorId = bufferBuilder.AddAccessor(quantized, { TYPE_VEC4, COMPONENT_SHORT, true }).id;
+        }
+        else
+        {
+            newSampler.outputAccessorId = bufferBuilder.AddAccessor(reduced.values, { GetAccessorType(reduced.path), COMPONENT_FLOAT }).id;
+        }
+
+        samplers.push_back(std::move(newSampler));
+    }
+
+    for (auto& sampler : samplers)
+    {
+        animation.samplers.Replace(std::move(sampler));
+    }
+
+    return removedCount;
+}
@@ -3,6 +3,7 @@
 
 #include <GLTFSDK/AnimationUtils.h>
 
+#include <GLTFSDK/ConversionUtils.h>
 #include <GLTFSDK/GLTF.h>
 #include <GLTFSDK/GLTFResourceReader.h>
 
@@ -10,18 +11,23 @@ using namespace Microsoft::glTF;
 
 namespace
 {
+    // Animation outputs (rotations and morph target weights) with integer component types are always normalized
     template<typename T>
-    std::vector<float> GetMorphWeightFloats(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
+    std::vector<float> GetNormalizedFloats(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
     {
-        std::vector<T> rawWeights = reader.ReadBinaryData<T>(doc, accessor);
+        const size_t typeCount = Accessor::GetTypeCount(accessor.type);
 
-        std::vector<float> floatWeights;
-        floatWeights.reserve(rawWeights.size());
+        // Ensure the accessor's count is consistent with its buffer view before allocating
+        Validation::ValidateAccessor(doc, accessor);
 
-        std::transform(rawWeights.begin(), rawWeights.end(), std::back_inserter(floatWeights),
-            [](T value) -> float { return AnimationUtils::ComponentToFloat(value); });
+        std::vector<float> floatValues(accessor.count * typeCount);
 
-        return floatWeights;
+        reader.ReadBinaryDataChunked<T>(doc, accessor, [&](const T* rawValues, size_t first, size_t count)
+        {
+            ConversionUtils::ToFloat(rawValues, accessor.componentType, true, floatValues.data() + first * typeCount, count * typeCount);
+        });
+
+        return floatValues;
     }
 }
 
@@ -95,12 +101,17 @@ std::vector<float> AnimationUtils::GetRotations(const Document& doc, const GLTFR
         throw GLTFException("Invalid type for rotations accessor " + accessor.id);
     }
 
-    if (accessor.componentType != COMPONENT_FLOAT)
+    switch (accessor.componentType)
     {
+    case COMPONENT_FLOAT:
+        return reader.ReadBinaryData<float>(doc, accessor);
+    case COMPONENT_BYTE:
+        return GetNormalizedFloats<int8_t>(doc, reader, accessor);
+    case COMPONENT_SHORT:
+        return GetNormalizedFloats<int16_t>(doc, reader, accessor);
+    default:
         throw GLTFException("Invalid componentType for rotations accessor " + accessor.id);
     }
-
-    return reader.ReadBinaryData<float>(doc, accessor);
 }
 
 std::vector<float> AnimationUtils::GetRotations(const Document& doc, const GLTFResourceReader& reader, const AnimationSampler& sampler)
@@ -148,22 +159,22 @@ std::vector<float> AnimationUtils::GetMorphWeights(const Document& doc, const GL
     break;
     case COMPONENT_BYTE:
     {
-        return GetMorphWeightFloats<int8_t>(doc, reader, accessor);
+        return GetNormalizedFloats<int8_t>(doc, reader, accessor);
     }
     break;
     case COMPONENT_UNSIGNED_BYTE:
     {
-        return GetMorphWeightFloats<uint8_t>(doc, reader, accessor);
+        return GetNormalizedFloats<uint8_t>(doc, reader, accessor);
     }
     break;
     case COMPONENT_SHORT:
     {
-        return GetMorphWeightFloats<int16_t>(doc, reader, accessor);
+        return GetNormalizedFloats<int16_t>(doc, reader, accessor);
     }
     break;
     case COMPONENT_UNSIGNED_SHORT:
     {
-        return GetMorphWeightFloats<uint16_t>(doc, reader, accessor);
+        return GetNormalizedFloats<uint16_t>(doc, reader, accessor);
     }
     break;
     default:
@@ -0,0 +1,410 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/AsyncResourceWriter.h>
+
+#include <algorithm>
+#include <cassert>
+
+using namespace Microsoft::glTF;
+
+// Accumulates written data into blocks, each full block is handed to the AsyncResourceWriter's queue. Blocks only reserve
+// their storage and data is appended to them so that each byte is written once (no put area is used as that would require
+// the whole block to be resized, and so zero filled, before it could be written to)
+class AsyncResourceWriter::BlockStreamBuf : public std::streambuf
+{
+public:
+    BlockStreamBuf(AsyncResourceWriter& writer, const BlockStream& stream) : m_writer(writer), m_stream(stream)
+    {
+    }
+
+    void Submit()
+    {
+        if (!m_block.empty())
+        {
+            m_writer.SubmitBlock(m_stream, std::move(m_block));
+            m_block = {};
+        }
+    }
+
+protected:
+    std::streamsize xsputn(const char_type* s, std::streamsize count) override
+    {
+        const size_t blockByteLength = m_writer.m_blockByteLength;
+
+        for (auto remaining = static_cast<size_t>(count); remaining > 0U;)
+        {
+            if (m_block.capacity() == 0U)
+            {
+                m_block = m_writer.AcquireBlock();
+            }
+
+            const size_t appendCount = std::min(remaining, blockByteLength - m_block.size());
+
+            m_block.insert(m_block.end(), s, s + appendCount);
+
+            s += appendCount;
+            remaining -= appendCount;
+
+            if (m_block.size() == blockByteLength)
+            {
+                Submit();
+            }
+        }
+
+        return count;
+    }
+
+    int_type overflow(int_type ch) override
+    {
+        if (!traits_type::eq_int_type(ch, traits_type::eof()))
+        {
+            const char_type c = traits_type::to_char_type(ch);
+            xsputn(&c, 1);
+        }
+
+        return traits_type::not_eof(ch);
+    }
+
+    int sync() override
+    {
+        Submit();
+        return 0;
+    }
+
+private:
+    AsyncResourceWriter& m_writer;
+    const BlockStream& m_stream;
+
+    std::vector<char> m_block;
+};
+
+class AsyncResourceWriter::BlockStream : public std::ostream
+{
+public:
+    BlockStream(AsyncResourceWriter& writer, std::string id, bool isExternal) : std::ostream(nullptr),
+        m_id(std::move(id)),
+        m_isExternal(isExternal),
+        m_streamBuf(writer, *this)
+    {
+        rdbuf(&m_streamBuf);
+
+        // Rethrow errors from the background thread (reported when submitting a block) rather than just setting badbit
+        exceptions(std::ios::badbit);
+    }
+
+    void Submit()
+    {
+        m_streamBuf.Submit();
+    }
+
+    const std::string& GetId() const
+    {
+        return m_id;
+    }
+
+    bool IsExternal() const
+    {
+        return m_isExternal;
+    }
+
+private:
+    const std::string m_id;
+    const bool m_isExternal;
+
+    BlockStreamBuf m_streamBuf;
+};
+
+// Routes ResourceWriter::WriteExternal through the block queue so that all access to the wrapped ResourceWriter happens on the background thread
+class AsyncResourceWriter::StreamWriterCache : public IStreamWriterCache
+{
+public:
+    StreamWriterCache(AsyncResourceWriter& writer) : m_writer(writer)
+    {
+    }
+
+    std::shared_ptr<std::ostream> Get(const std::string& uri) override
+    {
+        // Aliasing constructor - the AsyncResourceWriter owns the stream
+        return std::shared_ptr<std::ostream>(std::shared_ptr<std::ostream>(), &m_writer.GetStream(m_writer.m_externalStreams, uri, true));
+    }
+
+    std::shared_ptr<std::ostream> Set(const std::string& uri, std::shared_ptr<std::ostream> stream) override
+    {
+        // Wait for the background thread to be idle before modifying the wrapped ResourceWriter's cache
+        m_writer.Flush();
+
+        return m_writer.m_resourceWriter->m_streamWriterCache->Set(uri, std::move(stream));
+    }
+
+private:
+    AsyncResourceWriter& m_writer;
+};
+
+AsyncResourceWriter::AsyncResourceWriter(std::unique_ptr<ResourceWriter> resourceWriter, size_t blockByteLength, size_t maxQueuedBlocks)
+    : ResourceWriter(std::make_unique<StreamWriterCache>(*this)),
+    m_resourceWriter(std::move(resourceWriter)),
+    m_blockByteLength(blockByteLength),
+    m_maxQueuedBlocks(maxQueuedBlocks),
+    m_errorReported(false),
+    m_busy(false),
+    m_stop(false)
+{
+    if (!m_resourceWriter)
+    {
+        throw GLTFException("AsyncResourceWriter requires a ResourceWriter to decorate");
+    }
+
+    if (m_blockByteLength == 0U || m_maxQueuedBlocks == 0U)
+    {
+        throw GLTFException("AsyncResourceWriter block byte length and maximum queued block count must be non-zero");
+    }
+
+    m_thread = std::thread(&AsyncResourceWriter::Run, this);
+}
+
+AsyncResourceWriter::~AsyncResourceWriter()
+{
+    // Only the producer thread reads or writes m_errorReported
+    const bool errorReported = m_errorReported;
+
+    // Partially filled blocks are queued so that the background thread writes all data before it stops
+    try
+    {
+        SubmitBlocks();
+    }
+    catch (...)
+    {
+        // The error is m_error, checked below once the background thread has stopped
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+
+    m_consumerCondition.notify_all();
+    m_thread.join();
+
+    // Flush should have been called, a write error can't be thrown from here and would otherwise go unnoticed
+    assert(!m_error || errorReported);
+}
+
+std::string AsyncResourceWriter::GenerateBufferUri(const std::string& bufferId) const
+{
+    return m_resourceWriter->GenerateBufferUri(bufferId);
+}
+
+void AsyncResourceWriter::Flush()
+{
+    SubmitBlocks();
+
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        m_producerCondition.wait(lock, [this]() { return m_queue.empty() && !m_busy; });
+
+        if (m_error)
+        {
+            m_errorReported = true;
+            std::rethrow_exception(m_error);
+        }
+    }
+
+    // The background thread is idle so the wrapped ResourceWriter's streams can be flushed from this thread. Short writes to a
+    // buffered stream (e.g. a std::ofstream on a full disk) are only reported once the stream is flushed
+    for (const auto& stream : m_bufferStreams)
+    {
+        FlushStream(m_resourceWriter->GetBufferStream(stream.first));
+    }
+
+    for (const auto& stream : m_externalStreams)
+    {
+        FlushStream(m_resourceWriter->m_streamWriterCache->Get(stream.first).get());
+    }
+}
+
+ResourceWriter& AsyncResourceWriter::GetResourceWriter()
+{
+    return *m_resourceWriter;
+}
+
+const ResourceWriter& AsyncResourceWriter::GetResourceWriter() const
+{
+    return *m_resourceWriter;
+}
+
+std::ostream* AsyncResourceWriter::GetBufferStream(const std::string& bufferId)
+{
+    return &GetStream(m_bufferStreams, bufferId, false);
+}
+
+std::streamoff AsyncResourceWriter::GetBufferOffset(const std::string& bufferId)
+{
+    // Default constructs an offset value (i.e. zero) if there was no entry in the map
+    return m_streamOffsets[bufferId];
+}
+
+void AsyncResourceWriter::SetBufferOffset(const std::string& bufferId, std::streamoff offset)
+{
+    m_streamOffsets[bufferId] = offset;
+}
+
+AsyncResourceWriter::BlockStream& AsyncResourceWriter::GetStream(std::unordered_map<std::string, std::unique_ptr<BlockStream>>& streams, const std::string& id, bool isExternal)
+{
+    auto& stream = streams[id];
+
+    if (!stream)
+    {
+        stream = std::make_unique<BlockStream>(*this, id, isExternal);
+    }
+
+    return *stream;
+}
+
+std::vector<char> AsyncResourceWriter::AcquireBlock()
+{
+    std::vector<char> data;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (!m_freeBlocks.empty())
+        {
+            data = std::move(m_freeBlocks.back());
+            m_freeBlocks.pop_back();
+        }
+    }
+
+    // Only reserve the block's storage, BlockStreamBuf appends to it so just the bytes written are ever touched
+    data.reserve(m_blockByteLength);
+
+    return data;
+}
+
+void AsyncResourceWriter::SubmitBlock(const BlockStream& stream, std::vector<char> data)
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        m_producerCondition.wait(lock, [this]() { return m_error || m_queue.size() < m_maxQueuedBlocks; });
+
+        if (m_error)
+        {
+            m_errorReported = true;
+            std::rethrow_exception(m_error);
+        }
+
+        m_queue.push_back({ &stream, std::move(data) });
+    }
+
+    m_consumerCondition.notify_one();
+}
+
+void AsyncResourceWriter::SubmitBlocks()
+{
+    for (auto& stream : m_bufferStreams)
+    {
+        stream.second->Submit();
+    }
+
+    for (auto& stream : m_externalStreams)
+    {
+        stream.second->Submit();
+    }
+}
+
+void AsyncResourceWriter::Run()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (true)
+    {
+        m_consumerCondition.wait(lock, [this]() { return m_stop || !m_queue.empty(); });
+
+        // Blocks still queued when stopping are written first
+        if (m_stop && m_queue.empty())
+        {
+            break;
+        }
+
+        Block block = std::move(m_queue.front());
+        m_queue.pop_front();
+
+        // Once an error has occurred subsequent blocks are discarded
+        const bool discard = static_cast<bool>(m_error);
+        std::exception_ptr error;
+
+        m_busy = true;
+        lock.unlock();
+
+        m_producerCondition.notify_all();
+
+        if (!discard)
+        {
+            try
+            {
+                WriteBlock(block);
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+        }
+
+        lock.lock();
+
+        if (error)
+        {
+            m_error = error;
+        }
+
+        // Recycle the block's storage - at most one block per queue entry, plus the one being filled, is ever needed
+        if (m_freeBlocks.size() <= m_maxQueuedBlocks)
+        {
+            block.data.clear();
+            m_freeBlocks.push_back(std::move(block.data));
+        }
+
+        m_busy = false;
+        m_producerCondition.notify_all();
+    }
+}
+
+void AsyncResourceWriter::WriteBlock(const Block& block)
+{
+    const auto& id = block.stream->GetId();
+
+    if (block.stream->IsExternal())
+    {
+        if (auto stream = m_resourceWriter->m_streamWriterCache->Get(id))
+        {
+            WriteBlockData(*stream, block.data);
+        }
+    }
+    else if (auto stream = m_resourceWriter->GetBufferStream(id))
+    {
+        WriteBlockData(*stream, block.data);
+
+        const auto bufferOffset = m_resourceWriter->GetBufferOffset(id);
+
+        m_resourceWriter->SetBufferOffset(id, bufferOffset + static_cast<std::streamoff>(block.data.size()));
+    }
+}
+
+void AsyncResourceWriter::WriteBlockData(std::ostream& stream, const std::vector<char>& data)
+{
+    // The stream is only flushed by Flush so that the wrapped stream's own buffering isn't defeated by each block
+    if (stream.write(data.data(), static_cast<std::streamsize>(data.size())).fail())
+    {
+        throw GLTFException("Unable to write to stream.");
+    }
+}
+
+void AsyncResourceWriter::FlushStream(std::ostream* stream)
+{
+    if (stream && stream->flush().fail())
+    {
+        throw GLTFException("Unable to write to stream.");
+    }
+}
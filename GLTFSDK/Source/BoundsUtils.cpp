@@ -0,0 +1,665 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/BoundsUtils.h>
+
+#include <GLTFSDK/Document.h>
+#include <GLTFSDK/GLTFResourceReader.h>
+#include <GLTFSDK/MeshPrimitiveUtils.h>
+#include <GLTFSDK/PoseUtils.h>
+#include <GLTFSDK/SIMD.h>
+
+#include <algorithm>
+#include <limits>
+#include <tuple>
+#include <unordered_map>
+
+using namespace Microsoft::glTF;
+using namespace Microsoft::glTF::BoundsUtils;
+
+namespace
+{
+    // The number of candidate split positions evaluated along each axis (minus one) when building a BVH
+    constexpr size_t BinCount = 16U;
+
+    constexpr size_t NoParent = std::numeric_limits<size_t>::max();
+
+    float GetComponent(const Vector3& v, size_t axis)
+    {
+        return axis == 0U ? v.x : (axis == 1U ? v.y : v.z);
+    }
+
+    BoundingBox GetAccessorBounds(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
+    {
+        // Only float min and max values are used as they're otherwise ambiguous for normalized accessors
+        if (accessor.componentType == COMPONENT_FLOAT && accessor.min.size() == 3U && accessor.max.size() == 3U)
+        {
+            return BoundingBox(
+                Vector3(accessor.min[0], accessor.min[1], accessor.min[2]),
+                Vector3(accessor.max[0], accessor.max[1], accessor.max[2]));
+        }
+
+        const auto positions = MeshPrimitiveUtils::GetPositions(doc, reader, accessor);
+
+        return ComputeBounds(positions.data(), positions.size() / 3U);
+    }
+
+    // Returns the entry distance of the ray into the bounding box, or a negative value if it misses
+    float IntersectRay(const BoundingBox& boundingBox, const Vector3& origin, const Vector3& direction)
+    {
+        float tMin = 0.0f;
+        float tMax = std::numeric_limits<float>::infinity();
+
+        for (size_t axis = 0U; axis < 3U; ++axis)
+        {
+            const float o = GetComponent(origin, axis);
+            const float d = GetComponent(direction, axis);
+            const float lo = GetComponent(boundingBox.min, axis);
+            const float hi = GetComponent(boundingBox.max, axis);
+
+            if (d == 0.0f)
+            {
+                if (o < lo || o > hi)
+                {
+                    return -1.0f;
+                }
+
+                continue;
+            }
+
+            float t0 = (lo - o) / d;
+            float t1 = (hi - o) / d;
+
+            if (t0 > t1)
+            {
+                std::swap(t0, t1);
+            }
+
+            tMin = std::max(tMin, t0);
+            tMax = std::min(tMax, t1);
+
+            if (tMin > tMax)
+            {
+                return -1.0f;
+            }
+        }
+
+        return tMin;
+    }
+
+    Matrix4 ComputeWorldTransform(const Document& doc, const PoseUtils::NodeHierarchy& hierarchy, size_t nodeIndex)
+    {
+        Matrix4 transform = GetLocalTransform(doc.nodes[nodeIndex]);
+
+        for (size_t parent = hierarchy.parents[nodeIndex]; parent != PoseUtils::NoParent; parent = hierarchy.parents[parent])
+        {
+            transform = Math::Multiply(GetLocalTransform(doc.nodes[parent]), transform);
+        }
+
+        return transform;
+    }
+
+    // Appends the mesh instances of the subtrees of each of the root nodes (in depth first order)
+    void AppendMeshInstances(const Document& doc, const GLTFResourceReader& reader, const std::vector<std::string>& rootIds, const Matrix4& rootTransform,
+        std::vector<MeshInstance>& meshInstances)
+    {
+        std::unordered_map<std::string, BoundingBox> meshBounds;
+        std::vector<std::pair<std::string, Matrix4>> stack;
+
+        for (auto it = rootIds.rbegin(); it != rootIds.rend(); ++it)
+        {
+            stack.emplace_back(*it, rootTransform);
+        }
+
+        while (!stack.empty())
+        {
+            const auto nodeId = std::move(stack.back().first);
+            const auto parentTransform = stack.back().second;
+
+            stack.pop_back();
+
+            const auto& node = doc.nodes.Get(nodeId);
+            const auto worldTransform = Math::Multiply(parentTransform, GetLocalTransform(node));
+
+            if (!node.meshId.empty())
+            {
+                auto it = meshBounds.find(node.meshId);
+
+                if (it == meshBounds.end())
+                {
+                    it = meshBounds.emplace(node.meshId, GetBounds(doc, reader, doc.meshes.Get(node.meshId))).first;
+                }
+
+                meshInstances.push_back({ nodeId, node.meshId, worldTransform, Transform(it->second, worldTransform) });
+            }
+
+            for (auto it = node.children.rbegin(); it != node.children.rend(); ++it)
+            {
+                stack.emplace_back(*it, worldTransform);
+            }
+        }
+    }
+}
+
+BoundingBox::BoundingBox()
+    : min(std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity()),
+      max(-std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity())
+{
+}
+
+BoundingBox::BoundingBox(const Vector3& min, const Vector3& max)
+    : min(min), max(max)
+{
+}
+
+bool BoundingBox::IsEmpty() const
+{
+    return !(min.x <= max.x && min.y <= max.y && min.z <= max.z);
+}
+
+Vector3 BoundingBox::GetCenter() const
+{
+    return Vector3((min.x + max.x) * 0.5f, (min.y + max.y) * 0.5f, (min.z + max.z) * 0.5f);
+}
+
+float BoundingBox::GetSurfaceArea() const
+{
+    if (IsEmpty())
+    {
+        return 0.0f;
+    }
+
+    const float x = max.x - min.x;
+    const float y = max.y - min.y;
+    const float z = max.z - min.z;
+
+    return 2.0f * (x * y + y * z + z * x);
+}
+
+void BoundingBox::Merge(const Vector3& point)
+{
+    min = Vector3(std::min(min.x, point.x), std::min(min.y, point.y), std::min(min.z, point.z));
+    max = Vector3(std::max(max.x, point.x), std::max(max.y, point.y), std::max(max.z, point.z));
+}
+
+void BoundingBox::Merge(const BoundingBox& other)
+{
+    min = Vector3(std::min(min.x, other.min.x), std::min(min.y, other.min.y), std::min(min.z, other.min.z));
+    max = Vector3(std::max(max.x, other.max.x), std::max(max.y, other.max.y), std::max(max.z, other.max.z));
+}
+
+bool BoundingBox::Intersects(const BoundingBox& other) const
+{
+    return min.x <= other.max.x && other.min.x <= max.x
+        && min.y <= other.max.y && other.min.y <= max.y
+        && min.z <= other.max.z && other.min.z <= max.z;
+}
+
+bool BoundingBox::operator==(const BoundingBox& other) const
+{
+    return std::tie(min, max) == std::tie(other.min, other.max);
+}
+
+bool BoundingBox::operator!=(const BoundingBox& other) const
+{
+    return !operator==(other);
+}
+
+BoundingBox BoundsUtils::Transform(const BoundingBox& boundingBox, const Matrix4& matrix)
+{
+    if (boundingBox.IsEmpty())
+    {
+        return boundingBox;
+    }
+
+    BoundingBox result;
+
+    Math::TransformBounds(&matrix, &boundingBox.min, &boundingBox.max, 1U, &result.min, &result.max);
+
+    return result;
+}
+
+BoundingBox BoundsUtils::ComputeBounds(const float* positions, size_t count)
+{
+    float min[3] = { std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity() };
+    float max[3] = { -std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity() };
+
+    size_t i = 0U;
+
+#ifdef GLTFSDK_SSE2
+    if (count >= 4U)
+    {
+        // Four positions (twelve floats) per iteration - the three registers hold the components in the orders xyzx, yzxy and
+        // zxyz so each lane always sees the same component
+        __m128 minA = _mm_loadu_ps(positions);
+        __m128 minB = _mm_loadu_ps(positions + 4U);
+        __m128 minC = _mm_loadu_ps(positions + 8U);
+        __m128 maxA = minA;
+        __m128 maxB = minB;
+        __m128 maxC = minC;
+
+        for (i = 4U; i + 4U <= count; i += 4U)
+        {
+            const __m128 a = _mm_loadu_ps(positions + i * 3U);
+            const __m128 b = _mm_loadu_ps(positions + i * 3U + 4U);
+            const __m128 c = _mm_loadu_ps(positions + i * 3U + 8U);
+
+            minA = _mm_min_ps(minA, a);
+            minB = _mm_min_ps(minB, b);
+            minC = _mm_min_ps(minC, c);
+            maxA = _mm_max_ps(maxA, a);
+            maxB = _mm_max_ps(maxB, b);
+            maxC = _mm_max_ps(maxC, c);
+        }
+
+        float lanes[12];
+
+        _mm_storeu_ps(lanes, minA);
+        _mm_storeu_ps(lanes + 4U, minB);
+        _mm_storeu_ps(lanes + 8U, minC);
+
+        for (size_t j = 0U; j < 12U; ++j)
+        {
+            min[j % 3U] = std::min(min[j % 3U], lanes[j]);
+        }
+
+        _mm_storeu_ps(lanes, maxA);
+        _mm_storeu_ps(lanes + 4U, maxB);
+        _mm_storeu_ps(lanes + 8U, maxC);
+
+        for (size_t j = 0U; j < 12U; ++j)
+        {
+            max[j % 3U] = std::max(max[j % 3U], lanes[j]);
+        }
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        for (size_t j = 0U; j < 3U; ++j)
+        {
+            min[j] = std::min(min[j], positions[i * 3U + j]);
+            max[j] = std::max(max[j], positions[i * 3U + j]);
+        }
+    }
+
+    return BoundingBox(Vector3(min[0], min[1], min[2]), Vector3(max[0], max[1], max[2]));
+}
+
+BoundingBox BoundsUtils::GetBounds(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive)
+{
+    const auto& accessor = doc.accessors.Get(meshPrimitive.GetAttributeAccessorId(ACCESSOR_POSITION));
+
+    auto bounds = GetAccessorBounds(doc, reader, accessor);
+
+    if (bounds.IsEmpty())
+    {
+        return bounds;
+    }
+
+    // Each morph target can displace the vertices by up to its own bounds
+    for (const auto& target : meshPrimitive.targets)
+    {
+        if (!target.positionsAccessorId.empty())
+        {
+            const auto displacement = GetAccessorBounds(doc, reader, doc.accessors.Get(target.positionsAccessorId));
+
+            if (!displacement.IsEmpty())
+            {
+                bounds.min = Vector3(
+                    bounds.min.x + std::min(0.0f, displacement.min.x),
+                    bounds.min.y + std::min(0.0f, displacement.min.y),
+                    bounds.min.z + std::min(0.0f, displacement.min.z));
+                bounds.max = Vector3(
+                    bounds.max.x + std::max(0.0f, displacement.max.x),
+                    bounds.max.y + std::max(0.0f, displacement.max.y),
+                    bounds.max.z + std::max(0.0f, displacement.max.z));
+            }
+        }
+    }
+
+    return bounds;
+}
+
+BoundingBox BoundsUtils::GetBounds(const Document& doc, const GLTFResourceReader& reader, const Mesh& mesh)
+{
+    BoundingBox bounds;
+
+    for (const auto& meshPrimitive : mesh.primitives)
+    {
+        bounds.Merge(GetBounds(doc, reader, meshPrimitive));
+    }
+
+    return bounds;
+}
+
+Matrix4 BoundsUtils::GetLocalTransform(const Node& node)
+{
+    if (node.GetTransformationType() == TRANSFORMATION_MATRIX)
+    {
+        return node.matrix;
+    }
+
+    return Math::CreateTransform(node.translation, node.rotation, node.scale);
+}
+
+Matrix4 BoundsUtils::GetWorldTransform(const Document& doc, const std::string& nodeId)
+{
+    return GetWorldTransform(doc, PoseUtils::GetNodeHierarchy(doc), nodeId);
+}
+
+Matrix4 BoundsUtils::GetWorldTransform(const Document& doc, const PoseUtils::NodeHierarchy& hierarchy, const std::string& nodeId)
+{
+    return ComputeWorldTransform(doc, hierarchy, doc.nodes.GetIndex(nodeId));
+}
+
+std::vector<MeshInstance> BoundsUtils::GetMeshInstances(const Document& doc, const GLTFResourceReader& reader, const Scene& scene)
+{
+    std::vector<MeshInstance> meshInstances;
+
+    AppendMeshInstances(doc, reader, scene.nodes, Matrix4::IDENTITY, meshInstances);
+
+    return meshInstances;
+}
+
+BoundingBox BoundsUtils::GetSceneBounds(const Document& doc, const GLTFResourceReader& reader, const Scene& scene)
+{
+    BoundingBox bounds;
+
+    for (const auto& meshInstance : GetMeshInstances(doc, reader, scene))
+    {
+        bounds.Merge(meshInstance.bounds);
+    }
+
+    return bounds;
+}
+
+BoundingBox BoundsUtils::GetNodeBounds(const Document& doc, const GLTFResourceReader& reader, const std::string& nodeId)
+{
+    const auto hierarchy = PoseUtils::GetNodeHierarchy(doc);
+    const size_t parent = hierarchy.parents[doc.nodes.GetIndex(nodeId)];
+
+    std::vector<MeshInstance> meshInstances;
+
+    AppendMeshInstances(doc, reader, { nodeId }, parent == PoseUtils::NoParent ? Matrix4::IDENTITY : ComputeWorldTransform(doc, hierarchy, parent), meshInstances);
+
+    BoundingBox bounds;
+
+    for (const auto& meshInstance : meshInstances)
+    {
+        bounds.Merge(meshInstance.bounds);
+    }
+
+    return bounds;
+}
+
+Bvh BoundsUtils::BuildBvh(const std::vector<BoundingBox>& bounds, size_t maxLeafSize)
+{
+    if (maxLeafSize == 0U)
+    {
+        throw GLTFException("The maximum BVH leaf size must be at least 1");
+    }
+
+    Bvh bvh;
+
+    bvh.itemBounds = bounds;
+
+    std::vector<Vector3> centers(bounds.size());
+
+    for (size_t i = 0U; i < bounds.size(); ++i)
+    {
+        if (!bounds[i].IsEmpty())
+        {
+            bvh.items.push_back(static_cast<uint32_t>(i));
+            centers[i] = bounds[i].GetCenter();
+        }
+    }
+
+    if (bvh.items.empty())
+    {
+        return bvh;
+    }
+
+    struct Range
+    {
+        size_t begin;
+        size_t end;
+        size_t parent; // The index of the parent node if this is its second child, or NoParent
+    };
+
+    std::vector<Range> stack = { { 0U, bvh.items.size(), NoParent } };
+
+    while (!stack.empty())
+    {
+        const Range range = stack.back();
+        stack.pop_back();
+
+        const size_t nodeIndex = bvh.nodes.size();
+
+        if (range.parent != NoParent)
+        {
+            bvh.nodes[range.parent].offset = static_cast<uint32_t>(nodeIndex);
+        }
+
+        BoundingBox nodeBounds;
+        BoundingBox centerBounds;
+
+        for (size_t i = range.begin; i < range.end; ++i)
+        {
+            nodeBounds.Merge(bounds[bvh.items[i]]);
+            centerBounds.Merge(centers[bvh.items[i]]);
+        }
+
+        const size_t count = range.end - range.begin;
+
+        if (count <= maxLeafSize)
+        {
+            bvh.nodes.push_back({ nodeBounds, static_cast<uint32_t>(range.begin), static_cast<uint32_t>(count) });
+            continue;
+        }
+
+        // Bins the item centers along each axis and chooses the bin boundary with the lowest surface area heuristic cost
+        float bestCost = std::numeric_limits<float>::infinity();
+        size_t bestAxis = 0U;
+        size_t bestBin = 0U;
+
+        for (size_t axis = 0U; axis < 3U; ++axis)
+        {
+            const float lo = GetComponent(centerBounds.min, axis);
+            const float extent = GetComponent(centerBounds.max, axis) - lo;
+
+            if (!(extent > 0.0f))
+            {
+                continue;
+            }
+
+            const float scale = BinCount / extent;
+
+            BoundingBox binBounds[BinCount];
+            size_t binCounts[BinCount] = {};
+
+            for (size_t i = range.begin; i < range.end; ++i)
+            {
+                const size_t bin = std::min(BinCount - 1U, static_cast<size_t>((GetComponent(centers[bvh.items[i]], axis) - lo) * scale));
+
+                binBounds[bin].Merge(bounds[bvh.items[i]]);
+                ++binCounts[bin];
+            }
+
+            // Sweeps from the right to find the area and count of every right hand side and then from the left to evaluate
+            // each split (after bin i)
+            float rightAreas[BinCount];
+            size_t rightCounts[BinCount];
+
+            BoundingBox right;
+            size_t rightCount = 0U;
+
+            for (size_t i = BinCount - 1U; i > 0U; --i)
+            {
+                right.Merge(binBounds[i]);
+                rightCount += binCounts[i];
+
+                rightAreas[i] = right.GetSurfaceArea();
+                rightCounts[i] = rightCount;
+            }
+
+            BoundingBox left;
+            size_t leftCount = 0U;
+
+            for (size_t i = 0U; i < BinCount - 1U; ++i)
+            {
+                left.Merge(binBounds[i]);
+                leftCount += binCounts[i];
+
+                if (leftCount == 0U || rightCounts[i + 1U] == 0U)
+                {
+                    continue;
+                }
+
+                const float cost = left.GetSurfaceArea() * leftCount + rightAreas[i + 1U] * rightCounts[i + 1U];
+
+                if (cost < bestCost)
+                {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestBin = i;
+                }
+            }
+        }
+
+        auto first = bvh.items.begin() + range.begin;
+        auto last = bvh.items.begin() + range.end;
+        auto middle = first + count / 2U;
+
+        if (bestCost < std::numeric_limits<float>::infinity())
+        {
+            const float lo = GetComponent(centerBounds.min, bestAxis);
+            const float scale = BinCount / (GetComponent(centerBounds.max, bestAxis) - lo);
+
+            middle = std::partition(first, last, [&](uint32_t item)
+            {
+                return std::min(BinCount - 1U, static_cast<size_t>((GetComponent(centers[item], bestAxis) - lo) * scale)) <= bestBin;
+            });
+        }
+        // Otherwise every item has the same center so they're split evenly
+
+        const size_t split = range.begin + static_cast<size_t>(middle - first);
+
+        bvh.nodes.push_back({ nodeBounds, 0U, 0U });
+
+        // The first child is processed next so that it immediately follows its parent
+        stack.push_back({ split, range.end, nodeIndex });
+        stack.push_back({ range.begin, split, NoParent });
+    }
+
+    return bvh;
+}
+
+Bvh BoundsUtils::BuildBvh(const std::vector<MeshInstance>& meshInstances, size_t maxLeafSize)
+{
+    std::vector<BoundingBox> bounds;
+    bounds.reserve(meshInstances.size());
+
+    for (const auto& meshInstance : meshInstances)
+    {
+        bounds.push_back(meshInstance.bounds);
+    }
+
+    return BuildBvh(bounds, maxLeafSize);
+}
+
+std::vector<uint32_t> BoundsUtils::QueryBvh(const Bvh& bvh, const BoundingBox& boundingBox)
+{
+    std::vector<uint32_t> result;
+
+    if (bvh.nodes.empty())
+    {
+        return result;
+    }
+
+    std::vector<size_t> stack = { 0U };
+
+    while (!stack.empty())
+    {
+        const auto& node = bvh.nodes[stack.back()];
+        const size_t nodeIndex = stack.back();
+
+        stack.pop_back();
+
+        if (!node.bounds.Intersects(boundingBox))
+        {
+            continue;
+        }
+
+        if (node.IsLeaf())
+        {
+            for (size_t i = node.offset; i < node.offset + node.itemCount; ++i)
+            {
+                if (bvh.itemBounds[bvh.items[i]].Intersects(boundingBox))
+                {
+                    result.push_back(bvh.items[i]);
+                }
+            }
+        }
+        else
+        {
+            stack.push_back(node.offset);
+            stack.push_back(nodeIndex + 1U);
+        }
+    }
+
+    return result;
+}
+
+std::vector<uint32_t> BoundsUtils::QueryBvh(const Bvh& bvh, const Vector3& origin, const Vector3& direction)
+{
+    std::vector<std::pair<float, uint32_t>> hits;
+
+    if (!bvh.nodes.empty())
+    {
+        std::vector<size_t> stack = { 0U };
+
+        while (!stack.empty())
+        {
+            const auto& node = bvh.nodes[stack.back()];
+            const size_t nodeIndex = stack.back();
+
+            stack.pop_back();
+
+            if (IntersectRay(node.bounds, origin, direction) < 0.0f)
+            {
+                continue;
+            }
+
+            if (node.IsLeaf())
+            {
+                for (size_t i = node.offset; i < node.offset + node.itemCount; ++i)
+                {
+                    const float distance = IntersectRay(bvh.itemBounds[bvh.items[i]], origin, direction);
+
+                    if (distance >= 0.0f)
+                    {
+                        hits.emplace_back(distance, bvh.items[i]);
+                    }
+                }
+            }
+            else
+            {
+                stack.push_back(node.offset);
+                stack.push_back(nodeIndex + 1U);
+            }
+        }
+    }
+
+    std::sort(hits.begin(), hits.end());
+
+    std::vector<uint32_t> result;
+    result.reserve(hits.size());
+
+    for (const auto& hit : hits)
+    {
+        result.push_back(hit.second);
+    }
+
+    return result;
+}
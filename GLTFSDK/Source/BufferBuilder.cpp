@@ -4,11 +4,249 @@
 #include <GLTFSDK/BufferBuilder.h>
 
 #include <GLTFSDK/ResourceWriter.h>
+#include <GLTFSDK/SIMD.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
 
 using namespace Microsoft::glTF;
 
 namespace
 {
+    uint64_t RotL64(uint64_t x, int r)
+    {
+        return (x << r) | (x >> (64 - r));
+    }
+
+    uint64_t FMix64(uint64_t k)
+    {
+        k ^= k >> 33;
+        k *= 0xFF51AFD7ED558CCDULL;
+        k ^= k >> 33;
+        k *= 0xC4CEB9FE1A85EC53ULL;
+        k ^= k >> 33;
+
+        return k;
+    }
+
+    // MurmurHash3 (x64, 128-bit variant) - used to identify buffer view payloads when deduplication is enabled
+    std::array<uint64_t, 2> Hash128(const void* data, size_t byteLength, uint64_t seed)
+    {
+        const uint64_t c1 = 0x87C37B91114253D5ULL;
+        const uint64_t c2 = 0x4CF5AD432745937FULL;
+
+        const auto bytes = static_cast<const uint8_t*>(data);
+        const size_t blockCount = byteLength / 16U;
+
+        uint64_t h1 = seed;
+        uint64_t h2 = seed;
+
+        for (size_t i = 0U; i < blockCount; ++i)
+        {
+            uint64_t k1;
+            uint64_t k2;
+
+            std::memcpy(&k1, bytes + i * 16U, sizeof(k1));
+            std::memcpy(&k2, bytes + i * 16U + 8U, sizeof(k2));
+
+            k1 *= c1; k1 = RotL64(k1, 31); k1 *= c2; h1 ^= k1;
+            h1 = RotL64(h1, 27); h1 += h2; h1 = h1 * 5U + 0x52DCE729U;
+
+            k2 *= c2; k2 = RotL64(k2, 33); k2 *= c1; h2 ^= k2;
+            h2 = RotL64(h2, 31); h2 += h1; h2 = h2 * 5U + 0x38495AB5U;
+        }
+
+        const uint8_t* tail = bytes + blockCount * 16U;
+        const size_t tailLength = byteLength & 15U;
+
+        uint64_t k1 = 0U;
+        uint64_t k2 = 0U;
+
+        for (size_t i = tailLength; i > 8U; --i)
+        {
+            k2 ^= static_cast<uint64_t>(tail[i - 1U]) << ((i - 9U) * 8U);
+        }
+
+        for (size_t i = std::min<size_t>(tailLength, 8U); i > 0U; --i)
+        {
+            k1 ^= static_cast<uint64_t>(tail[i - 1U]) << ((i - 1U) * 8U);
+        }
+
+        if (tailLength > 8U)
+        {
+            k2 *= c2; k2 = RotL64(k2, 33); k2 *= c1; h2 ^= k2;
+        }
+
+        if (tailLength > 0U)
+        {
+            k1 *= c1; k1 = RotL64(k1, 31); k1 *= c2; h1 ^= k1;
+        }
+
+        h1 ^= byteLength;
+        h2 ^= byteLength;
+
+        h1 += h2;
+        h2 += h1;
+
+        h1 = FMix64(h1);
+        h2 = FMix64(h2);
+
+        h1 += h2;
+        h2 += h1;
+
+        return { h1, h2 };
+    }
+
+    uint32_t GetMaxIndex(const uint32_t* indices, size_t count)
+    {
+        uint32_t maxIndex = 0U;
+        size_t i = 0U;
+
+#ifdef GLTFSDK_SSE2
+        if (count >= 4U)
+        {
+            // SSE2 only has a signed 32-bit comparison so values are biased into the signed range
+            const __m128i vBias = _mm_set1_epi32(std::numeric_limits<int32_t>::min());
+            __m128i vMax = vBias;
+
+            for (; i + 4U <= count; i += 4U)
+            {
+                const __m128i v = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(indices + i)), vBias);
+                const __m128i gt = _mm_cmpgt_epi32(v, vMax);
+
+                vMax = _mm_or_si128(_mm_and_si128(gt, v), _mm_andnot_si128(gt, vMax));
+            }
+
+            uint32_t lanes[4];
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), _mm_xor_si128(vMax, vBias));
+
+            maxIndex = std::max(std::max(lanes[0], lanes[1]), std::max(lanes[2], lanes[3]));
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            maxIndex = std::max(maxIndex, indices[i]);
+        }
+
+        return maxIndex;
+    }
+
+    // All indices must already be known to fit within the range of T
+    template<typename T>
+    void NarrowIndices(const uint32_t* indices, size_t count, T* narrowed)
+    {
+        size_t i = 0U;
+
+#ifdef GLTFSDK_SSE2
+        const auto load = [indices](size_t offset)
+        {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i*>(indices + offset));
+        };
+
+        if (sizeof(T) == sizeof(uint16_t))
+        {
+            // SSE2 only has a signed saturating 32 to 16-bit pack so values are biased into the signed range and back
+            const __m128i vBias = _mm_set1_epi32(32768);
+            const __m128i vUnbias = _mm_set1_epi16(static_cast<int16_t>(0x8000));
+
+            for (; i + 8U <= count; i += 8U)
+            {
+                const __m128i packed = _mm_packs_epi32(_mm_sub_epi32(load(i), vBias), _mm_sub_epi32(load(i + 4U), vBias));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(narrowed + i), _mm_xor_si128(packed, vUnbias));
+            }
+        }
+        else if (sizeof(T) == sizeof(uint8_t))
+        {
+            for (; i + 16U <= count; i += 16U)
+            {
+                const __m128i lo = _mm_packs_epi32(load(i), load(i + 4U));
+                const __m128i hi = _mm_packs_epi32(load(i + 8U), load(i + 12U));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(narrowed + i), _mm_packus_epi16(lo, hi));
+            }
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            narrowed[i] = static_cast<T>(indices[i]);
+        }
+    }
+
+    template<typename T>
+    void NarrowIndices(const uint32_t* indices, void* chunk, size_t byteOffset, size_t byteLength)
+    {
+        NarrowIndices(indices + byteOffset / sizeof(T), byteLength / sizeof(T), static_cast<T*>(chunk));
+    }
+
+    // Accessors are only interchangeable if their descriptions match as well as their data
+    std::vector<uint8_t> GetAccessorDescBytes(size_t count, const AccessorDesc& desc)
+    {
+        std::vector<uint8_t> descBytes;
+
+        auto append = [&descBytes](const void* value, size_t size)
+        {
+            auto begin = static_cast<const uint8_t*>(value);
+            descBytes.insert(descBytes.end(), begin, begin + size);
+        };
+
+        const uint64_t fields[] = { count, desc.accessorType, desc.componentType, desc.normalized, desc.minValues.size(), desc.maxValues.size() };
+
+        append(fields, sizeof(fields));
+        append(desc.minValues.data(), desc.minValues.size() * sizeof(float));
+        append(desc.maxValues.data(), desc.maxValues.size() * sizeof(float));
+
+        return descBytes;
+    }
+
+    std::array<uint64_t, 2> Hash128(const void* data, size_t byteLength, const std::vector<uint8_t>& descBytes)
+    {
+        const auto descHash = Hash128(descBytes.data(), descBytes.size(), 0U);
+
+        return Hash128(data, byteLength, descHash[0] ^ descHash[1]);
+    }
+
+    // The retained content of a deduplicated element is its accessor description (if any) followed by its payload
+    std::vector<uint8_t> GetContentBytes(const void* data, size_t byteLength, std::vector<uint8_t> descBytes = {})
+    {
+        auto begin = static_cast<const uint8_t*>(data);
+        descBytes.insert(descBytes.end(), begin, begin + byteLength);
+
+        return descBytes;
+    }
+
+    bool IsContentEqual(const std::vector<uint8_t>& content, const void* data, size_t byteLength, const std::vector<uint8_t>& descBytes)
+    {
+        return content.size() == descBytes.size() + byteLength
+            && std::equal(descBytes.begin(), descBytes.end(), content.begin())
+            && (byteLength == 0U || std::memcmp(content.data() + descBytes.size(), data, byteLength) == 0);
+    }
+
+    // Returns the number of bytes between the stream's read position and its end, or SIZE_MAX if the stream isn't seekable
+    size_t GetRemainingByteLength(std::istream& stream)
+    {
+        const auto position = stream.tellg();
+
+        if (position == std::istream::pos_type(-1))
+        {
+            return std::numeric_limits<size_t>::max();
+        }
+
+        const auto end = stream.seekg(0, std::ios::end).tellg();
+        stream.seekg(position);
+
+        if (end == std::istream::pos_type(-1) || stream.fail())
+        {
+            stream.clear();
+            stream.seekg(position);
+
+            return std::numeric_limits<size_t>::max();
+        }
+
+        return static_cast<size_t>(end - position);
+    }
+
     size_t GetPadding(size_t offset, size_t alignment)
     {
         const auto padAlign = offset % alignment;
@@ -38,7 +276,10 @@ BufferBuilder::BufferBuilder(std::unique_ptr<ResourceWriter>&& resourceWriter,
     FnGenId fnGenAccessorId) : m_resourceWriter(std::move(resourceWriter)),
     m_fnGenBufferId(std::move(fnGenBufferId)),
     m_fnGenBufferViewId(std::move(fnGenBufferViewId)),
-    m_fnGenAccessorId(std::move(fnGenAccessorId))
+    m_fnGenAccessorId(std::move(fnGenAccessorId)),
+    m_deduplication(false),
+    m_deduplicatedByteLength(0U),
+    m_isCurrentBufferViewUnused(false)
 {
 }
 
@@ -64,53 +305,120 @@ const Buffer& BufferBuilder::AddBuffer(const char* bufferId)
 
 const BufferView& BufferBuilder::AddBufferView(BufferViewTarget target)
 {
-    Buffer& buffer = m_buffers.Back();
-    BufferView bufferView;
+    // The BufferView's length is updated whenever an Accessor is added (and data is written to the underlying buffer)
+    return AppendBufferView(0U, 0U, target);
+}
 
-    if (m_fnGenBufferViewId)
+const BufferView& BufferBuilder::AddBufferView(const void* data, size_t byteLength, size_t byteStride, BufferViewTarget target)
+{
+    ContentKey key = {};
+
+    if (m_deduplication)
     {
-        bufferView.id = m_fnGenBufferViewId(*this);
+        key = { Hash128(data, byteLength, 0U), byteLength, byteStride, target };
+
+        if (auto bufferViewId = FindContent(m_bufferViewsByContent, key, data, byteLength))
+        {
+            m_currentBufferViewId = *bufferViewId;
+            m_deduplicatedByteLength += byteLength;
+
+            return m_bufferViews.Get(*bufferViewId);
+        }
     }
 
-    bufferView.bufferId = buffer.id;
-    bufferView.byteOffset = buffer.byteLength;
-    bufferView.byteLength = 0U;// The BufferView's length is updated whenever an Accessor is added (and data is written to the underlying buffer)
-    bufferView.target = target;
+    const BufferView& bufferViewRef = AppendBufferView(byteLength, byteStride, target);
+
+    if (m_resourceWriter)
+    {
+        m_resourceWriter->Write(bufferViewRef, data);
+    }
 
-    return m_bufferViews.Append(std::move(bufferView), AppendIdPolicy::GenerateOnEmpty);
+    if (m_deduplication)
+    {
+        m_bufferViewsByContent.emplace(key, ContentEntry{ GetContentBytes(data, byteLength), bufferViewRef.id });
+    }
+
+    return bufferViewRef;
 }
 
-const BufferView& BufferBuilder::AddBufferView(const void* data, size_t byteLength, size_t byteStride, BufferViewTarget target)
+const BufferView& BufferBuilder::AddBufferView(std::istream& stream, size_t byteLength, size_t byteStride, BufferViewTarget target)
 {
-    Buffer& buffer = m_buffers.Back();
-    BufferView bufferView;
-
-    if (m_fnGenBufferViewId)
+    // Seekable streams are checked up front so that a truncated stream is rejected before anything is written
+    if (GetRemainingByteLength(stream) < byteLength)
     {
-        bufferView.id = m_fnGenBufferViewId(*this);
+        throw GLTFException("The stream has fewer bytes remaining than the buffer view's byte length");
     }
 
-    bufferView.bufferId = buffer.id;
-    bufferView.byteOffset = buffer.byteLength;
-    bufferView.byteLength = byteLength;
-    bufferView.byteStride = byteStride;
-    bufferView.target = target;
+    Buffer& buffer = m_buffers.Back();
+    const size_t bufferByteLength = buffer.byteLength;
 
-    buffer.byteLength = bufferView.byteOffset + bufferView.byteLength;
+    const BufferView& bufferView = AppendBufferView(byteLength, byteStride, target);
 
     if (m_resourceWriter)
     {
-        m_resourceWriter->Write(bufferView, data);
+        try
+        {
+            m_resourceWriter->Write(bufferView, stream);
+        }
+        catch (...)
+        {
+            // Otherwise the buffer would be left with a buffer view that has no data written for it
+            const std::string bufferViewId = bufferView.id;
+
+            m_currentBufferViewId.clear();
+            m_bufferViews.Remove(bufferViewId);
+            buffer.byteLength = bufferByteLength;
+
+            throw;
+        }
     }
 
-    return m_bufferViews.Append(std::move(bufferView), AppendIdPolicy::GenerateOnEmpty);
+    return bufferView;
 }
 
 const Accessor& BufferBuilder::AddAccessor(const void* data, size_t count, AccessorDesc desc)
+{
+    const size_t byteLength = count * Accessor::GetComponentTypeSize(desc.componentType) * Accessor::GetTypeCount(desc.accessorType);
+
+    return AddAccessor(data, byteLength, count, std::move(desc), [this, data](const BufferView& bufferView, const Accessor& accessor)
+    {
+        m_resourceWriter->Write(bufferView, data, accessor);
+    });
+}
+
+const Accessor& BufferBuilder::AddAccessor(const void* content, size_t contentByteLength, size_t count, AccessorDesc desc, const FnWrite& fnWrite)
 {
     Buffer& buffer = m_buffers.Back();
     BufferView& bufferView = m_bufferViews.Back();
 
+    // Only accessors that would occupy an entire buffer view can be shared
+    const bool deduplicate = m_deduplication && bufferView.byteLength == 0U;
+
+    ContentKey key = {};
+    std::vector<uint8_t> descBytes;
+
+    if (deduplicate)
+    {
+        descBytes = GetAccessorDescBytes(count, desc);
+        key = { Hash128(content, contentByteLength, descBytes), contentByteLength, bufferView.byteStride, bufferView.target };
+
+        if (auto accessorId = FindContent(m_accessorsByContent, key, content, contentByteLength, descBytes))
+        {
+            const Accessor& accessor = m_accessors.Get(*accessorId);
+
+            // The empty buffer view is left for the next accessor, the current buffer view is the one the existing accessor uses
+            m_isCurrentBufferViewUnused = true;
+            m_currentBufferViewId = accessor.bufferViewId;
+            m_currentAccessorId = accessor.id;
+            m_deduplicatedByteLength += accessor.GetByteLength();
+
+            return accessor;
+        }
+    }
+
+    m_isCurrentBufferViewUnused = false;
+    m_currentBufferViewId = bufferView.id;
+
     // If the bufferView has not yet been written to then ensure it is correctly aligned for this accessor's component type
     if (bufferView.byteLength == 0U)
     {
@@ -120,17 +428,79 @@ const Accessor& BufferBuilder::AddAccessor(const void* data, size_t count, Acces
     desc.byteOffset = bufferView.byteLength;
     const Accessor& accessor = AddAccessor(count, std::move(desc));
 
+    if (deduplicate)
+    {
+        m_accessorsByContent.emplace(key, ContentEntry{ GetContentBytes(content, contentByteLength, std::move(descBytes)), accessor.id });
+    }
+
     bufferView.byteLength += accessor.GetByteLength();
     buffer.byteLength = bufferView.byteOffset + bufferView.byteLength;
 
     if (m_resourceWriter)
     {
-        m_resourceWriter->Write(bufferView, data, accessor);
+        fnWrite(bufferView, accessor);
     }
 
     return accessor;
 }
 
+const Accessor& BufferBuilder::AddIndicesAccessor(const uint32_t* indices, size_t count)
+{
+    return AddIndicesAccessor(indices, count, GetIndicesComponentType(indices, count));
+}
+
+const Accessor& BufferBuilder::AddIndicesAccessor(const uint32_t* indices, size_t count, ComponentType componentType)
+{
+    // The component type depends on every index so the narrowing can't happen in the same pass as the search for the
+    // maximum index. Instead the indices are narrowed a chunk at a time as they are written, never into a temporary copy.
+    // When deduplicating, the source indices are hashed along with the (narrowed) component type in the description.
+    const size_t contentByteLength = count * sizeof(uint32_t);
+
+    switch (componentType)
+    {
+    case COMPONENT_UNSIGNED_BYTE:
+        return AddAccessor(indices, contentByteLength, count, { TYPE_SCALAR, COMPONENT_UNSIGNED_BYTE }, [this, indices](const BufferView& bufferView, const Accessor& accessor)
+        {
+            m_resourceWriter->Write(bufferView, accessor, [indices](void* chunk, size_t byteOffset, size_t byteLength)
+            {
+                NarrowIndices<uint8_t>(indices, chunk, byteOffset, byteLength);
+            });
+        });
+
+    case COMPONENT_UNSIGNED_SHORT:
+        return AddAccessor(indices, contentByteLength, count, { TYPE_SCALAR, COMPONENT_UNSIGNED_SHORT }, [this, indices](const BufferView& bufferView, const Accessor& accessor)
+        {
+            m_resourceWriter->Write(bufferView, accessor, [indices](void* chunk, size_t byteOffset, size_t byteLength)
+            {
+                NarrowIndices<uint16_t>(indices, chunk, byteOffset, byteLength);
+            });
+        });
+
+    case COMPONENT_UNSIGNED_INT:
+        return AddAccessor(indices, count, { TYPE_SCALAR, COMPONENT_UNSIGNED_INT });
+
+    default:
+        throw GLTFException("Indices must have an unsigned byte, short or int component type");
+    }
+}
+
+ComponentType BufferBuilder::GetIndicesComponentType(const uint32_t* indices, size_t count)
+{
+    const uint32_t maxIndex = GetMaxIndex(indices, count);
+
+    if (maxIndex < std::numeric_limits<uint8_t>::max())
+    {
+        return COMPONENT_UNSIGNED_BYTE;
+    }
+
+    if (maxIndex < std::numeric_limits<uint16_t>::max())
+    {
+        return COMPONENT_UNSIGNED_SHORT;
+    }
+
+    return COMPONENT_UNSIGNED_INT;
+}
+
 void BufferBuilder::AddAccessors(const void* data, size_t count, size_t byteStride, const AccessorDesc* pDescs, size_t descCount, std::string* pOutIds)
 {
     Buffer& buffer = m_buffers.Back();
@@ -190,6 +560,9 @@ void BufferBuilder::AddAccessors(const void* data, size_t count, size_t byteStri
         alignment = std::max(alignment, GetAlignment(pDescs[i]));
     }
 
+    m_isCurrentBufferViewUnused = false;
+    m_currentBufferViewId = bufferView.id;
+
     bufferView.byteStride = byteStride;
     bufferView.byteLength = extent;
     bufferView.byteOffset += ::GetPadding(bufferView.byteOffset, alignment);
@@ -221,12 +594,20 @@ void BufferBuilder::Output(Document& gltfDocument)
 
     m_buffers.Clear();
 
+    if (m_isCurrentBufferViewUnused)
+    {
+        // Every accessor added to the buffer view was deduplicated so nothing refers to it
+        m_bufferViews.Remove(m_bufferViews.Back().id);
+        m_isCurrentBufferViewUnused = false;
+    }
+
     for (auto& bufferView : m_bufferViews.Elements())
     {
         gltfDocument.bufferViews.Append(std::move(bufferView), AppendIdPolicy::ThrowOnEmpty);
     }
 
     m_bufferViews.Clear();
+    m_currentBufferViewId.clear();
 
     for (auto& accessor : m_accessors.Elements())
     {
@@ -234,6 +615,10 @@ void BufferBuilder::Output(Document& gltfDocument)
     }
 
     m_accessors.Clear();
+    m_currentAccessorId.clear();
+
+    m_bufferViewsByContent.clear();
+    m_accessorsByContent.clear();
 }
 
 const Buffer& BufferBuilder::GetCurrentBuffer() const
@@ -243,12 +628,12 @@ const Buffer& BufferBuilder::GetCurrentBuffer() const
 
 const BufferView& BufferBuilder::GetCurrentBufferView() const
 {
-    return m_bufferViews.Back();
+    return m_currentBufferViewId.empty() ? m_bufferViews.Back() : m_bufferViews.Get(m_currentBufferViewId);
 }
 
 const Accessor& BufferBuilder::GetCurrentAccessor() const
 {
-    return m_accessors.Back();
+    return m_currentAccessorId.empty() ? m_accessors.Back() : m_accessors.Get(m_currentAccessorId);
 }
 
 size_t BufferBuilder::GetBufferCount() const
@@ -276,6 +661,86 @@ const ResourceWriter& BufferBuilder::GetResourceWriter() const
     return *m_resourceWriter;
 }
 
+void BufferBuilder::SetDeduplication(bool enabled)
+{
+    m_deduplication = enabled;
+}
+
+bool BufferBuilder::GetDeduplication() const
+{
+    return m_deduplication;
+}
+
+size_t BufferBuilder::GetDeduplicatedByteLength() const
+{
+    return m_deduplicatedByteLength;
+}
+
+bool BufferBuilder::ContentKey::operator==(const ContentKey& other) const
+{
+    return hash == other.hash
+        && byteLength == other.byteLength
+        && byteStride == other.byteStride
+        && target == other.target;
+}
+
+size_t BufferBuilder::ContentKeyHash::operator()(const ContentKey& key) const
+{
+    return static_cast<size_t>(key.hash[0]);
+}
+
+const std::string* BufferBuilder::FindContent(const ContentMap& contentMap, const ContentKey& key, const void* data, size_t byteLength, const std::vector<uint8_t>& descBytes)
+{
+    // Different payloads can share a hash so only a byte for byte match is treated as a duplicate
+    const auto range = contentMap.equal_range(key);
+
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (IsContentEqual(it->second.content, data, byteLength, descBytes))
+        {
+            return &it->second.id;
+        }
+    }
+
+    return nullptr;
+}
+
+const BufferView& BufferBuilder::AppendBufferView(size_t byteLength, size_t byteStride, BufferViewTarget target)
+{
+    Buffer& buffer = m_buffers.Back();
+
+    BufferView bufferView;
+
+    if (m_isCurrentBufferViewUnused)
+    {
+        // The empty buffer view left by a deduplicated accessor is replaced, keeping its id, rather than output unused
+        bufferView.id = m_bufferViews.Back().id;
+    }
+    else if (m_fnGenBufferViewId)
+    {
+        bufferView.id = m_fnGenBufferViewId(*this);
+    }
+
+    bufferView.bufferId = buffer.id;
+    bufferView.byteOffset = buffer.byteLength;
+    bufferView.byteLength = byteLength;
+    bufferView.byteStride = byteStride;
+    bufferView.target = target;
+
+    buffer.byteLength = bufferView.byteOffset + bufferView.byteLength;
+
+    if (m_isCurrentBufferViewUnused)
+    {
+        m_bufferViews.Remove(bufferView.id);
+        m_isCurrentBufferViewUnused = false;
+    }
+
+    const BufferView& bufferViewRef = m_bufferViews.Append(std::move(bufferView), AppendIdPolicy::GenerateOnEmpty);
+    m_currentBufferViewId = bufferViewRef.id;
+
+    return bufferViewRef;
+}
+
 const Accessor& BufferBuilder::AddAccessor(size_t count, AccessorDesc desc)
 {
     Buffer& buffer = m_buffers.Back();
@@ -339,5 +804,8 @@ const Accessor& BufferBuilder::AddAccessor(size_t count, AccessorDesc desc)
     accessor.min = desc.minValues;
     accessor.max = desc.maxValues;
 
-    return m_accessors.Append(std::move(accessor), AppendIdPolicy::GenerateOnEmpty);
+    const Accessor& accessorRef = m_accessors.Append(std::move(accessor), AppendIdPolicy::GenerateOnEmpty);
+    m_currentAccessorId = accessorRef.id;
+
+    return accessorRef;
 }
@@ -0,0 +1,198 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/CompiledAnimation.h>
+
+#include <GLTFSDK/Document.h>
+#include <GLTFSDK/GLTFResourceReader.h>
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <utility>
+
+using namespace Microsoft::glTF;
+
+namespace
+{
+    size_t GetValuesPerKeyframe(InterpolationType interpolation)
+    {
+        return interpolation == INTERPOLATION_CUBICSPLINE ? 3U : 1U;
+    }
+}
+
+CompiledAnimation::CompiledAnimation(const Document& doc, const GLTFResourceReader& reader, const Animation& animation)
+    : m_outputSize(0U),
+      m_startTime(std::numeric_limits<float>::infinity()),
+      m_endTime(-std::numeric_limits<float>::infinity())
+{
+    std::map<std::vector<float>, size_t> timeTracks;
+
+    // Channels that target the same path with the same sampler share its decoded values
+    std::map<std::pair<std::string, TargetPath>, size_t> samplerChannels;
+
+    m_channels.reserve(animation.channels.Size());
+
+    for (const auto& animationChannel : animation.channels.Elements())
+    {
+        Channel channel;
+        channel.nodeId = animationChannel.target.nodeId;
+        channel.path = animationChannel.target.path;
+        channel.outputOffset = m_outputSize;
+
+        const auto it = samplerChannels.find({ animationChannel.samplerId, channel.path });
+
+        if (it != samplerChannels.end())
+        {
+            const auto& decoded = m_channels[it->second];
+
+            channel.interpolation = decoded.interpolation;
+            channel.componentCount = decoded.componentCount;
+            channel.timeTrack = decoded.timeTrack;
+            channel.valueOffset = decoded.valueOffset;
+            channel.valueCount = decoded.valueCount;
+        }
+        else
+        {
+            const auto curve = AnimationEvaluator::ReadCurve(doc, reader, animation, animationChannel);
+
+            channel.interpolation = curve.interpolation;
+            channel.componentCount = curve.componentCount;
+
+            const auto track = timeTracks.emplace(curve.times, m_timeTrackOffsets.size());
+
+            if (track.second)
+            {
+                m_timeTrackOffsets.push_back(m_times.size());
+                m_timeTrackCounts.push_back(curve.times.size());
+                m_times.insert(m_times.end(), curve.times.begin(), curve.times.end());
+            }
+
+            channel.timeTrack = track.first->second;
+            channel.valueOffset = m_values.size();
+            channel.valueCount = curve.values.size() / curve.componentCount;
+
+            // Transpose the interleaved values so that each component is contiguous
+            m_values.resize(m_values.size() + curve.values.size());
+
+            float* values = m_values.data() + channel.valueOffset;
+
+            for (size_t i = 0U; i < channel.valueCount; ++i)
+            {
+                for (size_t c = 0U; c < channel.componentCount; ++c)
+                {
+                    values[c * channel.valueCount + i] = curve.values[i * channel.componentCount + c];
+                }
+            }
+
+            samplerChannels.emplace(std::make_pair(animationChannel.samplerId, channel.path), m_channels.size());
+        }
+
+        const float* times = GetTimes(channel.timeTrack);
+
+        m_startTime = std::min(m_startTime, times[0]);
+        m_endTime = std::max(m_endTime, times[GetKeyframeCount(channel.timeTrack) - 1U]);
+
+        m_outputSize += channel.componentCount;
+        m_channels.push_back(std::move(channel));
+    }
+
+    if (m_channels.empty())
+    {
+        m_startTime = m_endTime = 0.0f;
+    }
+}
+
+size_t CompiledAnimation::GetChannelCount() const
+{
+    return m_channels.size();
+}
+
+const CompiledAnimation::Channel& CompiledAnimation::GetChannel(size_t channelIndex) const
+{
+    return m_channels.at(channelIndex);
+}
+
+size_t CompiledAnimation::GetTimeTrackCount() const
+{
+    return m_timeTrackOffsets.size();
+}
+
+size_t CompiledAnimation::GetKeyframeCount(size_t timeTrack) const
+{
+    return m_timeTrackCounts.at(timeTrack);
+}
+
+const float* CompiledAnimation::GetTimes(size_t timeTrack) const
+{
+    return m_times.data() + m_timeTrackOffsets.at(timeTrack);
+}
+
+const std::vector<float>& CompiledAnimation::GetValues() const
+{
+    return m_values;
+}
+
+size_t CompiledAnimation::GetOutputSize() const
+{
+    return m_outputSize;
+}
+
+float CompiledAnimation::GetStartTime() const
+{
+    return m_startTime;
+}
+
+float CompiledAnimation::GetEndTime() const
+{
+    return m_endTime;
+}
+
+void CompiledAnimation::Sample(size_t channelIndex, float time, size_t& cursor, float* output, RotationInterpolation rotationInterpolation) const
+{
+    const auto& channel = m_channels[channelIndex];
+
+    const size_t n = channel.componentCount;
+    const size_t stride = channel.valueCount;
+    const size_t valuesPerKeyframe = GetValuesPerKeyframe(channel.interpolation);
+    const size_t keyframeCount = m_timeTrackCounts[channel.timeTrack];
+
+    const float* times = m_times.data() + m_timeTrackOffsets[channel.timeTrack];
+    const float* values = m_values.data() + channel.valueOffset;
+
+    cursor = AnimationEvaluator::FindKeyframe(times, keyframeCount, time, cursor);
+
+    // Times outside the keyframes are clamped
+    if (keyframeCount == 1U || time <= times[0] || time >= times[keyframeCount - 1U])
+    {
+        const size_t keyframe = time >= times[keyframeCount - 1U] ? keyframeCount - 1U : 0U;
+        const size_t index = keyframe * valuesPerKeyframe + valuesPerKeyframe / 2U;
+
+        for (size_t c = 0U; c < n; ++c)
+        {
+            output[c] = values[c * stride + index];
+        }
+
+        return;
+    }
+
+    const float t0 = times[cursor];
+    const float dt = times[cursor + 1U] - t0;
+    const float s = dt > 0.0f ? std::min(1.0f, std::max(0.0f, (time - t0) / dt)) : 0.0f;
+
+    // Each component's values are contiguous, so consecutive values are one float apart and components are stride floats apart
+    AnimationEvaluator::Interpolate(channel.path, channel.interpolation, n, values + cursor * valuesPerKeyframe, 1U, stride, s, dt, output, rotationInterpolation);
+}
+
+void CompiledAnimation::Evaluate(float time, std::vector<size_t>& cursors, float* output, RotationInterpolation rotationInterpolation) const
+{
+    if (cursors.size() != m_channels.size())
+    {
+        cursors.resize(m_channels.size(), 0U);
+    }
+
+    for (size_t i = 0U; i < m_channels.size(); ++i)
+    {
+        Sample(i, time, cursors[i], output + m_channels[i].outputOffset, rotationInterpolation);
+    }
+}
@@ -0,0 +1,434 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/ConversionUtils.h>
+
+#include <GLTFSDK/AnimationUtils.h>
+#include <GLTFSDK/Exceptions.h>
+#include <GLTFSDK/SIMD.h>
+
+#include <algorithm>
+#include <cstring>
+
+using namespace Microsoft::glTF;
+
+namespace
+{
+    float ClampUnorm(float value)
+    {
+        // Written so that NaN values are clamped to zero, matching the SIMD implementations
+        return (value > 0.0f) ? ((value < 1.0f) ? value : 1.0f) : 0.0f;
+    }
+
+    // Matches Math::FloatToByte for values within [0, 1]
+    uint8_t FloatToUnorm8(float value)
+    {
+        return static_cast<uint8_t>(ClampUnorm(value) * 255.0f + 0.5f);
+    }
+
+    uint16_t FloatToUnorm16(float value)
+    {
+        return static_cast<uint16_t>(ClampUnorm(value) * 65535.0f + 0.5f);
+    }
+
+    // Exactly equivalent to round((value / 65535.0f) * 255.0f) for every 16-bit value
+    uint8_t Unorm16ToUnorm8(uint32_t value)
+    {
+        return static_cast<uint8_t>((value * 255U + 32895U) >> 16);
+    }
+
+#ifdef GLTFSDK_SSE2
+    // Division (rather than multiplication by a reciprocal) gives results identical to AnimationUtils::ComponentToFloat
+    class FloatConverter
+    {
+    public:
+        FloatConverter(bool normalized, float divisor) :
+            m_normalized(normalized),
+            m_divisor(_mm_set1_ps(divisor)),
+            m_minimum(_mm_set1_ps(-1.0f))
+        {
+        }
+
+        void Store(float* output, __m128i value) const
+        {
+            __m128 result = _mm_cvtepi32_ps(value);
+
+            if (m_normalized)
+            {
+                result = _mm_max_ps(_mm_div_ps(result, m_divisor), m_minimum);
+            }
+
+            _mm_storeu_ps(output, result);
+        }
+
+        void StoreSigned16(float* output, __m128i value) const
+        {
+            Store(output, _mm_srai_epi32(_mm_unpacklo_epi16(value, value), 16));
+            Store(output + 4, _mm_srai_epi32(_mm_unpackhi_epi16(value, value), 16));
+        }
+
+        void StoreUnsigned16(float* output, __m128i value) const
+        {
+            const __m128i zero = _mm_setzero_si128();
+
+            Store(output, _mm_unpacklo_epi16(value, zero));
+            Store(output + 4, _mm_unpackhi_epi16(value, zero));
+        }
+
+    private:
+        const bool m_normalized;
+        const __m128 m_divisor;
+        const __m128 m_minimum;
+    };
+
+    // Each ToFloatSIMD overload converts as many components as possible and returns the number converted
+    size_t ToFloatSIMD(const int8_t* input, float* output, size_t count, bool normalized)
+    {
+        const FloatConverter converter(normalized, 127.0f);
+
+        size_t i = 0U;
+
+        for (; i + 16U <= count; i += 16U)
+        {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+
+            // Interleaving a byte with itself and then shifting right arithmetically sign extends it to 16 bits
+            converter.StoreSigned16(output + i, _mm_srai_epi16(_mm_unpacklo_epi8(v, v), 8));
+            converter.StoreSigned16(output + i + 8U, _mm_srai_epi16(_mm_unpackhi_epi8(v, v), 8));
+        }
+
+        return i;
+    }
+
+    size_t ToFloatSIMD(const uint8_t* input, float* output, size_t count, bool normalized)
+    {
+        const FloatConverter converter(normalized, 255.0f);
+        const __m128i zero = _mm_setzero_si128();
+
+        size_t i = 0U;
+
+        for (; i + 16U <= count; i += 16U)
+        {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+
+            converter.StoreUnsigned16(output + i, _mm_unpacklo_epi8(v, zero));
+            converter.StoreUnsigned16(output + i + 8U, _mm_unpackhi_epi8(v, zero));
+        }
+
+        return i;
+    }
+
+    size_t ToFloatSIMD(const int16_t* input, float* output, size_t count, bool normalized)
+    {
+        const FloatConverter converter(normalized, 32767.0f);
+
+        size_t i = 0U;
+
+        for (; i + 8U <= count; i += 8U)
+        {
+            converter.StoreSigned16(output + i, _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i)));
+        }
+
+        return i;
+    }
+
+    size_t ToFloatSIMD(const uint16_t* input, float* output, size_t count, bool normalized)
+    {
+        const FloatConverter converter(normalized, 65535.0f);
+
+        size_t i = 0U;
+
+        for (; i + 8U <= count; i += 8U)
+        {
+            converter.StoreUnsigned16(output + i, _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i)));
+        }
+
+        return i;
+    }
+
+    size_t ToFloatSIMD(const uint32_t* input, float* output, size_t count)
+    {
+        // SSE2 can only convert signed 32-bit integers so each value is split into two 16-bit halves. Both halves convert
+        // exactly and the sum is rounded once, giving the same result as a scalar conversion.
+        const __m128i mask = _mm_set1_epi32(0xFFFF);
+        const __m128 scale = _mm_set1_ps(65536.0f);
+
+        size_t i = 0U;
+
+        for (; i + 4U <= count; i += 4U)
+        {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+
+            const __m128 hi = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(v, 16)), scale);
+            const __m128 lo = _mm_cvtepi32_ps(_mm_and_si128(v, mask));
+
+            _mm_storeu_ps(output + i, _mm_add_ps(hi, lo));
+        }
+
+        return i;
+    }
+
+    __m128 LoadClampedUnorm(const float* input)
+    {
+        // MAXPS returns its second operand when either is NaN, so NaN values are clamped to zero
+        return _mm_min_ps(_mm_max_ps(_mm_loadu_ps(input), _mm_setzero_ps()), _mm_set1_ps(1.0f));
+    }
+
+    __m128i ToUnormInt32(const float* input, __m128 scale)
+    {
+        return _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(LoadClampedUnorm(input), scale), _mm_set1_ps(0.5f)));
+    }
+#endif
+
+    template<typename T>
+    void ToFloat(const T* input, float* output, size_t count, bool normalized)
+    {
+        size_t i = 0U;
+
+#ifdef GLTFSDK_SSE2
+        i = ToFloatSIMD(input, output, count, normalized);
+#endif
+
+        if (normalized)
+        {
+            for (; i < count; ++i)
+            {
+                output[i] = AnimationUtils::ComponentToFloat(input[i]);
+            }
+        }
+        else
+        {
+            for (; i < count; ++i)
+            {
+                output[i] = static_cast<float>(input[i]);
+            }
+        }
+    }
+
+    // Unsigned int components can't be normalized
+    void ToFloat(const uint32_t* input, float* output, size_t count)
+    {
+        size_t i = 0U;
+
+#ifdef GLTFSDK_SSE2
+        i = ToFloatSIMD(input, output, count);
+#endif
+
+        for (; i < count; ++i)
+        {
+            output[i] = static_cast<float>(input[i]);
+        }
+    }
+
+    void ToUnorm8(const uint16_t* input, uint8_t* output, size_t count)
+    {
+        size_t i = 0U;
+
+#ifdef GLTFSDK_SSE2
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i bias = _mm_set1_epi32(32895);
+
+        // (x * 255 + 32895) >> 16, where x * 255 is computed as (x << 8) - x
+        const auto convert = [bias](__m128i x)
+        {
+            return _mm_srli_epi32(_mm_add_epi32(_mm_sub_epi32(_mm_slli_epi32(x, 8), x), bias), 16);
+        };
+
+        for (; i + 8U <= count; i += 8U)
+        {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+            const __m128i v16 = _mm_packs_epi32(convert(_mm_unpacklo_epi16(v, zero)), convert(_mm_unpackhi_epi16(v, zero)));
+
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(output + i), _mm_packus_epi16(v16, v16));
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            output[i] = Unorm16ToUnorm8(input[i]);
+        }
+    }
+
+    void ToUnorm8(const float* input, uint8_t* output, size_t count)
+    {
+        size_t i = 0U;
+
+#ifdef GLTFSDK_SSE2
+        const __m128 scale = _mm_set1_ps(255.0f);
+
+        for (; i + 16U <= count; i += 16U)
+        {
+            const __m128i lo = _mm_packs_epi32(ToUnormInt32(input + i, scale), ToUnormInt32(input + i + 4U, scale));
+            const __m128i hi = _mm_packs_epi32(ToUnormInt32(input + i + 8U, scale), ToUnormInt32(input + i + 12U, scale));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_packus_epi16(lo, hi));
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            output[i] = FloatToUnorm8(input[i]);
+        }
+    }
+
+    void ToUnorm16(const uint8_t* input, uint16_t* output, size_t count)
+    {
+        size_t i = 0U;
+
+#ifdef GLTFSDK_SSE2
+        for (; i + 16U <= count; i += 16U)
+        {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+
+            // Interleaving a byte with itself gives x * 257, the exact 8-bit to 16-bit unorm conversion
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_unpacklo_epi8(v, v));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i + 8U), _mm_unpackhi_epi8(v, v));
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            output[i] = static_cast<uint16_t>(input[i] * 257U);
+        }
+    }
+
+    void ToUnorm16(const float* input, uint16_t* output, size_t count)
+    {
+        size_t i = 0U;
+
+#ifdef GLTFSDK_SSE2
+        const __m128 scale = _mm_set1_ps(65535.0f);
+
+        // SSE2 only has a signed saturating 32 to 16-bit pack so values are biased into the signed range and back
+        const __m128i bias32 = _mm_set1_epi32(32768);
+        const __m128i bias16 = _mm_set1_epi16(static_cast<int16_t>(0x8000));
+
+        for (; i + 8U <= count; i += 8U)
+        {
+            const __m128i lo = _mm_sub_epi32(ToUnormInt32(input + i, scale), bias32);
+            const __m128i hi = _mm_sub_epi32(ToUnormInt32(input + i + 4U, scale), bias32);
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_xor_si128(_mm_packs_epi32(lo, hi), bias16));
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            output[i] = FloatToUnorm16(input[i]);
+        }
+    }
+}
+
+void ConversionUtils::ToFloat(const void* components, ComponentType componentType, bool normalized, float* output, size_t count)
+{
+    switch (componentType)
+    {
+    case COMPONENT_FLOAT:
+        std::memcpy(output, components, count * sizeof(float));
+        break;
+
+    case COMPONENT_BYTE:
+        ::ToFloat(static_cast<const int8_t*>(components), output, count, normalized);
+        break;
+
+    case COMPONENT_UNSIGNED_BYTE:
+        ::ToFloat(static_cast<const uint8_t*>(components), output, count, normalized);
+        break;
+
+    case COMPONENT_SHORT:
+        ::ToFloat(static_cast<const int16_t*>(components), output, count, normalized);
+        break;
+
+    case COMPONENT_UNSIGNED_SHORT:
+        ::ToFloat(static_cast<const uint16_t*>(components), output, count, normalized);
+        break;
+
+    case COMPONENT_UNSIGNED_INT:
+        if (normalized)
+        {
+            throw GLTFException("Unsigned int components cannot be normalized");
+        }
+
+        ::ToFloat(static_cast<const uint32_t*>(components), output, count);
+        break;
+
+    default:
+        throw GLTFException("Invalid componentType for conversion to float");
+    }
+}
+
+void ConversionUtils::ToUnorm8(const void* components, ComponentType componentType, uint8_t* output, size_t count)
+{
+    switch (componentType)
+    {
+    case COMPONENT_UNSIGNED_BYTE:
+        std::memcpy(output, components, count);
+        break;
+
+    case COMPONENT_UNSIGNED_SHORT:
+        ::ToUnorm8(static_cast<const uint16_t*>(components), output, count);
+        break;
+
+    case COMPONENT_FLOAT:
+        ::ToUnorm8(static_cast<const float*>(components), output, count);
+        break;
+
+    default:
+        throw GLTFException("Invalid componentType for conversion to unsigned normalized values");
+    }
+}
+
+void ConversionUtils::ToUnorm16(const void* components, ComponentType componentType, uint16_t* output, size_t count)
+{
+    switch (componentType)
+    {
+    case COMPONENT_UNSIGNED_BYTE:
+        ::ToUnorm16(static_cast<const uint8_t*>(components), output, count);
+        break;
+
+    case COMPONENT_UNSIGNED_SHORT:
+        std::memcpy(output, components, count * sizeof(uint16_t));
+        break;
+
+    case COMPONENT_FLOAT:
+        ::ToUnorm16(static_cast<const float*>(components), output, count);
+        break;
+
+    default:
+        throw GLTFException("Invalid componentType for conversion to unsigned normalized values");
+    }
+}
+
+void ConversionUtils::ToRGBA8(const void* components, ComponentType componentType, size_t componentCount, uint32_t* output, size_t count)
+{
+    if (componentCount != 3U && componentCount != 4U)
+    {
+        throw GLTFException("RGBA8 conversion requires three or four components per element");
+    }
+
+    // Components are converted to bytes a chunk at a time and then packed with shifts (rather than by writing the bytes
+    // straight to the output) so that red is the least significant byte regardless of the platform's endianness
+    const size_t chunkCount = 256U;
+    const size_t elementSize = Accessor::GetComponentTypeSize(componentType) * componentCount;
+
+    uint8_t bytes[chunkCount * 4U];
+
+    for (size_t i = 0U; i < count; i += chunkCount)
+    {
+        const size_t n = std::min(chunkCount, count - i);
+
+        ToUnorm8(static_cast<const uint8_t*>(components) + i * elementSize, componentType, bytes, n * componentCount);
+
+        for (size_t j = 0U; j < n; ++j)
+        {
+            const uint8_t* rgba = bytes + j * componentCount;
+            const uint32_t alpha = (componentCount == 4U) ? rgba[3U] : 0xFFU;
+
+            output[i + j] =
+                alpha << 24U |
+                static_cast<uint32_t>(rgba[2U]) << 16U |
+                static_cast<uint32_t>(rgba[1U]) << 8U |
+                static_cast<uint32_t>(rgba[0U]);
+        }
+    }
+}
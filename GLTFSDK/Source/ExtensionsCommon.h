@@ -0,0 +1,28 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <GLTFSDK/ExtensionHandlers.h>
+#include <GLTFSDK/RapidJsonUtils.h>
+
+namespace Microsoft
+{
+    namespace glTF
+    {
+        class Document;
+
+        // Parsing and serialization of the extensions and extras common to every glTFProperty, shared by the
+        // KHR, MSFT and EXT extension handlers. Not part of the public API.
+        namespace Detail
+        {
+            void ParseExtensions(const rapidjson::Value& v, glTFProperty& node, const ExtensionDeserializer& extensionDeserializer);
+            void ParseExtras(const rapidjson::Value& v, glTFProperty& node);
+            void ParseProperty(const rapidjson::Value& v, glTFProperty& node, const ExtensionDeserializer& extensionDeserializer);
+
+            void SerializePropertyExtensions(const Document& gltfDocument, const glTFProperty& property, rapidjson::Value& propertyValue, rapidjson::Document::AllocatorType& a, const ExtensionSerializer& extensionSerializer);
+            void SerializePropertyExtras(const glTFProperty& property, rapidjson::Value& propertyValue, rapidjson::Document::AllocatorType& a);
+            void SerializeProperty(const Document& gltfDocument, const glTFProperty& property, rapidjson::Value& propertyValue, rapidjson::Document::AllocatorType& a, const ExtensionSerializer& extensionSerializer);
+        }
+    }
+}
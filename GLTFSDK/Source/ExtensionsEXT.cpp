@@ -0,0 +1,102 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/ExtensionsEXT.h>
+
+#include <GLTFSDK/Document.h>
+#include <GLTFSDK/RapidJsonUtils.h>
+
+#include "ExtensionsCommon.h"
+
+using namespace Microsoft::glTF;
+using namespace Microsoft::glTF::Detail;
+
+ExtensionSerializer EXT::GetEXTExtensionSerializer()
+{
+    using namespace Nodes;
+
+    ExtensionSerializer extensionSerializer;
+    extensionSerializer.AddHandler<MeshGpuInstancing, Node>(MESH_GPU_INSTANCING_NAME, SerializeMeshGpuInstancing);
+    return extensionSerializer;
+}
+
+ExtensionDeserializer EXT::GetEXTExtensionDeserializer()
+{
+    using namespace Nodes;
+
+    ExtensionDeserializer extensionDeserializer;
+    extensionDeserializer.AddHandler<MeshGpuInstancing, Node>(MESH_GPU_INSTANCING_NAME, DeserializeMeshGpuInstancing);
+    return extensionDeserializer;
+}
+
+// EXT::Nodes::MeshGpuInstancing
+
+std::unique_ptr<Extension> EXT::Nodes::MeshGpuInstancing::Clone() const
+{
+    return std::make_unique<MeshGpuInstancing>(*this);
+}
+
+bool EXT::Nodes::MeshGpuInstancing::IsEqual(const Extension& rhs) const
+{
+    const auto other = dynamic_cast<const MeshGpuInstancing*>(&rhs);
+
+    return other != nullptr
+        && glTFProperty::Equals(*this, *other)
+        && this->attributes == other->attributes;
+}
+
+std::string EXT::Nodes::SerializeMeshGpuInstancing(const MeshGpuInstancing& meshGpuInstancing, const Document& glTFdoc, const ExtensionSerializer& extensionSerializer)
+{
+    rapidjson::Document doc;
+    auto& a = doc.GetAllocator();
+    rapidjson::Value EXT_mesh_gpu_instancing(rapidjson::kObjectType);
+    {
+        rapidjson::Value attributes(rapidjson::kObjectType);
+
+        for (const auto& attribute : meshGpuInstancing.attributes)
+        {
+            attributes.AddMember(RapidJsonUtils::ToStringValue(attribute.first, a), rapidjson::Value(ToKnownSizeType(glTFdoc.accessors.GetIndex(attribute.second))), a);
+        }
+
+        EXT_mesh_gpu_instancing.AddMember("attributes", attributes, a);
+
+        SerializeProperty(glTFdoc, meshGpuInstancing, EXT_mesh_gpu_instancing, a, extensionSerializer);
+    }
+
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    EXT_mesh_gpu_instancing.Accept(writer);
+
+    return buffer.GetString();
+}
+
+std::unique_ptr<Extension> EXT::Nodes::DeserializeMeshGpuInstancing(const std::string& json, const ExtensionDeserializer& extensionDeserializer)
+{
+    auto extension = std::make_unique<MeshGpuInstancing>();
+
+    auto doc = RapidJsonUtils::CreateDocumentFromString(json);
+    const rapidjson::Value v = doc.GetObject();
+
+    rapidjson::Value::ConstMemberIterator it = v.FindMember("attributes");
+    if (it != v.MemberEnd())
+    {
+        if (!it->value.IsObject())
+        {
+            throw GLTFException("Member attributes of " + std::string(MESH_GPU_INSTANCING_NAME) + " is not an object.");
+        }
+
+        for (const auto& attribute : it->value.GetObject())
+        {
+            if (!attribute.value.IsUint())
+            {
+                throw GLTFException("Member attributes of " + std::string(MESH_GPU_INSTANCING_NAME) + " contains an invalid index.");
+            }
+
+            extension->attributes[attribute.name.GetString()] = std::to_string(attribute.value.GetUint());
+        }
+    }
+
+    ParseProperty(v, *extension, extensionDeserializer);
+
+    return extension;
+}
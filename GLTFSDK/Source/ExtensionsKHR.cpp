@@ -6,49 +6,13 @@
 #include <GLTFSDK/Document.h>
 #include <GLTFSDK/RapidJsonUtils.h>
 
+#include "ExtensionsCommon.h"
+
 using namespace Microsoft::glTF;
+using namespace Microsoft::glTF::Detail;
 
 namespace
 {
-    void ParseExtensions(const rapidjson::Value& v, glTFProperty& node, const ExtensionDeserializer& extensionDeserializer)
-    {
-        const auto& extensionsIt = v.FindMember("extensions");
-        if (extensionsIt != v.MemberEnd())
-        {
-            const rapidjson::Value& extensionsObject = extensionsIt->value;
-            for (const auto& entry : extensionsObject.GetObject())
-            {
-                ExtensionPair extensionPair = { entry.name.GetString(), Serialize(entry.value) };
-
-                if (extensionDeserializer.HasHandler(extensionPair.name, node) ||
-                    extensionDeserializer.HasHandler(extensionPair.name))
-                {
-                    node.SetExtension(extensionDeserializer.Deserialize(extensionPair, node));
-                }
-                else
-                {
-                    node.extensions.emplace(std::move(extensionPair.name), std::move(extensionPair.value));
-                }
-            }
-        }
-    }
-
-    void ParseExtras(const rapidjson::Value& v, glTFProperty& node)
-    {
-        rapidjson::Value::ConstMemberIterator it;
-        if (TryFindMember("extras", v, it))
-        {
-            const rapidjson::Value& a = it->value;
-            node.extras = Serialize(a);
-        }
-    }
-
-    void ParseProperty(const rapidjson::Value& v, glTFProperty& node, const ExtensionDeserializer& extensionDeserializer)
-    {
-        ParseExtensions(v, node, extensionDeserializer);
-        ParseExtras(v, node);
-    }
-
     void ParseTextureInfo(const rapidjson::Value& v, TextureInfo& textureInfo, const ExtensionDeserializer& extensionDeserializer)
     {
         auto textureIndexIt = FindRequiredMember("index", v);
@@ -57,63 +21,6 @@ namespace
         ParseProperty(v, textureInfo, extensionDeserializer);
     }
 
-    void SerializePropertyExtensions(const Document& gltfDocument, const glTFProperty& property, rapidjson::Value& propertyValue, rapidjson::Document::AllocatorType& a, const ExtensionSerializer& extensionSerializer)
-    {
-        auto registeredExtensions = property.GetExtensions();
-
-        if (!property.extensions.empty() || !registeredExtensions.empty())
-        {
-            rapidjson::Value& extensions = RapidJsonUtils::FindOrAddMember(propertyValue, "extensions", a);
-
-            // Add registered extensions
-            for (const auto& extension : registeredExtensions)
-            {
-                const auto extensionPair = extensionSerializer.Serialize(extension, property, gltfDocument);
-
-                if (property.HasUnregisteredExtension(extensionPair.name))
-                {
-                    throw GLTFException("Registered extension '" + extensionPair.name + "' is also present as an unregistered extension.");
-                }
-
-                if (gltfDocument.extensionsUsed.find(extensionPair.name) == gltfDocument.extensionsUsed.end())
-                {
-                    throw GLTFException("Registered extension '" + extensionPair.name + "' is not present in extensionsUsed");
-                }
-
-                const auto d = RapidJsonUtils::CreateDocumentFromString(extensionPair.value);//TODO: validate the returned document against the extension schema!
-                rapidjson::Value v(rapidjson::kObjectType);
-                v.CopyFrom(d, a);
-                extensions.AddMember(RapidJsonUtils::ToStringValue(extensionPair.name, a), v, a);
-            }
-
-            // Add unregistered extensions
-            for (const auto& extension : property.extensions)
-            {
-                const auto d = RapidJsonUtils::CreateDocumentFromString(extension.second);
-                rapidjson::Value v(rapidjson::kObjectType);
-                v.CopyFrom(d, a);
-                extensions.AddMember(RapidJsonUtils::ToStringValue(extension.first, a), v, a);
-            }
-        }
-    }
-
-    void SerializePropertyExtras(const glTFProperty& property, rapidjson::Value& propertyValue, rapidjson::Document::AllocatorType& a)
-    {
-        if (!property.extras.empty())
-        {
-            auto d = RapidJsonUtils::CreateDocumentFromString(property.extras);
-            rapidjson::Value v(rapidjson::kObjectType);
-            v.CopyFrom(d, a);
-            propertyValue.AddMember("extras", v, a);
-        }
-    }
-
-    void SerializeProperty(const Document& gltfDocument, const glTFProperty& property, rapidjson::Value& propertyValue, rapidjson::Document::AllocatorType& a, const ExtensionSerializer& extensionSerializer)
-    {
-        SerializePropertyExtensions(gltfDocument, property, propertyValue, a, extensionSerializer);
-        SerializePropertyExtras(property, propertyValue, a);
-    }
-
     void SerializeTextureInfo(const Document& gltfDocument, const TextureInfo& textureInfo, rapidjson::Value& textureValue, rapidjson::Document::AllocatorType& a, const IndexedContainer<const Texture>& textures, const ExtensionSerializer& extensionSerializer)
     {
         RapidJsonUtils::AddOptionalMemberIndex("index", textureValue, textureInfo.textureId, textures, a);
@@ -0,0 +1,191 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/ExtensionsMSFT.h>
+
+#include <GLTFSDK/Document.h>
+#include <GLTFSDK/RapidJsonUtils.h>
+
+#include "ExtensionsCommon.h"
+
+using namespace Microsoft::glTF;
+using namespace Microsoft::glTF::Detail;
+
+namespace
+{
+    template<typename T>
+    std::string SerializeLod(const MSFT::Lod& lod, const IndexedContainer<const T>& container, const Document& gltfDocument, const ExtensionSerializer& extensionSerializer)
+    {
+        rapidjson::Document doc;
+        auto& a = doc.GetAllocator();
+        rapidjson::Value MSFT_lod(rapidjson::kObjectType);
+        {
+            rapidjson::Value idsValue(rapidjson::kArrayType);
+
+            for (const auto& id : lod.ids)
+            {
+                idsValue.PushBack(ToKnownSizeType(container.GetIndex(id)), a);
+            }
+
+            MSFT_lod.AddMember("ids", idsValue, a);
+
+            SerializeProperty(gltfDocument, lod, MSFT_lod, a, extensionSerializer);
+        }
+
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+        MSFT_lod.Accept(writer);
+
+        return buffer.GetString();
+    }
+}
+
+ExtensionSerializer MSFT::GetMSFTExtensionSerializer()
+{
+    using namespace MeshPrimitives;
+
+    ExtensionSerializer extensionSerializer;
+    extensionSerializer.AddHandler<Lod, Node>(LOD_NAME, SerializeNodeLod);
+    extensionSerializer.AddHandler<Lod, Material>(LOD_NAME, SerializeMaterialLod);
+    extensionSerializer.AddHandler<Meshlets, MeshPrimitive>(MESHLETS_NAME, SerializeMeshlets);
+    return extensionSerializer;
+}
+
+ExtensionDeserializer MSFT::GetMSFTExtensionDeserializer()
+{
+    using namespace MeshPrimitives;
+
+    ExtensionDeserializer extensionDeserializer;
+    extensionDeserializer.AddHandler<Lod, Node>(LOD_NAME, DeserializeLod);
+    extensionDeserializer.AddHandler<Lod, Material>(LOD_NAME, DeserializeLod);
+    extensionDeserializer.AddHandler<Meshlets, MeshPrimitive>(MESHLETS_NAME, DeserializeMeshlets);
+    return extensionDeserializer;
+}
+
+// MSFT::Lod
+
+std::unique_ptr<Extension> MSFT::Lod::Clone() const
+{
+    return std::make_unique<Lod>(*this);
+}
+
+bool MSFT::Lod::IsEqual(const Extension& rhs) const
+{
+    const auto other = dynamic_cast<const Lod*>(&rhs);
+
+    return other != nullptr
+        && glTFProperty::Equals(*this, *other)
+        && this->ids == other->ids;
+}
+
+std::string MSFT::SerializeNodeLod(const Lod& lod, const Document& glTFdoc, const ExtensionSerializer& extensionSerializer)
+{
+    return SerializeLod(lod, glTFdoc.nodes, glTFdoc, extensionSerializer);
+}
+
+std::string MSFT::SerializeMaterialLod(const Lod& lod, const Document& glTFdoc, const ExtensionSerializer& extensionSerializer)
+{
+    return SerializeLod(lod, glTFdoc.materials, glTFdoc, extensionSerializer);
+}
+
+std::unique_ptr<Extension> MSFT::DeserializeLod(const std::string& json, const ExtensionDeserializer& extensionDeserializer)
+{
+    auto extension = std::make_unique<Lod>();
+
+    auto doc = RapidJsonUtils::CreateDocumentFromString(json);
+    const rapidjson::Value v = doc.GetObject();
+
+    rapidjson::Value::ConstMemberIterator it = v.FindMember("ids");
+    if (it != v.MemberEnd())
+    {
+        if (!it->value.IsArray())
+        {
+            throw GLTFException("Member ids of " + std::string(LOD_NAME) + " is not an array.");
+        }
+
+        for (const auto& id : it->value.GetArray())
+        {
+            if (!id.IsUint())
+            {
+                throw GLTFException("Member ids of " + std::string(LOD_NAME) + " contains an invalid index.");
+            }
+
+            extension->ids.push_back(std::to_string(id.GetUint()));
+        }
+    }
+
+    ParseProperty(v, *extension, extensionDeserializer);
+
+    return extension;
+}
+
+// MSFT::MeshPrimitives::Meshlets
+
+MSFT::MeshPrimitives::Meshlets::Meshlets() :
+    maxVertices(0U),
+    maxTriangles(0U)
+{
+}
+
+std::unique_ptr<Extension> MSFT::MeshPrimitives::Meshlets::Clone() const
+{
+    return std::make_unique<Meshlets>(*this);
+}
+
+bool MSFT::MeshPrimitives::Meshlets::IsEqual(const Extension& rhs) const
+{
+    const auto other = dynamic_cast<const Meshlets*>(&rhs);
+
+    return other != nullptr
+        && glTFProperty::Equals(*this, *other)
+        && this->maxVertices == other->maxVertices
+        && this->maxTriangles == other->maxTriangles
+        && this->meshletsAccessorId == other->meshletsAccessorId
+        && this->verticesAccessorId == other->verticesAccessorId
+        && this->trianglesAccessorId == other->trianglesAccessorId
+        && this->boundsAccessorId == other->boundsAccessorId;
+}
+
+std::string MSFT::MeshPrimitives::SerializeMeshlets(const Meshlets& meshlets, const Document& glTFdoc, const ExtensionSerializer& extensionSerializer)
+{
+    rapidjson::Document doc;
+    auto& a = doc.GetAllocator();
+    rapidjson::Value MSFT_meshlets(rapidjson::kObjectType);
+    {
+        MSFT_meshlets.AddMember("maxVertices", ToKnownSizeType(meshlets.maxVertices), a);
+        MSFT_meshlets.AddMember("maxTriangles", ToKnownSizeType(meshlets.maxTriangles), a);
+
+        RapidJsonUtils::AddOptionalMemberIndex("meshlets", MSFT_meshlets, meshlets.meshletsAccessorId, glTFdoc.accessors, a);
+        RapidJsonUtils::AddOptionalMemberIndex("vertices", MSFT_meshlets, meshlets.verticesAccessorId, glTFdoc.accessors, a);
+        RapidJsonUtils::AddOptionalMemberIndex("triangles", MSFT_meshlets, meshlets.trianglesAccessorId, glTFdoc.accessors, a);
+        RapidJsonUtils::AddOptionalMemberIndex("bounds", MSFT_meshlets, meshlets.boundsAccessorId, glTFdoc.accessors, a);
+
+        SerializeProperty(glTFdoc, meshlets, MSFT_meshlets, a, extensionSerializer);
+    }
+
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    MSFT_meshlets.Accept(writer);
+
+    return buffer.GetString();
+}
+
+std::unique_ptr<Extension> MSFT::MeshPrimitives::DeserializeMeshlets(const std::string& json, const ExtensionDeserializer& extensionDeserializer)
+{
+    auto extension = std::make_unique<Meshlets>();
+
+    auto doc = RapidJsonUtils::CreateDocumentFromString(json);
+    const rapidjson::Value v = doc.GetObject();
+
+    extension->maxVertices = GetMemberValueOrDefault<size_t>(v, "maxVertices", 0U);
+    extension->maxTriangles = GetMemberValueOrDefault<size_t>(v, "maxTriangles", 0U);
+
+    extension->meshletsAccessorId = GetMemberValueAsString<uint32_t>(v, "meshlets");
+    extension->verticesAccessorId = GetMemberValueAsString<uint32_t>(v, "vertices");
+    extension->trianglesAccessorId = GetMemberValueAsString<uint32_t>(v, "triangles");
+    extension->boundsAccessorId = GetMemberValueAsString<uint32_t>(v, "bounds");
+
+    ParseProperty(v, *extension, extensionDeserializer);
+
+    return extension;
+}
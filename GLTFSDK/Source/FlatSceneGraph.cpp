@@ -0,0 +1,143 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/FlatSceneGraph.h>
+
+#include <GLTFSDK/BoundsUtils.h>
+
+using namespace Microsoft::glTF;
+
+constexpr size_t FlatSceneGraph::NoParent;
+constexpr size_t FlatSceneGraph::NotInScene;
+
+FlatSceneGraph::FlatSceneGraph(const Document& doc) : FlatSceneGraph(doc, doc.GetDefaultScene())
+{
+}
+
+FlatSceneGraph::FlatSceneGraph(const Document& doc, const Scene& scene) : FlatSceneGraph(doc, scene, PoseUtils::GetNodeHierarchy(doc))
+{
+}
+
+FlatSceneGraph::FlatSceneGraph(const Document& doc, const Scene& scene, const PoseUtils::NodeHierarchy& hierarchy) : m_flatIndices(doc.nodes.Size(), NotInScene)
+{
+    const size_t nodeCount = hierarchy.order.size();
+
+    // The hierarchy's order is depth first, so each node's subtree is the contiguous range of the order starting at the node.
+    // Descendants follow their ancestors so each subtree's size is complete before it's added to its parent's.
+    std::vector<size_t> orderIndices(nodeCount);
+    std::vector<size_t> subtreeSizes(nodeCount, 1U);
+
+    for (size_t i = 0U; i < nodeCount; ++i)
+    {
+        orderIndices[hierarchy.order[i]] = i;
+    }
+
+    for (size_t i = nodeCount; i-- > 0U;)
+    {
+        const size_t nodeIndex = hierarchy.order[i];
+        const size_t parent = hierarchy.parents[nodeIndex];
+
+        if (parent != PoseUtils::NoParent)
+        {
+            subtreeSizes[parent] += subtreeSizes[nodeIndex];
+        }
+    }
+
+    // Copy the subtree of each of the scene's root nodes in turn
+    for (const auto& rootId : scene.nodes)
+    {
+        const size_t root = doc.nodes.GetIndex(rootId);
+        const size_t begin = orderIndices[root];
+
+        for (size_t i = begin; i < begin + subtreeSizes[root]; ++i)
+        {
+            const size_t nodeIndex = hierarchy.order[i];
+
+            if (m_flatIndices[nodeIndex] != NotInScene)
+            {
+                throw GLTFException("Node " + doc.nodes[nodeIndex].id + " is reachable more than once in scene " + scene.id);
+            }
+
+            const size_t parent = nodeIndex == root ? NoParent : m_flatIndices[hierarchy.parents[nodeIndex]];
+
+            m_flatIndices[nodeIndex] = m_nodeIndices.size();
+            m_nodeIndices.push_back(nodeIndex);
+            m_parents.push_back(parent);
+            m_subtreeSizes.push_back(subtreeSizes[nodeIndex]);
+            m_depths.push_back(parent == NoParent ? 0U : m_depths[parent] + 1U);
+        }
+    }
+}
+
+size_t FlatSceneGraph::GetNodeCount() const
+{
+    return m_nodeIndices.size();
+}
+
+size_t FlatSceneGraph::GetNodeIndex(size_t flatIndex) const
+{
+    return m_nodeIndices.at(flatIndex);
+}
+
+size_t FlatSceneGraph::GetParent(size_t flatIndex) const
+{
+    return m_parents.at(flatIndex);
+}
+
+size_t FlatSceneGraph::GetSubtreeSize(size_t flatIndex) const
+{
+    return m_subtreeSizes.at(flatIndex);
+}
+
+size_t FlatSceneGraph::GetDepth(size_t flatIndex) const
+{
+    return m_depths.at(flatIndex);
+}
+
+size_t FlatSceneGraph::GetFlatIndex(size_t nodeIndex) const
+{
+    return m_flatIndices.at(nodeIndex);
+}
+
+bool FlatSceneGraph::IsAncestor(size_t ancestor, size_t descendant) const
+{
+    return ancestor < descendant && descendant < ancestor + m_subtreeSizes.at(ancestor);
+}
+
+const std::vector<size_t>& FlatSceneGraph::GetNodeIndices() const
+{
+    return m_nodeIndices;
+}
+
+const std::vector<size_t>& FlatSceneGraph::GetParents() const
+{
+    return m_parents;
+}
+
+const std::vector<size_t>& FlatSceneGraph::GetSubtreeSizes() const
+{
+    return m_subtreeSizes;
+}
+
+std::vector<Matrix4> FlatSceneGraph::GetLocalTransforms(const Document& doc) const
+{
+    std::vector<Matrix4> localTransforms;
+    localTransforms.reserve(m_nodeIndices.size());
+
+    for (auto nodeIndex : m_nodeIndices)
+    {
+        localTransforms.push_back(BoundsUtils::GetLocalTransform(doc.nodes[nodeIndex]));
+    }
+
+    return localTransforms;
+}
+
+void FlatSceneGraph::ComputeWorldTransforms(const Matrix4* localTransforms, Matrix4* worldTransforms) const
+{
+    for (size_t i = 0U; i < m_parents.size(); ++i)
+    {
+        const size_t parent = m_parents[i];
+
+        worldTransforms[i] = parent == NoParent ? localTransforms[i] : Math::Multiply(worldTransforms[parent], localTransforms[i]);
+    }
+}
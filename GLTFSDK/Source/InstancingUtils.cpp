@@ -0,0 +1,387 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/InstancingUtils.h>
+
+#include <GLTFSDK/BufferBuilder.h>
+#include <GLTFSDK/Document.h>
+#include <GLTFSDK/GLTFResourceReader.h>
+
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+using namespace Microsoft::glTF;
+
+namespace
+{
+    bool CanInstance(const Node& node)
+    {
+        return !node.meshId.empty()
+            && node.children.empty()
+            && node.cameraId.empty()
+            && node.skinId.empty()
+            && node.weights.empty()
+            && node.GetTransformationType() != TRANSFORMATION_MATRIX
+            && node.extensions.empty()
+            && node.GetExtensions().empty()
+            && node.extras.empty();
+    }
+
+    // The ids of nodes whose identity matters to other parts of the document
+    std::unordered_set<std::string> GetReferencedNodeIds(const Document& doc)
+    {
+        std::unordered_set<std::string> nodeIds;
+
+        for (const auto& animation : doc.animations.Elements())
+        {
+            for (const auto& channel : animation.channels.Elements())
+            {
+                nodeIds.insert(channel.target.nodeId);
+            }
+        }
+
+        for (const auto& skin : doc.skins.Elements())
+        {
+            nodeIds.insert(skin.jointIds.begin(), skin.jointIds.end());
+
+            if (!skin.skeletonId.empty())
+            {
+                nodeIds.insert(skin.skeletonId);
+            }
+        }
+
+        return nodeIds;
+    }
+
+    std::vector<float> ReadInstanceAccessor(const Document& doc, const GLTFResourceReader& reader, const std::string& accessorId, AccessorType accessorType)
+    {
+        const auto& accessor = doc.accessors.Get(accessorId);
+
+        if (accessor.type != accessorType || accessor.componentType != COMPONENT_FLOAT)
+        {
+            throw GLTFException("Accessor " + accessor.id + " has an unsupported type for " + EXT::Nodes::MESH_GPU_INSTANCING_NAME);
+        }
+
+        return reader.ReadBinaryData<float>(doc, accessor);
+    }
+
+    // Replaces the first id of each group with the id of the group's instanced node and removes the other ids
+    std::vector<std::string> ReplaceIds(const std::vector<std::string>& ids, const std::unordered_map<std::string, std::string>& replacements)
+    {
+        std::vector<std::string> result;
+        result.reserve(ids.size());
+
+        for (const auto& id : ids)
+        {
+            const auto it = replacements.find(id);
+
+            if (it == replacements.end())
+            {
+                result.push_back(id);
+            }
+            else if (!it->second.empty())
+            {
+                result.push_back(it->second);
+            }
+        }
+
+        return result;
+    }
+}
+
+std::vector<InstancingUtils::InstanceGroup> InstancingUtils::FindInstanceGroups(const Document& doc, size_t minInstanceCount)
+{
+    const size_t nodeCount = doc.nodes.Size();
+
+    // The parent of each node, and the scene of each root node (or an empty id if it's a root of more than one scene)
+    std::vector<std::string> parentIds(nodeCount);
+    std::vector<std::string> sceneIds(nodeCount);
+    std::vector<size_t> sceneCounts(nodeCount, 0U);
+
+    for (const auto& node : doc.nodes.Elements())
+    {
+        for (const auto& childId : node.children)
+        {
+            parentIds[doc.nodes.GetIndex(childId)] = node.id;
+        }
+    }
+
+    for (const auto& scene : doc.scenes.Elements())
+    {
+        for (const auto& nodeId : scene.nodes)
+        {
+            const size_t nodeIndex = doc.nodes.GetIndex(nodeId);
+
+            if (sceneCounts[nodeIndex]++ == 0U)
+            {
+                sceneIds[nodeIndex] = scene.id;
+            }
+            else
+            {
+                sceneIds[nodeIndex].clear();
+            }
+        }
+    }
+
+    const auto referencedNodeIds = GetReferencedNodeIds(doc);
+
+    std::vector<InstanceGroup> groups;
+
+    // Keyed by the parent (or scene) id and the mesh id, with a prefix so a parent and a scene with the same id don't collide
+    std::unordered_map<std::string, size_t> groupIndices;
+
+    for (size_t i = 0U; i < nodeCount; ++i)
+    {
+        const auto& node = doc.nodes[i];
+
+        if (!CanInstance(node) || referencedNodeIds.count(node.id) > 0U)
+        {
+            continue;
+        }
+
+        std::string key;
+
+        if (!parentIds[i].empty())
+        {
+            if (sceneCounts[i] > 0U)
+            {
+                continue; // A node can't be both a root and a child
+            }
+
+            key = "n" + parentIds[i];
+        }
+        else if (!sceneIds[i].empty())
+        {
+            key = "s" + sceneIds[i];
+        }
+        else
+        {
+            continue; // Not in any scene, or a root of several scenes
+        }
+
+        key += '\n';
+        key += node.meshId;
+
+        const auto result = groupIndices.emplace(std::move(key), groups.size());
+
+        if (result.second)
+        {
+            InstanceGroup group;
+            group.meshId = node.meshId;
+            group.parentId = parentIds[i];
+            group.sceneId = parentIds[i].empty() ? sceneIds[i] : std::string();
+
+            groups.push_back(std::move(group));
+        }
+
+        groups[result.first->second].nodeIds.push_back(node.id);
+    }
+
+    std::vector<InstanceGroup> result;
+
+    for (auto& group : groups)
+    {
+        if (group.nodeIds.size() >= minInstanceCount)
+        {
+            result.push_back(std::move(group));
+        }
+    }
+
+    return result;
+}
+
+EXT::Nodes::MeshGpuInstancing InstancingUtils::AddInstances(const Document& doc, const InstanceGroup& group, BufferBuilder& bufferBuilder)
+{
+    const size_t instanceCount = group.nodeIds.size();
+
+    std::vector<float> translations;
+    std::vector<float> rotations;
+    std::vector<float> scales;
+
+    translations.reserve(instanceCount * 3U);
+    rotations.reserve(instanceCount * 4U);
+    scales.reserve(instanceCount * 3U);
+
+    bool hasRotations = false;
+    bool hasScales = false;
+
+    for (const auto& nodeId : group.nodeIds)
+    {
+        const auto& node = doc.nodes.Get(nodeId);
+
+        translations.insert(translations.end(), { node.translation.x, node.translation.y, node.translation.z });
+        rotations.insert(rotations.end(), { node.rotation.x, node.rotation.y, node.rotation.z, node.rotation.w });
+        scales.insert(scales.end(), { node.scale.x, node.scale.y, node.scale.z });
+
+        hasRotations |= node.rotation != Quaternion::IDENTITY;
+        hasScales |= node.scale != Vector3::ONE;
+    }
+
+    EXT::Nodes::MeshGpuInstancing meshGpuInstancing;
+
+    // TRANSLATION is always written, even if it's zero for every instance, as the instance count is the accessors' count
+    bufferBuilder.AddBufferView(BufferViewTarget::UNKNOWN_BUFFER);
+    meshGpuInstancing.attributes[EXT::Nodes::ACCESSOR_TRANSLATION] = bufferBuilder.AddAccessor(translations, { TYPE_VEC3, COMPONENT_FLOAT }).id;
+
+    if (hasRotations)
+    {
+        bufferBuilder.AddBufferView(BufferViewTarget::UNKNOWN_BUFFER);
+        meshGpuInstancing.attributes[EXT::Nodes::ACCESSOR_ROTATION] = bufferBuilder.AddAccessor(rotations, { TYPE_VEC4, COMPONENT_FLOAT }).id;
+    }
+
+    if (hasScales)
+    {
+        bufferBuilder.AddBufferView(BufferViewTarget::UNKNOWN_BUFFER);
+        meshGpuInstancing.attributes[EXT::Nodes::ACCESSOR_SCALE] = bufferBuilder.AddAccessor(scales, { TYPE_VEC3, COMPONENT_FLOAT }).id;
+    }
+
+    return meshGpuInstancing;
+}
+
+size_t InstancingUtils::InstanceMeshes(Document& doc, BufferBuilder& bufferBuilder, size_t minInstanceCount)
+{
+    const auto groups = FindInstanceGroups(doc, minInstanceCount);
+
+    if (groups.empty())
+    {
+        return 0U;
+    }
+
+    std::vector<Node> instancedNodes;
+    instancedNodes.reserve(groups.size());
+
+    for (const auto& group : groups)
+    {
+        Node node;
+        node.meshId = group.meshId;
+        node.SetExtension<EXT::Nodes::MeshGpuInstancing>(AddInstances(doc, group, bufferBuilder));
+
+        instancedNodes.push_back(std::move(node));
+    }
+
+    // The grouped nodes are removed by rebuilding the container, as removing them one at a time reindexes every node
+    std::unordered_map<std::string, std::string> replacements;
+    size_t removedCount = 0U;
+
+    for (const auto& group : groups)
+    {
+        for (const auto& nodeId : group.nodeIds)
+        {
+            replacements.emplace(nodeId, std::string());
+        }
+
+        removedCount += group.nodeIds.size();
+    }
+
+    IndexedContainer<const Node> nodes;
+    nodes.Reserve(doc.nodes.Size() - removedCount + groups.size());
+
+    for (const auto& node : doc.nodes.Elements())
+    {
+        if (replacements.find(node.id) == replacements.end())
+        {
+            nodes.Append(node);
+        }
+    }
+
+    // The instanced nodes' ids are generated once the grouped nodes' ids are free
+    for (size_t i = 0U; i < groups.size(); ++i)
+    {
+        replacements[groups[i].nodeIds.front()] = nodes.Append(std::move(instancedNodes[i]), AppendIdPolicy::GenerateOnEmpty).id;
+    }
+
+    doc.nodes = std::move(nodes);
+
+    // Each instanced node takes the place of its group's first node
+    std::unordered_set<std::string> parentIds;
+    std::unordered_set<std::string> sceneIds;
+
+    for (const auto& group : groups)
+    {
+        if (group.parentId.empty())
+        {
+            sceneIds.insert(group.sceneId);
+        }
+        else
+        {
+            parentIds.insert(group.parentId);
+        }
+    }
+
+    for (const auto& parentId : parentIds)
+    {
+        Node parent = doc.nodes.Get(parentId);
+        parent.children = ReplaceIds(parent.children, replacements);
+
+        doc.nodes.Replace(std::move(parent));
+    }
+
+    for (const auto& sceneId : sceneIds)
+    {
+        Scene scene = doc.scenes.Get(sceneId);
+        scene.nodes = ReplaceIds(scene.nodes, replacements);
+
+        doc.scenes.Replace(std::move(scene));
+    }
+
+    AddExtension(doc);
+
+    return removedCount;
+}
+
+std::vector<Matrix4> InstancingUtils::GetInstanceTransforms(const Document& doc, const GLTFResourceReader& reader, const EXT::Nodes::MeshGpuInstancing& meshGpuInstancing)
+{
+    std::vector<float> translations;
+    std::vector<float> rotations;
+    std::vector<float> scales;
+
+    size_t instanceCount = 0U;
+    bool hasInstanceCount = false;
+
+    const auto readAttribute = [&](const char* name, AccessorType accessorType, std::vector<float>& values)
+    {
+        const auto it = meshGpuInstancing.attributes.find(name);
+
+        if (it == meshGpuInstancing.attributes.end())
+        {
+            return;
+        }
+
+        values = ReadInstanceAccessor(doc, reader, it->second, accessorType);
+
+        const size_t count = values.size() / Accessor::GetTypeCount(accessorType);
+
+        if (hasInstanceCount && count != instanceCount)
+        {
+            throw GLTFException(std::string("The attributes of ") + EXT::Nodes::MESH_GPU_INSTANCING_NAME + " have different counts");
+        }
+
+        instanceCount = count;
+        hasInstanceCount = true;
+    };
+
+    readAttribute(EXT::Nodes::ACCESSOR_TRANSLATION, TYPE_VEC3, translations);
+    readAttribute(EXT::Nodes::ACCESSOR_ROTATION, TYPE_VEC4, rotations);
+    readAttribute(EXT::Nodes::ACCESSOR_SCALE, TYPE_VEC3, scales);
+
+    std::vector<Matrix4> transforms;
+    transforms.reserve(instanceCount);
+
+    for (size_t i = 0U; i < instanceCount; ++i)
+    {
+        const Vector3 translation = translations.empty() ? Vector3::ZERO : Vector3(translations[i * 3U], translations[i * 3U + 1U], translations[i * 3U + 2U]);
+        const Quaternion rotation = rotations.empty() ? Quaternion::IDENTITY : Quaternion(rotations[i * 4U], rotations[i * 4U + 1U], rotations[i * 4U + 2U], rotations[i * 4U + 3U]);
+        const Vector3 scale = scales.empty() ? Vector3::ONE : Vector3(scales[i * 3U], scales[i * 3U + 1U], scales[i * 3U + 2U]);
+
+        transforms.push_back(Math::CreateTransform(translation, rotation, scale));
+    }
+
+    return transforms;
+}
+
+void InstancingUtils::AddExtension(Document& document)
+{
+    document.extensionsUsed.insert(EXT::Nodes::MESH_GPU_INSTANCING_NAME);
+    document.extensionsRequired.insert(EXT::Nodes::MESH_GPU_INSTANCING_NAME);
+}
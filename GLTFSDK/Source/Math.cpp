@@ -3,8 +3,75 @@
 
 #include <GLTFSDK/Math.h>
 
+#include <GLTFSDK/SIMD.h>
+
+#include <tuple>
+
 using namespace Microsoft::glTF;
 
+namespace
+{
+    // Above this cosine of the angle between two rotations slerp is replaced by nlerp to avoid dividing by a tiny sine
+    constexpr float SlerpThreshold = 0.9995f;
+
+    Quaternion Normalize(const Quaternion& q)
+    {
+        const float length = std::sqrt(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+
+        if (length > 0.0f)
+        {
+            const float scale = 1.0f / length;
+
+            return Quaternion(q.x * scale, q.y * scale, q.z * scale, q.w * scale);
+        }
+
+        return q;
+    }
+
+    Quaternion Interpolate(const Quaternion& a, const Quaternion& b, float t, bool slerp)
+    {
+        float dot = a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+
+        // q and -q are the same rotation so b is negated if necessary to interpolate along the shortest arc
+        const float sign = dot < 0.0f ? -1.0f : 1.0f;
+        dot *= sign;
+
+        float wa = 1.0f - t;
+        float wb = t;
+
+        if (slerp && dot < SlerpThreshold)
+        {
+            const float theta = std::acos(dot);
+            const float sinTheta = std::sin(theta);
+
+            wa = std::sin(wa * theta) / sinTheta;
+            wb = std::sin(wb * theta) / sinTheta;
+        }
+
+        wb *= sign;
+
+        return Normalize(Quaternion(
+            a.x * wa + b.x * wb,
+            a.y * wa + b.y * wb,
+            a.z * wa + b.z * wb,
+            a.w * wa + b.w * wb));
+    }
+
+    void TransformPointsScalar(const float* m, const float* points, size_t count, float* output)
+    {
+        for (size_t i = 0U; i < count; ++i)
+        {
+            const float x = points[i * 3U];
+            const float y = points[i * 3U + 1U];
+            const float z = points[i * 3U + 2U];
+
+            output[i * 3U] = m[0] * x + m[4] * y + m[8] * z + m[12];
+            output[i * 3U + 1U] = m[1] * x + m[5] * y + m[9] * z + m[13];
+            output[i * 3U + 2U] = m[2] * x + m[6] * y + m[10] * z + m[14];
+        }
+    }
+}
+
 const Matrix4 Matrix4::IDENTITY = Matrix4();
 const Vector2 Vector2::ZERO = { 0.0f, 0.0f };
 const Vector2 Vector2::ONE = { 1.0f, 1.0f };
@@ -92,3 +159,312 @@ bool Quaternion::operator!=(const Quaternion& other) const
     return !operator==(other);
 }
 
+Matrix4 Math::Multiply(const Matrix4& lhs, const Matrix4& rhs)
+{
+    Matrix4 result;
+
+    // Each column of the result is the lhs columns weighted by the corresponding rhs column's components. The vectorized
+    // paths add the products in the same order as the scalar one so all three give the same results.
+#if defined(GLTFSDK_SSE2)
+    const float* l = lhs.values.data();
+
+    const __m128 c0 = _mm_loadu_ps(l);
+    const __m128 c1 = _mm_loadu_ps(l + 4);
+    const __m128 c2 = _mm_loadu_ps(l + 8);
+    const __m128 c3 = _mm_loadu_ps(l + 12);
+
+    for (size_t column = 0U; column < 4U; ++column)
+    {
+        const float* r = rhs.values.data() + column * 4U;
+
+        __m128 sum = _mm_mul_ps(c0, _mm_set1_ps(r[0]));
+        sum = _mm_add_ps(sum, _mm_mul_ps(c1, _mm_set1_ps(r[1])));
+        sum = _mm_add_ps(sum, _mm_mul_ps(c2, _mm_set1_ps(r[2])));
+        sum = _mm_add_ps(sum, _mm_mul_ps(c3, _mm_set1_ps(r[3])));
+
+        _mm_storeu_ps(result.values.data() + column * 4U, sum);
+    }
+#elif defined(GLTFSDK_NEON)
+    const float* l = lhs.values.data();
+
+    const float32x4_t c0 = vld1q_f32(l);
+    const float32x4_t c1 = vld1q_f32(l + 4);
+    const float32x4_t c2 = vld1q_f32(l + 8);
+    const float32x4_t c3 = vld1q_f32(l + 12);
+
+    for (size_t column = 0U; column < 4U; ++column)
+    {
+        const float* r = rhs.values.data() + column * 4U;
+
+        // vmlaq is an unfused multiply-add
+        float32x4_t sum = vmulq_n_f32(c0, r[0]);
+        sum = vmlaq_n_f32(sum, c1, r[1]);
+        sum = vmlaq_n_f32(sum, c2, r[2]);
+        sum = vmlaq_n_f32(sum, c3, r[3]);
+
+        vst1q_f32(result.values.data() + column * 4U, sum);
+    }
+#else
+    for (size_t column = 0U; column < 4U; ++column)
+    {
+        for (size_t row = 0U; row < 4U; ++row)
+        {
+            result.values[column * 4U + row] =
+                lhs.values[row] * rhs.values[column * 4U] +
+                lhs.values[4U + row] * rhs.values[column * 4U + 1U] +
+                lhs.values[8U + row] * rhs.values[column * 4U + 2U] +
+                lhs.values[12U + row] * rhs.values[column * 4U + 3U];
+        }
+    }
+#endif
+
+    return result;
+}
+
+Matrix4 Math::CreateTransform(const Vector3& translation, const Quaternion& rotation, const Vector3& scale)
+{
+    const float xx = rotation.x * rotation.x;
+    const float yy = rotation.y * rotation.y;
+    const float zz = rotation.z * rotation.z;
+    const float xy = rotation.x * rotation.y;
+    const float xz = rotation.x * rotation.z;
+    const float yz = rotation.y * rotation.z;
+    const float wx = rotation.w * rotation.x;
+    const float wy = rotation.w * rotation.y;
+    const float wz = rotation.w * rotation.z;
+
+    Matrix4 result;
+
+    result.values = {{
+        (1.0f - 2.0f * (yy + zz)) * scale.x, 2.0f * (xy + wz) * scale.x, 2.0f * (xz - wy) * scale.x, 0.0f,
+        2.0f * (xy - wz) * scale.y, (1.0f - 2.0f * (xx + zz)) * scale.y, 2.0f * (yz + wx) * scale.y, 0.0f,
+        2.0f * (xz + wy) * scale.z, 2.0f * (yz - wx) * scale.z, (1.0f - 2.0f * (xx + yy)) * scale.z, 0.0f,
+        translation.x, translation.y, translation.z, 1.0f
+    }};
+
+    return result;
+}
+
+Vector3 Math::TransformPoint(const Matrix4& matrix, const Vector3& point)
+{
+    const auto& m = matrix.values;
+
+    return Vector3(
+        m[0] * point.x + m[4] * point.y + m[8] * point.z + m[12],
+        m[1] * point.x + m[5] * point.y + m[9] * point.z + m[13],
+        m[2] * point.x + m[6] * point.y + m[10] * point.z + m[14]);
+}
+
+bool Math::Decompose(const Matrix4& matrix, Vector3& translation, Quaternion& rotation, Vector3& scale)
+{
+    const auto& m = matrix.values;
+
+    if (m[3] != 0.0f || m[7] != 0.0f || m[11] != 0.0f || m[15] != 1.0f)
+    {
+        return false;
+    }
+
+    float scaleX = std::sqrt(m[0] * m[0] + m[1] * m[1] + m[2] * m[2]);
+    const float scaleY = std::sqrt(m[4] * m[4] + m[5] * m[5] + m[6] * m[6]);
+    const float scaleZ = std::sqrt(m[8] * m[8] + m[9] * m[9] + m[10] * m[10]);
+
+    if (scaleX == 0.0f || scaleY == 0.0f || scaleZ == 0.0f)
+    {
+        return false;
+    }
+
+    const float determinant =
+        m[0] * (m[5] * m[10] - m[6] * m[9]) -
+        m[4] * (m[1] * m[10] - m[2] * m[9]) +
+        m[8] * (m[1] * m[6] - m[2] * m[5]);
+
+    if (determinant < 0.0f)
+    {
+        scaleX = -scaleX;
+    }
+
+    // The rotation matrix, indexed by row and then column
+    const float r00 = m[0] / scaleX, r10 = m[1] / scaleX, r20 = m[2] / scaleX;
+    const float r01 = m[4] / scaleY, r11 = m[5] / scaleY, r21 = m[6] / scaleY;
+    const float r02 = m[8] / scaleZ, r12 = m[9] / scaleZ, r22 = m[10] / scaleZ;
+
+    // Computed from the largest of w, x, y and z to avoid dividing by a small number
+    Quaternion q;
+    const float trace = r00 + r11 + r22;
+
+    if (trace > 0.0f)
+    {
+        const float s = 2.0f * std::sqrt(trace + 1.0f);
+
+        q = Quaternion((r21 - r12) / s, (r02 - r20) / s, (r10 - r01) / s, 0.25f * s);
+    }
+    else if (r00 > r11 && r00 > r22)
+    {
+        const float s = 2.0f * std::sqrt(1.0f + r00 - r11 - r22);
+
+        q = Quaternion(0.25f * s, (r01 + r10) / s, (r02 + r20) / s, (r21 - r12) / s);
+    }
+    else if (r11 > r22)
+    {
+        const float s = 2.0f * std::sqrt(1.0f + r11 - r00 - r22);
+
+        q = Quaternion((r01 + r10) / s, 0.25f * s, (r12 + r21) / s, (r02 - r20) / s);
+    }
+    else
+    {
+        const float s = 2.0f * std::sqrt(1.0f + r22 - r00 - r11);
+
+        q = Quaternion((r02 + r20) / s, (r12 + r21) / s, 0.25f * s, (r10 - r01) / s);
+    }
+
+    translation = Vector3(m[12], m[13], m[14]);
+    rotation = Normalize(q);
+    scale = Vector3(scaleX, scaleY, scaleZ);
+
+    return true;
+}
+
+void Math::TransformPoints(const Matrix4& matrix, const float* points, size_t count, float* output)
+{
+    const float* m = matrix.values.data();
+
+    size_t i = 0U;
+
+    // Four points (twelve floats) per iteration, transposed so each register holds one component of all four points
+#if defined(GLTFSDK_SSE2)
+    const __m128 m0 = _mm_set1_ps(m[0]), m1 = _mm_set1_ps(m[1]), m2 = _mm_set1_ps(m[2]);
+    const __m128 m4 = _mm_set1_ps(m[4]), m5 = _mm_set1_ps(m[5]), m6 = _mm_set1_ps(m[6]);
+    const __m128 m8 = _mm_set1_ps(m[8]), m9 = _mm_set1_ps(m[9]), m10 = _mm_set1_ps(m[10]);
+    const __m128 m12 = _mm_set1_ps(m[12]), m13 = _mm_set1_ps(m[13]), m14 = _mm_set1_ps(m[14]);
+
+    for (; i + 4U <= count; i += 4U)
+    {
+        // x0 y0 z0 x1, y1 z1 x2 y2, z2 x3 y3 z3
+        const __m128 a = _mm_loadu_ps(points + i * 3U);
+        const __m128 b = _mm_loadu_ps(points + i * 3U + 4U);
+        const __m128 c = _mm_loadu_ps(points + i * 3U + 8U);
+
+        const __m128 xy = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 1, 3, 2)); // x2 y2 x3 y3
+        const __m128 yz = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 0, 2, 1)); // y0 z0 y1 z1
+
+        const __m128 x = _mm_shuffle_ps(a, xy, _MM_SHUFFLE(2, 0, 3, 0));
+        const __m128 y = _mm_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+        const __m128 z = _mm_shuffle_ps(yz, c, _MM_SHUFFLE(3, 0, 3, 1));
+
+        const __m128 tx = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m0, x), _mm_mul_ps(m4, y)), _mm_mul_ps(m8, z)), m12);
+        const __m128 ty = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m1, x), _mm_mul_ps(m5, y)), _mm_mul_ps(m9, z)), m13);
+        const __m128 tz = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m2, x), _mm_mul_ps(m6, y)), _mm_mul_ps(m10, z)), m14);
+
+        // And back to x0 y0 z0 x1, y1 z1 x2 y2, z2 x3 y3 z3
+        const __m128 xyLow = _mm_unpacklo_ps(tx, ty);                                 // x0 y0 x1 y1
+        const __m128 xyHigh = _mm_unpackhi_ps(tx, ty);                                // x2 y2 x3 y3
+        const __m128 zx = _mm_shuffle_ps(tz, tx, _MM_SHUFFLE(1, 1, 0, 0));            // z0 z0 x1 x1
+        const __m128 yz1 = _mm_shuffle_ps(ty, tz, _MM_SHUFFLE(1, 1, 1, 1));           // y1 y1 z1 z1
+        const __m128 zx3 = _mm_shuffle_ps(tz, tx, _MM_SHUFFLE(3, 3, 2, 2));           // z2 z2 x3 x3
+        const __m128 yz3 = _mm_shuffle_ps(ty, tz, _MM_SHUFFLE(3, 3, 3, 3));           // y3 y3 z3 z3
+
+        _mm_storeu_ps(output + i * 3U, _mm_shuffle_ps(xyLow, zx, _MM_SHUFFLE(2, 0, 1, 0)));
+        _mm_storeu_ps(output + i * 3U + 4U, _mm_shuffle_ps(yz1, xyHigh, _MM_SHUFFLE(1, 0, 2, 0)));
+        _mm_storeu_ps(output + i * 3U + 8U, _mm_shuffle_ps(zx3, yz3, _MM_SHUFFLE(2, 0, 2, 0)));
+    }
+#elif defined(GLTFSDK_NEON)
+    for (; i + 4U <= count; i += 4U)
+    {
+        const float32x4x3_t p = vld3q_f32(points + i * 3U);
+
+        float32x4x3_t t;
+        t.val[0] = vaddq_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(p.val[0], m[0]), p.val[1], m[4]), p.val[2], m[8]), vdupq_n_f32(m[12]));
+        t.val[1] = vaddq_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(p.val[0], m[1]), p.val[1], m[5]), p.val[2], m[9]), vdupq_n_f32(m[13]));
+        t.val[2] = vaddq_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(p.val[0], m[2]), p.val[1], m[6]), p.val[2], m[10]), vdupq_n_f32(m[14]));
+
+        vst3q_f32(output + i * 3U, t);
+    }
+#endif
+
+    TransformPointsScalar(m, points + i * 3U, count - i, output + i * 3U);
+}
+
+void Math::TransformBounds(const Matrix4* matrices, const Vector3* mins, const Vector3* maxs, size_t count, Vector3* outputMins, Vector3* outputMaxs)
+{
+    // Transforms the center and then sums the absolute contribution of each half extent to each axis (Arvo 1990)
+    for (size_t i = 0U; i < count; ++i)
+    {
+        const float* m = matrices[i].values.data();
+
+        const float center[3] = { (mins[i].x + maxs[i].x) * 0.5f, (mins[i].y + maxs[i].y) * 0.5f, (mins[i].z + maxs[i].z) * 0.5f };
+        const float extents[3] = { (maxs[i].x - mins[i].x) * 0.5f, (maxs[i].y - mins[i].y) * 0.5f, (maxs[i].z - mins[i].z) * 0.5f };
+
+#if defined(GLTFSDK_SSE2)
+        // The sign bits are cleared to take the absolute value of the matrix's first three columns for the extents
+        const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+
+        const __m128 c0 = _mm_loadu_ps(m);
+        const __m128 c1 = _mm_loadu_ps(m + 4);
+        const __m128 c2 = _mm_loadu_ps(m + 8);
+        const __m128 c3 = _mm_loadu_ps(m + 12);
+
+        __m128 transformedCenter = _mm_mul_ps(c0, _mm_set1_ps(center[0]));
+        transformedCenter = _mm_add_ps(transformedCenter, _mm_mul_ps(c1, _mm_set1_ps(center[1])));
+        transformedCenter = _mm_add_ps(transformedCenter, _mm_mul_ps(c2, _mm_set1_ps(center[2])));
+        transformedCenter = _mm_add_ps(transformedCenter, c3);
+
+        __m128 transformedExtents = _mm_mul_ps(_mm_and_ps(c0, absMask), _mm_set1_ps(extents[0]));
+        transformedExtents = _mm_add_ps(transformedExtents, _mm_mul_ps(_mm_and_ps(c1, absMask), _mm_set1_ps(extents[1])));
+        transformedExtents = _mm_add_ps(transformedExtents, _mm_mul_ps(_mm_and_ps(c2, absMask), _mm_set1_ps(extents[2])));
+
+        float min[4];
+        float max[4];
+
+        _mm_storeu_ps(min, _mm_sub_ps(transformedCenter, transformedExtents));
+        _mm_storeu_ps(max, _mm_add_ps(transformedCenter, transformedExtents));
+
+        outputMins[i] = Vector3(min[0], min[1], min[2]);
+        outputMaxs[i] = Vector3(max[0], max[1], max[2]);
+#elif defined(GLTFSDK_NEON)
+        const float32x4_t c0 = vld1q_f32(m);
+        const float32x4_t c1 = vld1q_f32(m + 4);
+        const float32x4_t c2 = vld1q_f32(m + 8);
+        const float32x4_t c3 = vld1q_f32(m + 12);
+
+        float32x4_t transformedCenter = vmulq_n_f32(c0, center[0]);
+        transformedCenter = vmlaq_n_f32(transformedCenter, c1, center[1]);
+        transformedCenter = vmlaq_n_f32(transformedCenter, c2, center[2]);
+        transformedCenter = vaddq_f32(transformedCenter, c3);
+
+        float32x4_t transformedExtents = vmulq_n_f32(vabsq_f32(c0), extents[0]);
+        transformedExtents = vmlaq_n_f32(transformedExtents, vabsq_f32(c1), extents[1]);
+        transformedExtents = vmlaq_n_f32(transformedExtents, vabsq_f32(c2), extents[2]);
+
+        float min[4];
+        float max[4];
+
+        vst1q_f32(min, vsubq_f32(transformedCenter, transformedExtents));
+        vst1q_f32(max, vaddq_f32(transformedCenter, transformedExtents));
+
+        outputMins[i] = Vector3(min[0], min[1], min[2]);
+        outputMaxs[i] = Vector3(max[0], max[1], max[2]);
+#else
+        float transformedCenter[3];
+        float transformedExtents[3];
+
+        for (size_t row = 0U; row < 3U; ++row)
+        {
+            transformedCenter[row] = m[row] * center[0] + m[4U + row] * center[1] + m[8U + row] * center[2] + m[12U + row];
+            transformedExtents[row] = std::abs(m[row]) * extents[0] + std::abs(m[4U + row]) * extents[1] + std::abs(m[8U + row]) * extents[2];
+        }
+
+        outputMins[i] = Vector3(transformedCenter[0] - transformedExtents[0], transformedCenter[1] - transformedExtents[1], transformedCenter[2] - transformedExtents[2]);
+        outputMaxs[i] = Vector3(transformedCenter[0] + transformedExtents[0], transformedCenter[1] + transformedExtents[1], transformedCenter[2] + transformedExtents[2]);
+#endif
+    }
+}
+
+Quaternion Math::Slerp(const Quaternion& a, const Quaternion& b, float t)
+{
+    return Interpolate(a, b, t, true);
+}
+
+Quaternion Math::Nlerp(const Quaternion& a, const Quaternion& b, float t)
+{
+    return Interpolate(a, b, t, false);
+}
@@ -0,0 +1,769 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/MeshOptimizationUtils.h>
+
+#include <GLTFSDK/BufferBuilder.h>
+#include <GLTFSDK/ConversionUtils.h>
+#include <GLTFSDK/GLTFResourceReader.h>
+#include <GLTFSDK/MeshPrimitiveUtils.h>
+#include <GLTFSDK/ParallelUtils.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <unordered_map>
+
+using namespace Microsoft::glTF;
+
+namespace
+{
+    void ValidateIndices(const std::vector<uint32_t>& indices, size_t vertexCount)
+    {
+        if (indices.size() % 3U != 0U)
+        {
+            throw GLTFException("The number of triangle list indices must be a multiple of 3");
+        }
+
+        for (auto index : indices)
+        {
+            if (index >= vertexCount)
+            {
+                throw GLTFException("Index " + std::to_string(index) + " is out of range for " + std::to_string(vertexCount) + " vertices");
+            }
+        }
+    }
+
+    // Simulates a FIFO vertex cache - a vertex is in the cache if fewer than cacheSize misses have occurred since it was added
+    class VertexCache
+    {
+    public:
+        VertexCache(size_t vertexCount, size_t cacheSize) :
+            m_cacheTimes(vertexCount, 0U),
+            m_cacheSize(cacheSize),
+            m_time(cacheSize + 1U)
+        {
+        }
+
+        bool IsCached(uint32_t vertex) const
+        {
+            return m_time - m_cacheTimes[vertex] <= m_cacheSize;
+        }
+
+        // Returns the number of time steps since the vertex was added to the cache
+        size_t GetAge(uint32_t vertex) const
+        {
+            return m_time - m_cacheTimes[vertex];
+        }
+
+        // Returns true if the vertex was not already in the cache
+        bool Add(uint32_t vertex)
+        {
+            if (IsCached(vertex))
+            {
+                return false;
+            }
+
+            m_cacheTimes[vertex] = m_time++;
+            return true;
+        }
+
+    private:
+        std::vector<size_t> m_cacheTimes;
+        const size_t m_cacheSize;
+        size_t m_time;
+    };
+
+    struct Vertex
+    {
+        float x;
+        float y;
+        float z;
+    };
+
+    Vertex GetVertex(const std::vector<float>& positions, uint32_t index)
+    {
+        return { positions[index * 3U], positions[index * 3U + 1U], positions[index * 3U + 2U] };
+    }
+
+    template<typename T>
+    void ReadElements(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, uint8_t* output)
+    {
+        reader.ReadBinaryData<T>(doc, accessor, StridedSpan<T>(reinterpret_cast<T*>(output), accessor.count));
+    }
+
+    // Reads the accessor's elements, whatever their component type, as tightly packed bytes
+    std::vector<uint8_t> ReadElements(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
+    {
+        std::vector<uint8_t> elements(accessor.GetByteLength());
+
+        switch (accessor.componentType)
+        {
+        case COMPONENT_BYTE:
+            ReadElements<int8_t>(doc, reader, accessor, elements.data());
+            break;
+        case COMPONENT_UNSIGNED_BYTE:
+            ReadElements<uint8_t>(doc, reader, accessor, elements.data());
+            break;
+        case COMPONENT_SHORT:
+            ReadElements<int16_t>(doc, reader, accessor, elements.data());
+            break;
+        case COMPONENT_UNSIGNED_SHORT:
+            ReadElements<uint16_t>(doc, reader, accessor, elements.data());
+            break;
+        case COMPONENT_UNSIGNED_INT:
+            ReadElements<uint32_t>(doc, reader, accessor, elements.data());
+            break;
+        case COMPONENT_FLOAT:
+            ReadElements<float>(doc, reader, accessor, elements.data());
+            break;
+        default:
+            throw GLTFException("Invalid componentType for accessor " + accessor.id);
+        }
+
+        return elements;
+    }
+
+    // Accessor min and max values are the unnormalized component values
+    void ComputeMinMax(const uint8_t* elements, size_t count, size_t byteStride, AccessorDesc& desc)
+    {
+        const size_t typeCount = Accessor::GetTypeCount(desc.accessorType);
+
+        desc.minValues.assign(typeCount, std::numeric_limits<float>::max());
+        desc.maxValues.assign(typeCount, std::numeric_limits<float>::lowest());
+
+        std::vector<float> values(typeCount);
+
+        for (size_t i = 0U; i < count; ++i)
+        {
+            ConversionUtils::ToFloat(elements + i * byteStride, desc.componentType, false, values.data(), typeCount);
+
+            for (size_t j = 0U; j < typeCount; ++j)
+            {
+                desc.minValues[j] = std::min(desc.minValues[j], values[j]);
+                desc.maxValues[j] = std::max(desc.maxValues[j], values[j]);
+            }
+        }
+    }
+
+    std::string RemapAccessor(const Document& doc, const GLTFResourceReader& reader, const std::string& accessorId,
+        const std::vector<uint32_t>& remap, size_t vertexCount, BufferBuilder& bufferBuilder)
+    {
+        const auto& accessor = doc.accessors.Get(accessorId);
+
+        if (accessor.count != remap.size())
+        {
+            throw GLTFException("The remap table size doesn't match the element count of accessor " + accessor.id);
+        }
+
+        const auto source = ReadElements(doc, reader, accessor);
+
+        // Vertex attribute elements must be 4-byte aligned so narrow elements (e.g. VEC3 of shorts) are padded
+        const size_t elementSize = accessor.GetByteLength() / accessor.count;
+        const size_t byteStride = (elementSize + 3U) & ~static_cast<size_t>(3U);
+
+        std::vector<uint8_t> destination(vertexCount * byteStride);
+        std::vector<bool> written(vertexCount, false);
+
+        for (size_t i = 0U; i < remap.size(); ++i)
+        {
+            // When several vertices are mapped to the same new index the first of them provides its values
+            if (remap[i] != MeshOptimizationUtils::RemovedVertex && !written[remap[i]])
+            {
+                std::memcpy(destination.data() + remap[i] * byteStride, source.data() + i * elementSize, elementSize);
+                written[remap[i]] = true;
+            }
+        }
+
+        AccessorDesc desc(accessor.type, accessor.componentType, accessor.normalized);
+
+        if (!accessor.min.empty() && !accessor.max.empty())
+        {
+            ComputeMinMax(destination.data(), vertexCount, byteStride, desc);
+        }
+
+        bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+        bufferBuilder.AddAccessors(destination.data(), vertexCount, byteStride == elementSize ? 0U : byteStride, &desc, 1U);
+
+        return bufferBuilder.GetCurrentAccessor().id;
+    }
+
+    // Per vertex keys, the concatenation of the vertex's (possibly quantized) attribute values, used to identify duplicates
+    struct VertexKeys
+    {
+        std::vector<uint8_t> data;
+        size_t keySize = 0U;
+        size_t vertexCount = 0U;
+    };
+
+    // Float components are snapped to a grid with the specified cell size, non-finite values are compared exactly
+    std::vector<uint8_t> QuantizeFloats(const std::vector<uint8_t>& elements, float epsilon)
+    {
+        const size_t componentCount = elements.size() / sizeof(float);
+
+        std::vector<uint8_t> cells(componentCount * sizeof(int64_t));
+
+        for (size_t i = 0U; i < componentCount; ++i)
+        {
+            float value;
+            std::memcpy(&value, elements.data() + i * sizeof(float), sizeof(float));
+
+            int64_t cell;
+
+            if (std::isfinite(value))
+            {
+                cell = static_cast<int64_t>(std::floor(static_cast<double>(value) / epsilon + 0.5));
+            }
+            else
+            {
+                uint32_t bits;
+                std::memcpy(&bits, &value, sizeof(float));
+                cell = std::numeric_limits<int64_t>::min() + bits;
+            }
+
+            std::memcpy(cells.data() + i * sizeof(int64_t), &cell, sizeof(int64_t));
+        }
+
+        return cells;
+    }
+
+    VertexKeys ReadVertexKeys(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, float epsilon)
+    {
+        std::vector<std::string> accessorIds;
+
+        for (const auto& attribute : meshPrimitive.attributes)
+        {
+            accessorIds.push_back(attribute.second);
+        }
+
+        for (const auto& target : meshPrimitive.targets)
+        {
+            for (const auto& accessorId : { target.positionsAccessorId, target.normalsAccessorId, target.tangentsAccessorId })
+            {
+                if (!accessorId.empty())
+                {
+                    accessorIds.push_back(accessorId);
+                }
+            }
+        }
+
+        VertexKeys keys;
+        keys.vertexCount = doc.accessors.Get(meshPrimitive.GetAttributeAccessorId(ACCESSOR_POSITION)).count;
+
+        if (keys.vertexCount == 0U)
+        {
+            return keys;
+        }
+
+        std::vector<std::vector<uint8_t>> streams;
+
+        for (const auto& accessorId : accessorIds)
+        {
+            const auto& accessor = doc.accessors.Get(accessorId);
+
+            if (accessor.count != keys.vertexCount)
+            {
+                throw GLTFException("The element count of accessor " + accessor.id + " doesn't match the vertex count");
+            }
+
+            auto elements = ReadElements(doc, reader, accessor);
+
+            if (epsilon > 0.0f && accessor.componentType == COMPONENT_FLOAT)
+            {
+                elements = QuantizeFloats(elements, epsilon);
+            }
+
+            keys.keySize += elements.size() / keys.vertexCount;
+            streams.push_back(std::move(elements));
+        }
+
+        // Interleave the attribute streams so that each vertex's key is contiguous
+        keys.data.resize(keys.vertexCount * keys.keySize);
+
+        size_t keyOffset = 0U;
+
+        for (const auto& stream : streams)
+        {
+            const size_t elementSize = stream.size() / keys.vertexCount;
+
+            for (size_t i = 0U; i < keys.vertexCount; ++i)
+            {
+                std::memcpy(keys.data.data() + i * keys.keySize + keyOffset, stream.data() + i * elementSize, elementSize);
+            }
+
+            keyOffset += elementSize;
+        }
+
+        return keys;
+    }
+
+    std::vector<uint32_t> GenerateRemap(const VertexKeys& keys)
+    {
+        const auto getKey = [&keys](uint32_t vertex)
+        {
+            return keys.data.data() + vertex * keys.keySize;
+        };
+
+        // FNV-1a
+        const auto hash = [&keys, &getKey](uint32_t vertex)
+        {
+            const uint8_t* key = getKey(vertex);
+            uint64_t result = 14695981039346656037ULL;
+
+            for (size_t i = 0U; i < keys.keySize; ++i)
+            {
+                result = (result ^ key[i]) * 1099511628211ULL;
+            }
+
+            return static_cast<size_t>(result);
+        };
+
+        const auto equal = [&keys, &getKey](uint32_t a, uint32_t b)
+        {
+            return std::memcmp(getKey(a), getKey(b), keys.keySize) == 0;
+        };
+
+        // Maps each unique vertex to its new index
+        std::unordered_map<uint32_t, uint32_t, decltype(hash), decltype(equal)> uniqueVertices(keys.vertexCount, hash, equal);
+
+        std::vector<uint32_t> remap(keys.vertexCount);
+
+        for (uint32_t i = 0U; i < keys.vertexCount; ++i)
+        {
+            remap[i] = uniqueVertices.emplace(i, static_cast<uint32_t>(uniqueVertices.size())).first->second;
+        }
+
+        return remap;
+    }
+
+    size_t ApplyVertexRemap(const Document& doc, const GLTFResourceReader& reader, MeshPrimitive& meshPrimitive, const std::vector<uint32_t>& remap, BufferBuilder& bufferBuilder)
+    {
+        std::vector<uint32_t> indices;
+
+        if (meshPrimitive.indicesAccessorId.empty())
+        {
+            indices.resize(remap.size());
+            std::iota(indices.begin(), indices.end(), 0U);
+        }
+        else
+        {
+            indices = MeshPrimitiveUtils::GetIndices32(doc, reader, meshPrimitive);
+        }
+
+        for (auto& index : indices)
+        {
+            if (index >= remap.size())
+            {
+                throw GLTFException("Index " + std::to_string(index) + " is out of range for " + std::to_string(remap.size()) + " vertices");
+            }
+
+            index = remap[index];
+        }
+
+        MeshOptimizationUtils::RemapVertices(doc, reader, meshPrimitive, remap, bufferBuilder);
+
+        bufferBuilder.AddBufferView(BufferViewTarget::ELEMENT_ARRAY_BUFFER);
+
+        meshPrimitive.indicesAccessorId = bufferBuilder.AddIndicesAccessor(indices).id;
+
+        return remap.empty() ? 0U : *std::max_element(remap.begin(), remap.end()) + 1U;
+    }
+}
+
+std::vector<uint32_t> MeshOptimizationUtils::OptimizeVertexCache(const std::vector<uint32_t>& indices, size_t vertexCount, size_t cacheSize)
+{
+    ValidateIndices(indices, vertexCount);
+
+    const size_t triangleCount = indices.size() / 3U;
+
+    // The number of triangles yet to be emitted that reference each vertex
+    std::vector<uint32_t> liveTriangleCounts(vertexCount, 0U);
+
+    for (auto index : indices)
+    {
+        liveTriangleCounts[index]++;
+    }
+
+    // Build the vertex to triangle adjacency as a single array, offsets[v] is the position of vertex v's first triangle
+    std::vector<size_t> offsets(vertexCount + 1U, 0U);
+    std::partial_sum(liveTriangleCounts.begin(), liveTriangleCounts.end(), offsets.begin() + 1U);
+
+    std::vector<uint32_t> adjacency(indices.size());
+
+    {
+        std::vector<size_t> cursors(offsets.begin(), offsets.end() - 1U);
+
+        for (size_t i = 0U; i < indices.size(); ++i)
+        {
+            adjacency[cursors[indices[i]]++] = static_cast<uint32_t>(i / 3U);
+        }
+    }
+
+    VertexCache cache(vertexCount, cacheSize);
+
+    std::vector<bool> isEmitted(triangleCount, false);
+    std::vector<uint32_t> deadEndStack;
+    std::vector<uint32_t> candidates;
+
+    std::vector<uint32_t> result;
+    result.reserve(indices.size());
+
+    size_t cursor = 0U;
+
+    // Returns a vertex with live triangles that was recently added to the cache or, failing that, the next vertex in input order
+    const auto skipDeadEnd = [&]()
+    {
+        while (!deadEndStack.empty())
+        {
+            const uint32_t vertex = deadEndStack.back();
+            deadEndStack.pop_back();
+
+            if (liveTriangleCounts[vertex] > 0U)
+            {
+                return static_cast<size_t>(vertex);
+            }
+        }
+
+        while (cursor < vertexCount && liveTriangleCounts[cursor] == 0U)
+        {
+            ++cursor;
+        }
+
+        return cursor;
+    };
+
+    size_t fanningVertex = skipDeadEnd();
+
+    while (fanningVertex < vertexCount)
+    {
+        candidates.clear();
+
+        // Emit all of the fanning vertex's remaining triangles
+        for (size_t i = offsets[fanningVertex]; i < offsets[fanningVertex + 1U]; ++i)
+        {
+            const uint32_t triangle = adjacency[i];
+
+            if (isEmitted[triangle])
+            {
+                continue;
+            }
+
+            for (size_t j = 0U; j < 3U; ++j)
+            {
+                const uint32_t vertex = indices[triangle * 3U + j];
+
+                result.push_back(vertex);
+                deadEndStack.push_back(vertex);
+                candidates.push_back(vertex);
+
+                liveTriangleCounts[vertex]--;
+                cache.Add(vertex);
+            }
+
+            isEmitted[triangle] = true;
+        }
+
+        // Choose the next fanning vertex - the oldest candidate that will still be in the cache after its remaining triangles
+        // are emitted (as each triangle can add at most two other vertices to the cache)
+        size_t nextVertex = vertexCount;
+        int64_t bestPriority = -1;
+
+        for (auto vertex : candidates)
+        {
+            if (liveTriangleCounts[vertex] > 0U)
+            {
+                int64_t priority = 0;
+
+                if (cache.GetAge(vertex) + 2U * liveTriangleCounts[vertex] <= cacheSize)
+                {
+                    priority = static_cast<int64_t>(cache.GetAge(vertex));
+                }
+
+                if (priority > bestPriority)
+                {
+                    bestPriority = priority;
+                    nextVertex = vertex;
+                }
+            }
+        }
+
+        fanningVertex = (nextVertex < vertexCount) ? nextVertex : skipDeadEnd();
+    }
+
+    return result;
+}
+
+std::vector<uint32_t> MeshOptimizationUtils::OptimizeOverdraw(const std::vector<uint32_t>& indices, const std::vector<float>& positions, size_t cacheSize)
+{
+    if (positions.size() % 3U != 0U)
+    {
+        throw GLTFException("The number of position components must be a multiple of 3");
+    }
+
+    const size_t vertexCount = positions.size() / 3U;
+
+    ValidateIndices(indices, vertexCount);
+
+    const size_t triangleCount = indices.size() / 3U;
+
+    // A new cluster begins at each triangle whose vertices all miss the cache, reordering clusters at these points has little
+    // effect on the vertex cache efficiency
+    std::vector<size_t> clusterOffsets;
+
+    {
+        VertexCache cache(vertexCount, cacheSize);
+
+        for (size_t i = 0U; i < triangleCount; ++i)
+        {
+            const bool miss0 = cache.Add(indices[i * 3U]);
+            const bool miss1 = cache.Add(indices[i * 3U + 1U]);
+            const bool miss2 = cache.Add(indices[i * 3U + 2U]);
+
+            if (i == 0U || (miss0 && miss1 && miss2))
+            {
+                clusterOffsets.push_back(i);
+            }
+        }
+
+        clusterOffsets.push_back(triangleCount);
+    }
+
+    const size_t clusterCount = clusterOffsets.size() - 1U;
+
+    if (clusterCount < 2U)
+    {
+        return indices;
+    }
+
+    // Each cluster's area weighted centroid and normal (the sum of its unnormalized triangle normals)
+    std::vector<Vertex> clusterCentroids(clusterCount, Vertex{ 0.0f, 0.0f, 0.0f });
+    std::vector<Vertex> clusterNormals(clusterCount, Vertex{ 0.0f, 0.0f, 0.0f });
+
+    Vertex meshCentroid = { 0.0f, 0.0f, 0.0f };
+    float meshArea = 0.0f;
+
+    for (size_t c = 0U; c < clusterCount; ++c)
+    {
+        float clusterArea = 0.0f;
+
+        for (size_t i = clusterOffsets[c]; i < clusterOffsets[c + 1U]; ++i)
+        {
+            const Vertex p0 = GetVertex(positions, indices[i * 3U]);
+            const Vertex p1 = GetVertex(positions, indices[i * 3U + 1U]);
+            const Vertex p2 = GetVertex(positions, indices[i * 3U + 2U]);
+
+            const Vertex e1 = { p1.x - p0.x, p1.y - p0.y, p1.z - p0.z };
+            const Vertex e2 = { p2.x - p0.x, p2.y - p0.y, p2.z - p0.z };
+            const Vertex n = { e1.y * e2.z - e1.z * e2.y, e1.z * e2.x - e1.x * e2.z, e1.x * e2.y - e1.y * e2.x };
+
+            const float area = std::sqrt(n.x * n.x + n.y * n.y + n.z * n.z);
+
+            clusterCentroids[c].x += area * (p0.x + p1.x + p2.x);
+            clusterCentroids[c].y += area * (p0.y + p1.y + p2.y);
+            clusterCentroids[c].z += area * (p0.z + p1.z + p2.z);
+
+            clusterNormals[c].x += n.x;
+            clusterNormals[c].y += n.y;
+            clusterNormals[c].z += n.z;
+
+            clusterArea += area;
+        }
+
+        meshCentroid.x += clusterCentroids[c].x;
+        meshCentroid.y += clusterCentroids[c].y;
+        meshCentroid.z += clusterCentroids[c].z;
+        meshArea += clusterArea;
+
+        if (clusterArea > 0.0f)
+        {
+            clusterCentroids[c].x /= 3.0f * clusterArea;
+            clusterCentroids[c].y /= 3.0f * clusterArea;
+            clusterCentroids[c].z /= 3.0f * clusterArea;
+        }
+    }
+
+    if (meshArea > 0.0f)
+    {
+        meshCentroid.x /= 3.0f * meshArea;
+        meshCentroid.y /= 3.0f * meshArea;
+        meshCentroid.z /= 3.0f * meshArea;
+    }
+
+    // Clusters that face away from the mesh centroid (i.e. outwards) and are far from it are likely to occlude other clusters
+    std::vector<float> sortKeys(clusterCount, 0.0f);
+
+    for (size_t c = 0U; c < clusterCount; ++c)
+    {
+        const Vertex& n = clusterNormals[c];
+        const float length = std::sqrt(n.x * n.x + n.y * n.y + n.z * n.z);
+
+        if (length > 0.0f)
+        {
+            sortKeys[c] = ((clusterCentroids[c].x - meshCentroid.x) * n.x
+                + (clusterCentroids[c].y - meshCentroid.y) * n.y
+                + (clusterCentroids[c].z - meshCentroid.z) * n.z) / length;
+        }
+    }
+
+    std::vector<size_t> clusterOrder(clusterCount);
+    std::iota(clusterOrder.begin(), clusterOrder.end(), size_t(0U));
+    std::stable_sort(clusterOrder.begin(), clusterOrder.end(), [&sortKeys](size_t a, size_t b) { return sortKeys[a] > sortKeys[b]; });
+
+    std::vector<uint32_t> result;
+    result.reserve(indices.size());
+
+    for (auto c : clusterOrder)
+    {
+        result.insert(result.end(), indices.begin() + clusterOffsets[c] * 3U, indices.begin() + clusterOffsets[c + 1U] * 3U);
+    }
+
+    return result;
+}
+
+std::vector<uint32_t> MeshOptimizationUtils::OptimizeVertexFetch(std::vector<uint32_t>& indices, size_t vertexCount)
+{
+    ValidateIndices(indices, vertexCount);
+
+    std::vector<uint32_t> remap(vertexCount, RemovedVertex);
+    uint32_t nextVertex = 0U;
+
+    for (auto& index : indices)
+    {
+        if (remap[index] == RemovedVertex)
+        {
+            remap[index] = nextVertex++;
+        }
+
+        index = remap[index];
+    }
+
+    return remap;
+}
+
+float MeshOptimizationUtils::ComputeACMR(const std::vector<uint32_t>& indices, size_t vertexCount, size_t cacheSize)
+{
+    ValidateIndices(indices, vertexCount);
+
+    if (indices.empty())
+    {
+        return 0.0f;
+    }
+
+    VertexCache cache(vertexCount, cacheSize);
+    size_t missCount = 0U;
+
+    for (auto index : indices)
+    {
+        if (cache.Add(index))
+        {
+            missCount++;
+        }
+    }
+
+    return static_cast<float>(missCount) / static_cast<float>(indices.size() / 3U);
+}
+
+void MeshOptimizationUtils::RemapVertices(const Document& doc, const GLTFResourceReader& reader, MeshPrimitive& meshPrimitive, const std::vector<uint32_t>& remap, BufferBuilder& bufferBuilder)
+{
+    size_t vertexCount = 0U;
+
+    for (auto index : remap)
+    {
+        if (index != RemovedVertex)
+        {
+            vertexCount = std::max<size_t>(vertexCount, index + 1U);
+        }
+    }
+
+    // Accessors that are referenced more than once (e.g. by several morph targets) are only remapped once
+    std::unordered_map<std::string, std::string> remappedAccessorIds;
+
+    const auto remapAccessor = [&](std::string& accessorId)
+    {
+        if (accessorId.empty())
+        {
+            return;
+        }
+
+        auto it = remappedAccessorIds.find(accessorId);
+
+        if (it == remappedAccessorIds.end())
+        {
+            it = remappedAccessorIds.emplace(accessorId, RemapAccessor(doc, reader, accessorId, remap, vertexCount, bufferBuilder)).first;
+        }
+
+        accessorId = it->second;
+    };
+
+    for (auto& attribute : meshPrimitive.attributes)
+    {
+        remapAccessor(attribute.second);
+    }
+
+    for (auto& target : meshPrimitive.targets)
+    {
+        remapAccessor(target.positionsAccessorId);
+        remapAccessor(target.normalsAccessorId);
+        remapAccessor(target.tangentsAccessorId);
+    }
+}
+
+void MeshOptimizationUtils::OptimizeMeshPrimitive(const Document& doc, const GLTFResourceReader& reader, MeshPrimitive& meshPrimitive, BufferBuilder& bufferBuilder, size_t cacheSize)
+{
+    const auto& positionsAccessor = doc.accessors.Get(meshPrimitive.GetAttributeAccessorId(ACCESSOR_POSITION));
+    const auto positions = MeshPrimitiveUtils::GetPositions(doc, reader, positionsAccessor);
+
+    auto indices = OptimizeVertexCache(MeshPrimitiveUtils::GetTriangulatedIndices32(doc, reader, meshPrimitive), positionsAccessor.count, cacheSize);
+    indices = OptimizeOverdraw(indices, positions, cacheSize);
+
+    const auto remap = OptimizeVertexFetch(indices, positionsAccessor.count);
+
+    RemapVertices(doc, reader, meshPrimitive, remap, bufferBuilder);
+
+    bufferBuilder.AddBufferView(BufferViewTarget::ELEMENT_ARRAY_BUFFER);
+
+    meshPrimitive.indicesAccessorId = bufferBuilder.AddIndicesAccessor(indices).id;
+    meshPrimitive.mode = MESH_TRIANGLES;
+}
+
+std::vector<uint32_t> MeshOptimizationUtils::GenerateVertexRemap(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, float epsilon)
+{
+    return GenerateRemap(ReadVertexKeys(doc, reader, meshPrimitive, epsilon));
+}
+
+size_t MeshOptimizationUtils::WeldVertices(const Document& doc, const GLTFResourceReader& reader, MeshPrimitive& meshPrimitive, BufferBuilder& bufferBuilder, float epsilon)
+{
+    return ApplyVertexRemap(doc, reader, meshPrimitive, GenerateVertexRemap(doc, reader, meshPrimitive, epsilon), bufferBuilder);
+}
+
+size_t MeshOptimizationUtils::WeldVertices(const Document& doc, const GLTFResourceReader& reader, Mesh& mesh, BufferBuilder& bufferBuilder, float epsilon)
+{
+    // Neither GLTFResourceReader nor BufferBuilder are thread-safe so only the hashing of each primitive's vertices is parallelized
+    std::vector<VertexKeys> keys;
+
+    for (const auto& meshPrimitive : mesh.primitives)
+    {
+        keys.push_back(ReadVertexKeys(doc, reader, meshPrimitive, epsilon));
+    }
+
+    std::vector<std::vector<uint32_t>> remaps(keys.size());
+
+    ParallelUtils::ParallelFor(keys.size(), 1U, [&keys, &remaps](size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; ++i)
+        {
+            remaps[i] = GenerateRemap(keys[i]);
+        }
+    });
+
+    size_t vertexCount = 0U;
+
+    for (size_t i = 0U; i < mesh.primitives.size(); ++i)
+    {
+        vertexCount += ApplyVertexRemap(doc, reader, mesh.primitives[i], remaps[i], bufferBuilder);
+    }
+
+    return vertexCount;
+}
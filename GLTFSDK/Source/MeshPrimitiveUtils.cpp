@@ -3,20 +3,21 @@
 
 #include <GLTFSDK/MeshPrimitiveUtils.h>
 
+#include <GLTFSDK/ConversionUtils.h>
 #include <GLTFSDK/GLTF.h>
 #include <GLTFSDK/GLTFResourceReader.h>
 #include <GLTFSDK/BufferBuilder.h>
+#include <GLTFSDK/ParallelUtils.h>
 
 #include <cassert>
+#include <limits>
 #include <numeric>
+#include <type_traits>
 
 using namespace Microsoft::glTF;
 
 namespace
 {
-    const float FLOAT_UINT8_MAX = std::numeric_limits<uint8_t>::max();
-    const float FLOAT_UINT16_MAX = std::numeric_limits<uint16_t>::max();
-
     uint64_t ToUint64(const uint16_t short0, const uint16_t short1, const uint16_t short2, const uint16_t short3)
     {
         return
@@ -44,434 +45,655 @@ namespace
             static_cast<uint32_t>(byte0);
     }
 
-    uint8_t ToUint8(const uint16_t value)
+    template<typename T>
+    void ValidateOutput(const Accessor& accessor, StridedSpan<T> output, size_t valuesPerElement)
     {
-        return static_cast<uint8_t>(round((value / FLOAT_UINT16_MAX) * FLOAT_UINT8_MAX));
+        if (output.count < accessor.count)
+        {
+            throw GLTFException("The output span has fewer elements than accessor " + accessor.id);
+        }
+
+        const size_t elementSize = sizeof(T) * valuesPerElement;
+
+        if (output.GetByteStride(elementSize) < elementSize)
+        {
+            throw GLTFException("The output span's byte stride is less than the output element size for accessor " + accessor.id);
+        }
     }
 
-    template<typename TIn, typename TOut>
-    std::vector<TOut> ReadIndices(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
+    // Allocates storage for the vector-returning functions, which are all implemented in terms of the StridedSpan overloads
+    template<typename T>
+    std::vector<T> CreateOutput(const Document& doc, const Accessor& accessor, size_t valuesPerElement)
     {
-        assert(sizeof(TOut) > sizeof(TIn));
+        // Ensure the accessor's count is consistent with its buffer view before allocating
+        Validation::ValidateAccessor(doc, accessor);
 
-        const auto indices = reader.ReadBinaryData<TIn>(doc, accessor);
-        return std::vector<TOut>(indices.begin(), indices.end());
+        return std::vector<T>(accessor.count * valuesPerElement);
+    }
+
+    template<typename T>
+    StridedSpan<T> MakeSpan(std::vector<T>& values, size_t valuesPerElement)
+    {
+        return StridedSpan<T>(values.data(), values.size() / valuesPerElement);
     }
 
-    std::vector<uint32_t> PackColorsRGBA(const std::vector<float>& colors)
+    // Reads the accessor a chunk at a time and converts each chunk with a ConversionUtils function, convert(components,
+    // elementCount, destination), that writes valuesPerElement contiguous values per element. Packed outputs are converted
+    // into directly while strided outputs are converted into a small scratch buffer and then scattered.
+    template<typename TIn, typename TOut, typename TConvert>
+    void ReadConvertedChunked(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, StridedSpan<TOut> output, size_t valuesPerElement, TConvert convert)
     {
-        assert(colors.size() % 4 == 0);
+        ValidateOutput(accessor, output, valuesPerElement);
 
-        std::vector<uint32_t> colors32;
-        colors32.reserve(colors.size() / 4);
+        const size_t typeCount = Accessor::GetTypeCount(accessor.type);
+        const size_t elementSize = sizeof(TOut) * valuesPerElement;
+        const bool isPacked = output.IsPacked(elementSize);
 
-        for (size_t i = 0; i < colors.size(); i += 4)
+        std::vector<TOut> scratch(isPacked ? 0U : std::min<size_t>(accessor.count, 256U) * valuesPerElement);
+
+        reader.ReadBinaryDataChunked<TIn>(doc, accessor, [&](const TIn* components, size_t first, size_t count)
         {
-            colors32.push_back(Color4(colors[i], colors[i + 1], colors[i + 2], colors[i + 3]).AsUint32RGBA());
-        }
+            if (isPacked)
+            {
+                convert(components, count, output.GetElement(first, elementSize));
+                return;
+            }
+
+            const size_t scratchElementCount = scratch.size() / valuesPerElement;
+
+            for (size_t i = 0; i < count; i += scratchElementCount)
+            {
+                const size_t scratchCount = std::min(scratchElementCount, count - i);
 
-        return colors32;
+                convert(components + i * typeCount, scratchCount, scratch.data());
+
+                for (size_t j = 0; j < scratchCount; ++j)
+                {
+                    std::copy_n(scratch.data() + j * valuesPerElement, valuesPerElement, output.GetElement(first + i + j, elementSize));
+                }
+            }
+        });
     }
 
-    std::vector<uint32_t> PackColorsRGB(const std::vector<float>& colors)
+    // Converts each component of each accessor element, writing the same number of components to each output element
+    template<typename TIn, typename TOut, typename TConvert>
+    void ReadConverted(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, StridedSpan<TOut> output, TConvert convert)
     {
-        assert(colors.size() % 3 == 0);
+        const size_t typeCount = Accessor::GetTypeCount(accessor.type);
 
-        std::vector<uint32_t> colors32;
-        colors32.reserve(colors.size() / 3);
+        ValidateOutput(accessor, output, typeCount);
 
-        for (size_t i = 0; i < colors.size(); i += 3)
+        reader.ReadBinaryDataChunked<TIn>(doc, accessor, [&](const TIn* values, size_t first, size_t count)
         {
-            colors32.push_back(Color4(colors[i], colors[i + 1], colors[i + 2], 1.0f).AsUint32RGBA());
-        }
+            for (size_t i = 0; i < count; ++i)
+            {
+                TOut* element = output.GetElement(first + i, sizeof(TOut) * typeCount);
 
-        return colors32;
+                for (size_t j = 0; j < typeCount; ++j)
+                {
+                    element[j] = convert(values[i * typeCount + j]);
+                }
+            }
+        });
     }
 
-    std::vector<uint32_t> PackColorsRGBA(const std::vector<uint8_t>& colors)
+    // Packs all the components of each accessor element into a single output value
+    template<typename TIn, typename TOut, typename TPack>
+    void ReadPacked(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, StridedSpan<TOut> output, TPack pack)
     {
-        assert(colors.size() % 4 == 0);
+        const size_t typeCount = Accessor::GetTypeCount(accessor.type);
 
-        std::vector<uint32_t> colors32;
-        colors32.reserve(colors.size() / 4);
+        ValidateOutput(accessor, output, 1U);
 
-        for (size_t i = 0; i < colors.size(); i += 4)
+        reader.ReadBinaryDataChunked<TIn>(doc, accessor, [&](const TIn* values, size_t first, size_t count)
         {
-            uint8_t r = colors[i];
-            uint8_t g = colors[i + 1];
-            uint8_t b = colors[i + 2];
-            uint8_t a = colors[i + 3];
-            uint32_t rgba = ToUint32(r, g, b, a);
-            colors32.push_back(rgba);
-        }
+            for (size_t i = 0; i < count; ++i)
+            {
+                *output.GetElement(first + i, sizeof(TOut)) = pack(values + i * typeCount);
+            }
+        });
+    }
 
-        return colors32;
+    template<typename TIn, typename TOut>
+    void ReadIndices(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, StridedSpan<TOut> output)
+    {
+        static_assert(sizeof(TOut) > sizeof(TIn), "Indices can only be widened");
+
+        ReadConverted<TIn>(doc, reader, accessor, output, [](TIn index) { return static_cast<TOut>(index); });
     }
 
-    std::vector<uint32_t> PackColorsRGB(const std::vector<uint8_t>& colors)
+    // Converts each element's three or four normalized components to 8-bit unorm values packed into a uint32_t (first
+    // component in the least significant byte), used for both RGBA colors and joint weights
+    template<typename T>
+    void ReadPackedUnorm8(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, StridedSpan<uint32_t> output)
     {
-        assert(colors.size() % 3 == 0);
+        const size_t typeCount = Accessor::GetTypeCount(accessor.type);
 
-        std::vector<uint32_t> colors32;
-        colors32.reserve(colors.size() / 3);
+        ReadConvertedChunked<T>(doc, reader, accessor, output, 1U, [&](const T* components, size_t count, uint32_t* destination)
+        {
+            ConversionUtils::ToRGBA8(components, accessor.componentType, typeCount, destination, count);
+        });
+    }
 
-        for (size_t i = 0; i < colors.size(); i += 3)
+    template<typename T>
+    void ReadColors(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, StridedSpan<uint32_t> output)
+    {
+        if (accessor.type != TYPE_VEC4 && accessor.type != TYPE_VEC3)
         {
-            uint8_t r = colors[i];
-            uint8_t g = colors[i + 1];
-            uint8_t b = colors[i + 2];
-            uint32_t rgba = ToUint32(r, g, b, 255);
-            colors32.push_back(rgba);
+            throw GLTFException("Invalid type for color accessor " + accessor.id);
         }
 
-        return colors32;
+        ReadPackedUnorm8<T>(doc, reader, accessor, output);
     }
 
-    std::vector<uint32_t> PackColorsRGBA(const std::vector<uint16_t>& colors)
+    template<typename T>
+    void ReadVertexAttribute(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, StridedSpan<float> output)
     {
-        assert(colors.size() % 4 == 0);
-
-        std::vector<uint32_t> colors32;
-        colors32.reserve(colors.size() / 4);
+        const size_t typeCount = Accessor::GetTypeCount(accessor.type);
 
-        for (size_t i = 0; i < colors.size(); i += 4)
+        ReadConvertedChunked<T>(doc, reader, accessor, output, typeCount, [&](const T* components, size_t count, float* destination)
         {
-            uint8_t r = ToUint8(colors[i]);
-            uint8_t g = ToUint8(colors[i + 1]);
-            uint8_t b = ToUint8(colors[i + 2]);
-            uint8_t a = ToUint8(colors[i + 3]);
-            uint32_t rgba = ToUint32(r, g, b, a);
-            colors32.push_back(rgba);
-        }
-
-        return colors32;
+            ConversionUtils::ToFloat(components, accessor.componentType, accessor.normalized, destination, count * typeCount);
+        });
     }
 
-    std::vector<uint32_t> PackColorsRGB(const std::vector<uint16_t>& colors)
+    // Vertex attributes may use (normalized or unnormalized) integer component types, either in the core spec (e.g. texcoords) or via KHR_mesh_quantization
+    void ReadVertexAttribute(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, StridedSpan<float> output)
     {
-        assert(colors.size() % 3 == 0);
+        switch (accessor.componentType)
+        {
+        case COMPONENT_FLOAT:
+            reader.ReadBinaryData<float>(doc, accessor, output);
+            break;
 
-        std::vector<uint32_t> colors32;
-        colors32.reserve(colors.size() / 3);
+        case COMPONENT_BYTE:
+            ReadVertexAttribute<int8_t>(doc, reader, accessor, output);
+            break;
 
-        for (size_t i = 0; i < colors.size(); i += 3)
-        {
-            uint8_t r = ToUint8(colors[i]);
-            uint8_t g = ToUint8(colors[i + 1]);
-            uint8_t b = ToUint8(colors[i + 2]);
-            uint32_t rgba = ToUint32(r, g, b, 255);
-            colors32.push_back(rgba);
+        case COMPONENT_UNSIGNED_BYTE:
+            ReadVertexAttribute<uint8_t>(doc, reader, accessor, output);
+            break;
+
+        case COMPONENT_SHORT:
+            ReadVertexAttribute<int16_t>(doc, reader, accessor, output);
+            break;
+
+        case COMPONENT_UNSIGNED_SHORT:
+            ReadVertexAttribute<uint16_t>(doc, reader, accessor, output);
+            break;
+
+        default:
+            throw GLTFException("Invalid componentType for vertex attribute accessor " + accessor.id);
         }
+    }
 
-        return colors32;
+    bool IsSignedNormalizedOrFloat(const Accessor& accessor)
+    {
+        return accessor.componentType == COMPONENT_FLOAT
+            || (accessor.normalized && (accessor.componentType == COMPONENT_BYTE || accessor.componentType == COMPONENT_SHORT));
     }
 
     template<typename T>
-    std::vector<uint32_t> ReadColors(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
+    void ReadJoints64(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, StridedSpan<uint64_t> output)
     {
-        std::vector<T> colors = reader.ReadBinaryData<T>(doc, accessor);
-
-        switch (accessor.type)
-        {
-        case TYPE_VEC4:
-            return PackColorsRGBA(colors);
+        ReadPacked<T>(doc, reader, accessor, output, [](const T* joints) { return ToUint64(joints[0], joints[1], joints[2], joints[3]); });
+    }
 
-        case TYPE_VEC3:
-            return PackColorsRGB(colors);
+    // Primitives with at least this many triangles (or line segments) are expanded in parallel
+    const size_t ParallelRangeSize = 1U << 18;
 
-        default:
-            throw GLTFException("Invalid type for color accessor " + accessor.id);
-        }
+    template<typename T>
+    void WriteIndex(T* output, size_t i, T index)
+    {
+        output[i] = index;
     }
 
-    std::vector<float> ReadTexCoords(const std::vector<float>&& texcoords)
+    template<typename T>
+    void WriteIndex(StridedSpan<T> output, size_t i, T index)
     {
-        return std::move(texcoords);
+        *output.GetElement(i, sizeof(T)) = index;
     }
 
-    std::vector<float> ReadTexCoords(const std::vector<uint8_t>&& texcoords)
+    size_t GetTriangulatedIndexCount(const MeshMode meshMode, size_t rawIndexCount)
     {
-        std::vector<float> texcoordsFloat;
-        texcoordsFloat.reserve(texcoords.size());
-        for (size_t i = 0; i < texcoords.size(); i++)
+        if (rawIndexCount < 3)
         {
-            texcoordsFloat.push_back(texcoords[i] / FLOAT_UINT8_MAX);
+            throw GLTFException("MeshPrimitive has fewer than 3 indices.");
+        }
+
+        switch (meshMode)
+        {
+        case MESH_TRIANGLES:
+            if (rawIndexCount % 3 != 0)
+            {
+                throw GLTFException("MeshPrimitives with mode MESH_TRIANGLES has non-multiple-of-3 indices.");
+            }
+            return rawIndexCount;
+        case MESH_TRIANGLE_STRIP:
+        case MESH_TRIANGLE_FAN:
+            return (rawIndexCount - 2) * 3;
+        default:
+            throw GLTFException("Invalid mesh mode for triangulation " + std::to_string(meshMode));
         }
-        return texcoordsFloat;
     }
 
-    std::vector<float> ReadTexCoords(const std::vector<uint16_t>&& texcoords)
+    // The following functions expand the primitives in the range [begin, end) and are written without any per-primitive
+    // branches so that the compiler is free to unroll and vectorize them. TOutput is either a T* (for packed output) or a
+    // StridedSpan<T>.
+
+    template<typename T, typename TOutput>
+    void CopyIndices(const T* indices, TOutput output, size_t begin, size_t end)
     {
-        std::vector<float> texcoordsFloat;
-        texcoordsFloat.reserve(texcoords.size());
-        for (size_t i = 0; i < texcoords.size(); i++)
+        for (size_t i = begin; i < end; i++)
         {
-            texcoordsFloat.push_back(texcoords[i] / FLOAT_UINT16_MAX);
+            WriteIndex(output, i, indices[i]);
         }
-        return texcoordsFloat;
     }
 
-    template<typename T>
-    std::vector<float> ReadTexCoords(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
+    // Triangles are expanded in pairs so that the winding order of each (i.e. whether it is the odd or even triangle of the
+    // strip) is known without testing i % 2. The range [begin, end) is of triangle pairs.
+    //
+    // vertexCount = 5
+    // triangleCount = 3
+    // indices:
+    //     0,1,2
+    //     1,3,2
+    //     2,3,4
+    template<typename T, typename TOutput>
+    void GetTrianglesFromTriangleStrip(const T* stripIndices, TOutput output, size_t begin, size_t end)
     {
-        std::vector<T> texcoords = reader.ReadBinaryData<T>(doc, accessor);
-        return ReadTexCoords(std::move(texcoords));
+        for (size_t pair = begin; pair < end; pair++)
+        {
+            const T* strip = stripIndices + pair * 2;
+            const size_t i = pair * 6;
+
+            WriteIndex(output, i, strip[0]);
+            WriteIndex(output, i + 1, strip[1]);
+            WriteIndex(output, i + 2, strip[2]);
+            WriteIndex(output, i + 3, strip[1]);
+            WriteIndex(output, i + 4, strip[3]);
+            WriteIndex(output, i + 5, strip[2]);
+        }
     }
 
-    std::vector<uint32_t> ReadJoints32(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
+    template<typename T, typename TOutput>
+    void GetTrianglesFromTriangleStrip(const T* stripIndices, size_t indexCount, TOutput output)
     {
-        std::vector<uint8_t> joints = reader.ReadBinaryData<uint8_t>(doc, accessor);
-        std::vector<uint32_t> joints32;
-        joints32.reserve(joints.size() / 4);
-        for (size_t i = 0; i < joints.size(); i += 4)
+        const size_t triangleCount = indexCount - 2;
+        const size_t pairCount = triangleCount / 2;
+
+        ParallelUtils::ParallelFor(pairCount, ParallelRangeSize / 2, [&](size_t begin, size_t end)
+        {
+            GetTrianglesFromTriangleStrip(stripIndices, output, begin, end);
+        });
+
+        // An odd number of triangles leaves a final (even) triangle that isn't part of a pair
+        if (triangleCount % 2 != 0)
         {
-            joints32.push_back(ToUint32(joints[i], joints[i + 1], joints[i + 2], joints[i + 3]));
+            const size_t i = triangleCount - 1;
+
+            WriteIndex(output, i * 3, stripIndices[i]);
+            WriteIndex(output, i * 3 + 1, stripIndices[i + 1]);
+            WriteIndex(output, i * 3 + 2, stripIndices[i + 2]);
         }
-        return joints32;
     }
 
-    std::vector<uint64_t> ReadJoints64(const std::vector<uint8_t>& joints)
+    // vertexCount = 5
+    // triangleCount = 3
+    // indices:
+    //     0,1,2
+    //     0,2,3
+    //     0,3,4
+    template<typename T, typename TOutput>
+    void GetTrianglesFromTriangleFan(const T* fanIndices, TOutput output, size_t begin, size_t end)
     {
-        std::vector<uint64_t> joints64;
-        joints64.reserve(joints.size() / 4);
-        for (size_t i = 0; i < joints.size(); i += 4)
+        const T first = fanIndices[0];
+
+        for (size_t i = begin; i < end; i++)
         {
-            joints64.push_back(ToUint64(joints[i], joints[i + 1], joints[i + 2], joints[i + 3]));
+            WriteIndex(output, i * 3, first);
+            WriteIndex(output, i * 3 + 1, fanIndices[i + 1]);
+            WriteIndex(output, i * 3 + 2, fanIndices[i + 2]);
         }
-        return joints64;
     }
 
-    std::vector<uint64_t> ReadJoints64(const std::vector<uint16_t>& joints)
+    template<typename T, typename TOutput>
+    void GetTriangulatedIndices(const MeshMode meshMode, const T* rawIndices, size_t rawIndexCount, TOutput output)
     {
-        std::vector<uint64_t> joints64;
-        joints64.reserve(joints.size() / 4);
-        for (size_t i = 0; i < joints.size(); i += 4)
+        switch (meshMode)
         {
-            joints64.push_back(ToUint64(joints[i], joints[i + 1], joints[i + 2], joints[i + 3]));
+        case MESH_TRIANGLES:
+            ParallelUtils::ParallelFor(rawIndexCount, ParallelRangeSize * 3, [&](size_t begin, size_t end)
+            {
+                CopyIndices(rawIndices, output, begin, end);
+            });
+            break;
+        case MESH_TRIANGLE_STRIP:
+            GetTrianglesFromTriangleStrip(rawIndices, rawIndexCount, output);
+            break;
+        case MESH_TRIANGLE_FAN:
+            ParallelUtils::ParallelFor(rawIndexCount - 2, ParallelRangeSize, [&](size_t begin, size_t end)
+            {
+                GetTrianglesFromTriangleFan(rawIndices, output, begin, end);
+            });
+            break;
+        default:
+            throw GLTFException("Invalid mesh mode for triangulation " + std::to_string(meshMode));
         }
-        return joints64;
     }
 
     template<typename T>
-    std::vector<uint64_t> ReadJoints64(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
+    void GetTriangulatedIndices(const MeshMode meshMode, const T* rawIndices, size_t rawIndexCount, StridedSpan<T> output)
     {
-        std::vector<T> joints = reader.ReadBinaryData<T>(doc, accessor);
-        return ReadJoints64(joints);
-    }
+        if (output.count < GetTriangulatedIndexCount(meshMode, rawIndexCount))
+        {
+            throw GLTFException("The output span has fewer elements than the triangulated indices");
+        }
 
-    std::vector<uint32_t> ReadWeights32(const std::vector<float>&& weights)
-    {
-        std::vector<uint32_t> weights32;
-        weights32.reserve(weights.size() / 4);
-        for (size_t i = 0; i < weights.size(); i += 4)
+        if (output.IsPacked(sizeof(T)))
         {
-            weights32.push_back(
-                ToUint32(
-                    Math::FloatToByte(weights[i]),
-                    Math::FloatToByte(weights[i + 1]),
-                    Math::FloatToByte(weights[i + 2]),
-                    Math::FloatToByte(weights[i + 3])));
+            GetTriangulatedIndices(meshMode, rawIndices, rawIndexCount, output.data);
+        }
+        else
+        {
+            GetTriangulatedIndices<T, StridedSpan<T>>(meshMode, rawIndices, rawIndexCount, output);
         }
-        return weights32;
     }
 
-    std::vector<uint32_t> ReadWeights32(const std::vector<uint8_t>&& weights)
+    template<typename T>
+    std::vector<T> GetTriangulatedIndices(const MeshMode meshMode, std::vector<T> rawIndices)
     {
-        std::vector<uint32_t> weights32;
-        weights32.reserve(weights.size() / 4);
-        for (size_t i = 0; i < weights.size(); i += 4)
+        const size_t indexCount = GetTriangulatedIndexCount(meshMode, rawIndices.size());
+
+        // Indices that are already triangulated are returned as is, rather than copied
+        if (meshMode == MESH_TRIANGLES)
         {
-            weights32.push_back(
-                ToUint32(
-                    weights[i],
-                    weights[i + 1],
-                    weights[i + 2],
-                    weights[i + 3]));
+            return rawIndices;
         }
-        return weights32;
+
+        std::vector<T> indices(indexCount);
+        GetTriangulatedIndices(meshMode, rawIndices.data(), rawIndices.size(), indices.data());
+        return indices;
     }
 
-    std::vector<uint32_t> ReadWeights32(const std::vector<uint16_t>&& weights)
+    bool HasFlag(TriangulationFlags flags, TriangulationFlags flag)
     {
-        std::vector<uint32_t> weights32;
-        weights32.reserve(weights.size() / 4);
-        for (size_t i = 0; i < weights.size(); i += 4)
-        {
-            weights32.push_back(
-                ToUint32(
-                    ToUint8(weights[i]),
-                    ToUint8(weights[i + 1]),
-                    ToUint8(weights[i + 2]),
-                    ToUint8(weights[i + 3])));
-        }
-        return weights32;
+        return ((flags & flag) == flag);
     }
 
-    template<typename T>
-    std::vector<uint32_t> ReadWeights32(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
+    bool IsZeroAreaTriangle(const float* positions, size_t vertexCount, size_t index0, size_t index1, size_t index2)
     {
-        std::vector<T> weights = reader.ReadBinaryData<T>(doc, accessor);
-        return ReadWeights32(std::move(weights));
+        if (index0 >= vertexCount || index1 >= vertexCount || index2 >= vertexCount)
+        {
+            throw GLTFException("Triangle index is out of range of the vertex positions");
+        }
+
+        const float* p0 = positions + index0 * 3;
+        const float* p1 = positions + index1 * 3;
+        const float* p2 = positions + index2 * 3;
+
+        const float e1[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+        const float e2[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+
+        // The cross product of two edges is zero only if all three positions are collinear (or coincident)
+        return (e1[1] * e2[2] - e1[2] * e2[1]) == 0.0f
+            && (e1[2] * e2[0] - e1[0] * e2[2]) == 0.0f
+            && (e1[0] * e2[1] - e1[1] * e2[0]) == 0.0f;
     }
 
+    // Unlike GetTriangulatedIndices the number of triangles written isn't known in advance so the primitives are expanded
+    // sequentially, testing each triangle as it's generated
     template<typename T>
-    std::vector<T> GetTrianglesFromTriangleStrip(const std::vector<T>& stripIndices)
+    MeshPrimitiveUtils::TriangulationResult GetTriangulatedIndices(const MeshMode meshMode, const T* rawIndices, size_t rawIndexCount,
+        TriangulationFlags flags, T restartValue, StridedSpan<T> output, const float* positions, size_t vertexCount)
     {
-        if (stripIndices.size() < 3)
+        if (output.count < GetTriangulatedIndexCount(meshMode, rawIndexCount))
         {
-            throw GLTFException("Triangle strip must contain at least 3 vertices.");
+            throw GLTFException("The output span has fewer elements than the triangulated indices");
         }
 
-        const size_t triangleCount = stripIndices.size() - 2;
+        const bool isRestartEnabled = HasFlag(flags, TriangulationFlags::PrimitiveRestart);
+        const bool isDegenerateRemoved = HasFlag(flags, TriangulationFlags::RemoveDegenerateTriangles);
+        const bool isZeroAreaRemoved = HasFlag(flags, TriangulationFlags::RemoveZeroAreaTriangles);
+
+        if (isZeroAreaRemoved && positions == nullptr)
+        {
+            throw GLTFException("Vertex positions are required to remove zero area triangles");
+        }
 
-        std::vector<T> indices;
-        indices.reserve(triangleCount * 3);
+        MeshPrimitiveUtils::TriangulationResult result = { 0U, 0U };
 
-        // vertexCount = 5
-        // triangleCount = 3
-        // indices:
-        //     0,1,2
-        //     1,3,2
-        //     2,3,4
-        for (size_t i = 0; i < triangleCount; i++)
+        const auto addTriangle = [&](T index0, T index1, T index2)
         {
-            if (i % 2 == 0)
+            if ((isDegenerateRemoved && (index0 == index1 || index1 == index2 || index2 == index0))
+                || (isZeroAreaRemoved && IsZeroAreaTriangle(positions, vertexCount, index0, index1, index2)))
             {
-                indices.push_back(stripIndices[i]);
-                indices.push_back(stripIndices[i + 1]);
-                indices.push_back(stripIndices[i + 2]);
+                result.removedTriangleCount++;
             }
             else
             {
-                indices.push_back(stripIndices[i]);
-                indices.push_back(stripIndices[i + 2]);
-                indices.push_back(stripIndices[i + 1]);
+                WriteIndex(output, result.indexCount++, index0);
+                WriteIndex(output, result.indexCount++, index1);
+                WriteIndex(output, result.indexCount++, index2);
+            }
+        };
+
+        // The index at which the current strip or fan began (i.e. following the most recent primitive restart value)
+        size_t first = 0U;
+
+        switch (meshMode)
+        {
+        case MESH_TRIANGLES:
+            // Primitive restart only applies to strips and fans
+            for (size_t i = 0; i < rawIndexCount; i += 3)
+            {
+                addTriangle(rawIndices[i], rawIndices[i + 1], rawIndices[i + 2]);
+            }
+            break;
+        case MESH_TRIANGLE_STRIP:
+            for (size_t i = 0; i < rawIndexCount; i++)
+            {
+                if (isRestartEnabled && rawIndices[i] == restartValue)
+                {
+                    first = i + 1;
+                }
+                else if (i >= first + 2)
+                {
+                    // Every odd triangle in the strip has its winding order reversed
+                    if ((i - first) % 2 == 0)
+                    {
+                        addTriangle(rawIndices[i - 2], rawIndices[i - 1], rawIndices[i]);
+                    }
+                    else
+                    {
+                        addTriangle(rawIndices[i - 2], rawIndices[i], rawIndices[i - 1]);
+                    }
+                }
+            }
+            break;
+        case MESH_TRIANGLE_FAN:
+            for (size_t i = 0; i < rawIndexCount; i++)
+            {
+                if (isRestartEnabled && rawIndices[i] == restartValue)
+                {
+                    first = i + 1;
+                }
+                else if (i >= first + 2)
+                {
+                    addTriangle(rawIndices[first], rawIndices[i - 1], rawIndices[i]);
+                }
             }
+            break;
+        default:
+            throw GLTFException("Invalid mesh mode for triangulation " + std::to_string(meshMode));
         }
 
-        return indices;
+        return result;
     }
 
     template<typename T>
-    std::vector<T> GetTrianglesFromTriangleFan(const std::vector<T>& fanIndices)
+    std::vector<T> GetTriangulatedIndices(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, std::vector<T> rawIndices,
+        TriangulationFlags flags, size_t* removedTriangleCount)
     {
-        if (fanIndices.size() < 3)
+        if (removedTriangleCount)
         {
-            throw GLTFException("Triangle fan must contain at least 3 vertices.");
+            *removedTriangleCount = 0U;
         }
 
-        const size_t triangleCount = fanIndices.size() - 2;
-
-        std::vector<T> indices;
-        indices.reserve(triangleCount * 3);
-
-        // vertexCount = 5
-        // triangleCount = 3
-        // indices:
-        //     0,1,2
-        //     0,2,3
-        //     0,3,4
-        for (size_t i = 0; i < triangleCount; i++)
+        if (flags == TriangulationFlags::None)
         {
-            indices.push_back(fanIndices[0]);
-            indices.push_back(fanIndices[i + 1]);
-            indices.push_back(fanIndices[i + 2]);
+            return GetTriangulatedIndices(meshPrimitive.mode, std::move(rawIndices));
         }
 
-        return indices;
-    }
+        // The primitive restart value is the maximum value of the indices accessor's component type, not of T
+        T restartValue = std::numeric_limits<T>::max();
 
-    template<typename T>
-    std::vector<T> GetSegmentsFromLineStrip(const std::vector<T>& stripIndices)
-    {
-        if (stripIndices.size() < 2)
+        if (doc.accessors.Has(meshPrimitive.indicesAccessorId) && doc.accessors.Get(meshPrimitive.indicesAccessorId).componentType == COMPONENT_UNSIGNED_BYTE)
         {
-            throw GLTFException("Line must contain at least 2 vertices.");
+            restartValue = std::numeric_limits<uint8_t>::max();
+        }
+        else if (doc.accessors.Has(meshPrimitive.indicesAccessorId) && doc.accessors.Get(meshPrimitive.indicesAccessorId).componentType == COMPONENT_UNSIGNED_SHORT)
+        {
+            restartValue = std::numeric_limits<uint16_t>::max();
         }
 
-        const size_t segmentCount = stripIndices.size() - 1;
-
-        std::vector<T> indices;
-        indices.reserve(segmentCount * 2);
+        std::vector<float> positions;
 
-        // vertexCount = 4
-        // segmentCount = 3
-        // indices:
-        //     0,1
-        //     1,2
-        //     2,3
-        //     3,4
-        for (size_t i = 0; i < segmentCount; i++)
+        if (HasFlag(flags, TriangulationFlags::RemoveZeroAreaTriangles))
         {
-            indices.push_back(stripIndices[i]);
-            indices.push_back(stripIndices[i + 1]);
+            positions = MeshPrimitiveUtils::GetPositions(doc, reader, meshPrimitive);
         }
 
-        return indices;
-    }
+        std::vector<T> indices(GetTriangulatedIndexCount(meshPrimitive.mode, rawIndices.size()));
 
-    template<typename T>
-    std::vector<T> GetSegmentsFromLineLoop(const std::vector<T>& stripIndices)
-    {
-        auto indices = GetSegmentsFromLineStrip(stripIndices);
+        const auto result = GetTriangulatedIndices(meshPrimitive.mode, rawIndices.data(), rawIndices.size(), flags, restartValue,
+            StridedSpan<T>(indices.data(), indices.size()), positions.data(), positions.size() / 3);
 
-        const size_t segmentCount = stripIndices.size();
-        indices.push_back(stripIndices[segmentCount - 1]);
-        indices.push_back(stripIndices[0]);
+        indices.resize(result.indexCount);
+
+        if (removedTriangleCount)
+        {
+            *removedTriangleCount = result.removedTriangleCount;
+        }
 
         return indices;
     }
 
-    template<typename T>
-    std::vector<T> GetTriangulatedIndices(const MeshMode meshMode, const std::vector<T>& rawIndices)
+    size_t GetSegmentedIndexCount(const MeshMode meshMode, size_t rawIndexCount)
     {
-        if (rawIndices.size() < 3)
+        if (rawIndexCount < 2)
         {
-            throw GLTFException("MeshPrimitive has fewer than 3 indices.");
+            throw GLTFException("MeshPrimitive has fewer than 2 indices.");
         }
 
         switch (meshMode)
         {
-        case MESH_TRIANGLES:
-            if (rawIndices.size() % 3 != 0)
+        case MESH_LINES:
+            if (rawIndexCount % 2 != 0)
             {
-                throw GLTFException("MeshPrimitives with mode MESH_TRIANGLES has non-multiple-of-3 indices.");
+                throw GLTFException("MeshPrimitives with mode MESH_LINES has non-multiple-of-2 indices.");
             }
-            return rawIndices;
-        case MESH_TRIANGLE_STRIP:
-            return GetTrianglesFromTriangleStrip(rawIndices);
-        case MESH_TRIANGLE_FAN:
-            return GetTrianglesFromTriangleFan(rawIndices);
+            return rawIndexCount;
+        case MESH_LINE_STRIP:
+            return (rawIndexCount - 1) * 2;
+        case MESH_LINE_LOOP:
+            return rawIndexCount * 2;
         default:
             throw GLTFException("Invalid mesh mode for triangulation " + std::to_string(meshMode));
         }
     }
 
-    template<typename T>
-    std::vector<T> GetSegmentedIndices(const MeshMode meshMode, const std::vector<T>& rawIndices)
+    // vertexCount = 4
+    // segmentCount = 3
+    // indices:
+    //     0,1
+    //     1,2
+    //     2,3
+    //     3,4
+    template<typename T, typename TOutput>
+    void GetSegmentsFromLineStrip(const T* stripIndices, TOutput output, size_t begin, size_t end)
     {
-        if (rawIndices.size() < 2)
+        for (size_t i = begin; i < end; i++)
         {
-            throw GLTFException("MeshPrimitive has fewer than 2 indices.");
+            WriteIndex(output, i * 2, stripIndices[i]);
+            WriteIndex(output, i * 2 + 1, stripIndices[i + 1]);
         }
+    }
 
+    template<typename T, typename TOutput>
+    void GetSegmentedIndices(const MeshMode meshMode, const T* rawIndices, size_t rawIndexCount, TOutput output)
+    {
         switch (meshMode)
         {
         case MESH_LINES:
-            if (rawIndices.size() % 2 != 0)
+            ParallelUtils::ParallelFor(rawIndexCount, ParallelRangeSize * 2, [&](size_t begin, size_t end)
             {
-                throw GLTFException("MeshPrimitives with mode MESH_LINES has non-multiple-of-2 indices.");
-            }
-            return rawIndices;
+                CopyIndices(rawIndices, output, begin, end);
+            });
+            break;
         case MESH_LINE_STRIP:
-            return GetSegmentsFromLineStrip(rawIndices);
         case MESH_LINE_LOOP:
-            return GetSegmentsFromLineLoop(rawIndices);
+            ParallelUtils::ParallelFor(rawIndexCount - 1, ParallelRangeSize, [&](size_t begin, size_t end)
+            {
+                GetSegmentsFromLineStrip(rawIndices, output, begin, end);
+            });
+
+            // A line loop is a line strip with an additional segment that joins the last index to the first
+            if (meshMode == MESH_LINE_LOOP)
+            {
+                WriteIndex(output, rawIndexCount * 2 - 2, rawIndices[rawIndexCount - 1]);
+                WriteIndex(output, rawIndexCount * 2 - 1, rawIndices[0]);
+            }
+            break;
         default:
             throw GLTFException("Invalid mesh mode for triangulation " + std::to_string(meshMode));
         }
     }
 
+    template<typename T>
+    void GetSegmentedIndices(const MeshMode meshMode, const T* rawIndices, size_t rawIndexCount, StridedSpan<T> output)
+    {
+        if (output.count < GetSegmentedIndexCount(meshMode, rawIndexCount))
+        {
+            throw GLTFException("The output span has fewer elements than the segmented indices");
+        }
+
+        if (output.IsPacked(sizeof(T)))
+        {
+            GetSegmentedIndices(meshMode, rawIndices, rawIndexCount, output.data);
+        }
+        else
+        {
+            GetSegmentedIndices<T, StridedSpan<T>>(meshMode, rawIndices, rawIndexCount, output);
+        }
+    }
+
+    template<typename T>
+    std::vector<T> GetSegmentedIndices(const MeshMode meshMode, std::vector<T> rawIndices)
+    {
+        const size_t indexCount = GetSegmentedIndexCount(meshMode, rawIndices.size());
+
+        // Indices that are already segmented are returned as is, rather than copied
+        if (meshMode == MESH_LINES)
+        {
+            return rawIndices;
+        }
+
+        std::vector<T> indices(indexCount);
+        GetSegmentedIndices(meshMode, rawIndices.data(), rawIndices.size(), indices.data());
+        return indices;
+    }
+
+    size_t GetRawIndexCount(const Document& doc, const MeshPrimitive& meshPrimitive)
+    {
+        if (doc.accessors.Has(meshPrimitive.indicesAccessorId))
+        {
+            return doc.accessors.Get(meshPrimitive.indicesAccessorId).count;
+        }
+
+        return doc.accessors.Get(meshPrimitive.GetAttributeAccessorId(ACCESSOR_POSITION)).count;
+    }
+
     std::vector<uint16_t> GetOrCreateIndices16(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive)
     {
         if (doc.accessors.Has(meshPrimitive.indicesAccessorId))
@@ -635,6 +857,19 @@ namespace
 }
 
 std::vector<uint16_t> MeshPrimitiveUtils::GetIndices16(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
+{
+    auto indices = CreateOutput<uint16_t>(doc, accessor, 1U);
+    GetIndices16(doc, reader, accessor, MakeSpan(indices, 1U));
+    return indices;
+}
+
+std::vector<uint16_t> MeshPrimitiveUtils::GetIndices16(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive)
+{
+    const auto& accessor = doc.accessors.Get(meshPrimitive.indicesAccessorId);
+    return GetIndices16(doc, reader, accessor);
+}
+
+void MeshPrimitiveUtils::GetIndices16(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, StridedSpan<uint16_t> output)
 {
     if (accessor.type != TYPE_SCALAR)
     {
@@ -644,10 +879,12 @@ std::vector<uint16_t> MeshPrimitiveUtils::GetIndices16(const Document& doc, cons
     switch (accessor.componentType)
     {
     case COMPONENT_UNSIGNED_BYTE:
-        return ReadIndices<uint8_t, uint16_t>(doc, reader, accessor);
+        ReadIndices<uint8_t>(doc, reader, accessor, output);
+        break;
 
     case COMPONENT_UNSIGNED_SHORT:
-        return reader.ReadBinaryData<uint16_t>(doc, accessor);
+        reader.ReadBinaryData<uint16_t>(doc, accessor, output);
+        break;
 
     case COMPONENT_UNSIGNED_INT:
         throw GLTFException("Cannot convert 32-bit indices to 16-bit");
@@ -657,13 +894,26 @@ std::vector<uint16_t> MeshPrimitiveUtils::GetIndices16(const Document& doc, cons
     }
 }
 
-std::vector<uint16_t> MeshPrimitiveUtils::GetIndices16(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive)
+void MeshPrimitiveUtils::GetIndices16(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, StridedSpan<uint16_t> output)
 {
     const auto& accessor = doc.accessors.Get(meshPrimitive.indicesAccessorId);
-    return GetIndices16(doc, reader, accessor);
+    GetIndices16(doc, reader, accessor, output);
 }
 
 std::vector<uint32_t> MeshPrimitiveUtils::GetIndices32(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
+{
+    auto indices = CreateOutput<uint32_t>(doc, accessor, 1U);
+    GetIndices32(doc, reader, accessor, MakeSpan(indices, 1U));
+    return indices;
+}
+
+std::vector<uint32_t> MeshPrimitiveUtils::GetIndices32(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive)
+{
+    const auto& accessor = doc.accessors.Get(meshPrimitive.indicesAccessorId);
+    return GetIndices32(doc, reader, accessor);
+}
+
+void MeshPrimitiveUtils::GetIndices32(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, StridedSpan<uint32_t> output)
 {
     if (accessor.type != TYPE_SCALAR)
     {
@@ -673,23 +923,26 @@ std::vector<uint32_t> MeshPrimitiveUtils::GetIndices32(const Document& doc, cons
     switch (accessor.componentType)
     {
     case COMPONENT_UNSIGNED_BYTE:
-        return ReadIndices<uint8_t, uint32_t>(doc, reader, accessor);
+        ReadIndices<uint8_t>(doc, reader, accessor, output);
+        break;
 
     case COMPONENT_UNSIGNED_SHORT:
-        return ReadIndices<uint16_t, uint32_t>(doc, reader, accessor);
+        ReadIndices<uint16_t>(doc, reader, accessor, output);
+        break;
 
     case COMPONENT_UNSIGNED_INT:
-        return reader.ReadBinaryData<uint32_t>(doc, accessor);
+        reader.ReadBinaryData<uint32_t>(doc, accessor, output);
+        break;
 
     default:
         throw GLTFException("Invalid componentType for indices accessor " + accessor.id);
     }
 }
 
-std::vector<uint32_t> MeshPrimitiveUtils::GetIndices32(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive)
+void MeshPrimitiveUtils::GetIndices32(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, StridedSpan<uint32_t> output)
 {
     const auto& accessor = doc.accessors.Get(meshPrimitive.indicesAccessorId);
-    return GetIndices32(doc, reader, accessor);
+    GetIndices32(doc, reader, accessor, output);
 }
 
 std::vector<uint16_t> MeshPrimitiveUtils::GetTriangulatedIndices16(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive)
@@ -702,6 +955,69 @@ std::vector<uint32_t> MeshPrimitiveUtils::GetTriangulatedIndices32(const Documen
     return GetTriangulatedIndices<uint32_t>(meshPrimitive.mode, GetOrCreateIndices32(doc, reader, meshPrimitive));
 }
 
+std::vector<uint16_t> MeshPrimitiveUtils::GetTriangulatedIndices16(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, TriangulationFlags flags, size_t* removedTriangleCount)
+{
+    return GetTriangulatedIndices<uint16_t>(doc, reader, meshPrimitive, GetOrCreateIndices16(doc, reader, meshPrimitive), flags, removedTriangleCount);
+}
+
+std::vector<uint32_t> MeshPrimitiveUtils::GetTriangulatedIndices32(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, TriangulationFlags flags, size_t* removedTriangleCount)
+{
+    return GetTriangulatedIndices<uint32_t>(doc, reader, meshPrimitive, GetOrCreateIndices32(doc, reader, meshPrimitive), flags, removedTriangleCount);
+}
+
+size_t MeshPrimitiveUtils::GetTriangulatedIndexCount(const Document& doc, const MeshPrimitive& meshPrimitive)
+{
+    return ::GetTriangulatedIndexCount(meshPrimitive.mode, GetRawIndexCount(doc, meshPrimitive));
+}
+
+void MeshPrimitiveUtils::GetTriangulatedIndices16(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, StridedSpan<uint16_t> output)
+{
+    // Indices that are already triangulated are read directly into the output span
+    if (meshPrimitive.mode == MESH_TRIANGLES && doc.accessors.Has(meshPrimitive.indicesAccessorId))
+    {
+        if (output.count < GetTriangulatedIndexCount(doc, meshPrimitive))
+        {
+            throw GLTFException("The output span has fewer elements than the triangulated indices");
+        }
+
+        GetIndices16(doc, reader, meshPrimitive, output);
+    }
+    else
+    {
+        const auto rawIndices = GetOrCreateIndices16(doc, reader, meshPrimitive);
+        GetTriangulatedIndices(meshPrimitive.mode, rawIndices.data(), rawIndices.size(), output);
+    }
+}
+
+void MeshPrimitiveUtils::GetTriangulatedIndices32(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, StridedSpan<uint32_t> output)
+{
+    // Indices that are already triangulated are read directly into the output span
+    if (meshPrimitive.mode == MESH_TRIANGLES && doc.accessors.Has(meshPrimitive.indicesAccessorId))
+    {
+        if (output.count < GetTriangulatedIndexCount(doc, meshPrimitive))
+        {
+            throw GLTFException("The output span has fewer elements than the triangulated indices");
+        }
+
+        GetIndices32(doc, reader, meshPrimitive, output);
+    }
+    else
+    {
+        const auto rawIndices = GetOrCreateIndices32(doc, reader, meshPrimitive);
+        GetTriangulatedIndices(meshPrimitive.mode, rawIndices.data(), rawIndices.size(), output);
+    }
+}
+
+void MeshPrimitiveUtils::TriangulateIndices16(const uint16_t* indices, size_t indexCount, MeshMode mode, StridedSpan<uint16_t> output)
+{
+    GetTriangulatedIndices(mode, indices, indexCount, output);
+}
+
+void MeshPrimitiveUtils::TriangulateIndices32(const uint32_t* indices, size_t indexCount, MeshMode mode, StridedSpan<uint32_t> output)
+{
+    GetTriangulatedIndices(mode, indices, indexCount, output);
+}
+
 std::vector<uint16_t> MeshPrimitiveUtils::GetSegmentedIndices16(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive)
 {
 
@@ -713,123 +1029,246 @@ std::vector<uint32_t> MeshPrimitiveUtils::GetSegmentedIndices32(const Document&
     return GetSegmentedIndices<uint32_t>(meshPrimitive.mode, GetOrCreateIndices32(doc, reader, meshPrimitive));
 }
 
+size_t MeshPrimitiveUtils::GetSegmentedIndexCount(const Document& doc, const MeshPrimitive& meshPrimitive)
+{
+    return ::GetSegmentedIndexCount(meshPrimitive.mode, GetRawIndexCount(doc, meshPrimitive));
+}
+
+void MeshPrimitiveUtils::GetSegmentedIndices16(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, StridedSpan<uint16_t> output)
+{
+    const auto rawIndices = GetOrCreateIndices16(doc, reader, meshPrimitive);
+    GetSegmentedIndices(meshPrimitive.mode, rawIndices.data(), rawIndices.size(), output);
+}
+
+void MeshPrimitiveUtils::GetSegmentedIndices32(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, StridedSpan<uint32_t> output)
+{
+    const auto rawIndices = GetOrCreateIndices32(doc, reader, meshPrimitive);
+    GetSegmentedIndices(meshPrimitive.mode, rawIndices.data(), rawIndices.size(), output);
+}
+
+MeshPrimitiveUtils::TriangulationResult MeshPrimitiveUtils::TriangulateIndices16(const uint16_t* indices, size_t indexCount, MeshMode mode, TriangulationFlags flags, StridedSpan<uint16_t> output,
+    const float* positions, size_t vertexCount)
+{
+    return GetTriangulatedIndices(mode, indices, indexCount, flags, std::numeric_limits<uint16_t>::max(), output, positions, vertexCount);
+}
+
+MeshPrimitiveUtils::TriangulationResult MeshPrimitiveUtils::TriangulateIndices32(const uint32_t* indices, size_t indexCount, MeshMode mode, TriangulationFlags flags, StridedSpan<uint32_t> output,
+    const float* positions, size_t vertexCount)
+{
+    return GetTriangulatedIndices(mode, indices, indexCount, flags, std::numeric_limits<uint32_t>::max(), output, positions, vertexCount);
+}
+
+void MeshPrimitiveUtils::SegmentIndices16(const uint16_t* indices, size_t indexCount, MeshMode mode, StridedSpan<uint16_t> output)
+{
+    GetSegmentedIndices(mode, indices, indexCount, output);
+}
+
+void MeshPrimitiveUtils::SegmentIndices32(const uint32_t* indices, size_t indexCount, MeshMode mode, StridedSpan<uint32_t> output)
+{
+    GetSegmentedIndices(mode, indices, indexCount, output);
+}
+
+bool MeshPrimitiveUtils::NarrowIndices(const Document& doc, const GLTFResourceReader& reader, MeshPrimitive& meshPrimitive, BufferBuilder& bufferBuilder)
+{
+    if (meshPrimitive.indicesAccessorId.empty())
+    {
+        return false;
+    }
+
+    const auto& accessor = doc.accessors.Get(meshPrimitive.indicesAccessorId);
+
+    if (accessor.componentType == COMPONENT_UNSIGNED_BYTE)
+    {
+        return false;
+    }
+
+    const auto indices = GetIndices32(doc, reader, accessor);
+    const auto componentType = BufferBuilder::GetIndicesComponentType(indices.data(), indices.size());
+
+    // The maximum value of each component type is reserved for primitive restart, so e.g. uint16 indices that include
+    // 65535 map to uint32 - only ever replace the accessor with a strictly narrower one
+    if (Accessor::GetComponentTypeSize(componentType) >= Accessor::GetComponentTypeSize(accessor.componentType))
+    {
+        return false;
+    }
+
+    meshPrimitive.indicesAccessorId = bufferBuilder.AddIndicesAccessor(indices.data(), indices.size(), componentType).id;
+
+    return true;
+}
+
 // Positions
 std::vector<float> MeshPrimitiveUtils::GetPositions(const Document& doc, const GLTFResourceReader& reader, const Accessor& positionsAccessor)
+{
+    auto positions = CreateOutput<float>(doc, positionsAccessor, 3U);
+    GetPositions(doc, reader, positionsAccessor, MakeSpan(positions, 3U));
+    return positions;
+}
+
+std::vector<float> MeshPrimitiveUtils::GetPositions(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive)
+{
+    const auto& positionsAccessor = doc.accessors.Get(meshPrimitive.GetAttributeAccessorId(ACCESSOR_POSITION));
+    return GetPositions(doc, reader, positionsAccessor);
+}
+
+std::vector<float> MeshPrimitiveUtils::GetPositions(const Document& doc, const GLTFResourceReader& reader, const MorphTarget& morphTarget)
+{
+    const auto& positionsAccessor = doc.accessors.Get(morphTarget.positionsAccessorId);
+    return GetPositions(doc, reader, positionsAccessor);
+}
+
+void MeshPrimitiveUtils::GetPositions(const Document& doc, const GLTFResourceReader& reader, const Accessor& positionsAccessor, StridedSpan<float> output)
 {
     if (positionsAccessor.type != TYPE_VEC3)
     {
         throw GLTFException("Invalid type for positions accessor " + positionsAccessor.id);
     }
 
-    if (positionsAccessor.componentType != COMPONENT_FLOAT)
+    if (positionsAccessor.componentType == COMPONENT_UNSIGNED_INT)
     {
         throw GLTFException("Invalid component type for positions accessor " + positionsAccessor.id);
     }
 
-    return reader.ReadBinaryData<float>(doc, positionsAccessor);
+    ReadVertexAttribute(doc, reader, positionsAccessor, output);
 }
 
-std::vector<float> MeshPrimitiveUtils::GetPositions(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive)
+void MeshPrimitiveUtils::GetPositions(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, StridedSpan<float> output)
 {
     const auto& positionsAccessor = doc.accessors.Get(meshPrimitive.GetAttributeAccessorId(ACCESSOR_POSITION));
-    return GetPositions(doc, reader, positionsAccessor);
+    GetPositions(doc, reader, positionsAccessor, output);
 }
 
-std::vector<float> MeshPrimitiveUtils::GetPositions(const Document& doc, const GLTFResourceReader& reader, const MorphTarget& morphTarget)
+void MeshPrimitiveUtils::GetPositions(const Document& doc, const GLTFResourceReader& reader, const MorphTarget& morphTarget, StridedSpan<float> output)
 {
     const auto& positionsAccessor = doc.accessors.Get(morphTarget.positionsAccessorId);
-    return GetPositions(doc, reader, positionsAccessor);
+    GetPositions(doc, reader, positionsAccessor, output);
 }
 
 // Normals
 std::vector<float> MeshPrimitiveUtils::GetNormals(const Document& doc, const GLTFResourceReader& reader, const Accessor& normalsAccessor)
+{
+    auto normals = CreateOutput<float>(doc, normalsAccessor, 3U);
+    GetNormals(doc, reader, normalsAccessor, MakeSpan(normals, 3U));
+    return normals;
+}
+
+std::vector<float> MeshPrimitiveUtils::GetNormals(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive)
+{
+    const auto& accessor = doc.accessors.Get(meshPrimitive.GetAttributeAccessorId(ACCESSOR_NORMAL));
+    return GetNormals(doc, reader, accessor);
+}
+
+std::vector<float> MeshPrimitiveUtils::GetNormals(const Document& doc, const GLTFResourceReader& reader, const MorphTarget& morphTarget)
+{
+    const auto& accessor = doc.accessors.Get(morphTarget.normalsAccessorId);
+    return GetNormals(doc, reader, accessor);
+}
+
+void MeshPrimitiveUtils::GetNormals(const Document& doc, const GLTFResourceReader& reader, const Accessor& normalsAccessor, StridedSpan<float> output)
 {
     if (normalsAccessor.type != TYPE_VEC3)
     {
         throw GLTFException("Invalid type for normals accessor " + normalsAccessor.id);
     }
 
-    if (normalsAccessor.componentType != COMPONENT_FLOAT)
+    if (!IsSignedNormalizedOrFloat(normalsAccessor))
     {
         throw GLTFException("Invalid component type for normals accessor " + normalsAccessor.id);
     }
 
-    return reader.ReadBinaryData<float>(doc, normalsAccessor);
+    ReadVertexAttribute(doc, reader, normalsAccessor, output);
 }
 
-std::vector<float> MeshPrimitiveUtils::GetNormals(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive)
+void MeshPrimitiveUtils::GetNormals(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, StridedSpan<float> output)
 {
     const auto& accessor = doc.accessors.Get(meshPrimitive.GetAttributeAccessorId(ACCESSOR_NORMAL));
-    return GetNormals(doc, reader, accessor);
+    GetNormals(doc, reader, accessor, output);
 }
 
-std::vector<float> MeshPrimitiveUtils::GetNormals(const Document& doc, const GLTFResourceReader& reader, const MorphTarget& morphTarget)
+void MeshPrimitiveUtils::GetNormals(const Document& doc, const GLTFResourceReader& reader, const MorphTarget& morphTarget, StridedSpan<float> output)
 {
     const auto& accessor = doc.accessors.Get(morphTarget.normalsAccessorId);
-    return GetNormals(doc, reader, accessor);
+    GetNormals(doc, reader, accessor, output);
 }
 
 // Tangents
 std::vector<float> MeshPrimitiveUtils::GetTangents(const Document& doc, const GLTFResourceReader& reader, const Accessor& tangentsAccessor)
+{
+    auto tangents = CreateOutput<float>(doc, tangentsAccessor, 4U);
+    GetTangents(doc, reader, tangentsAccessor, MakeSpan(tangents, 4U));
+    return tangents;
+}
+
+std::vector<float> MeshPrimitiveUtils::GetTangents(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive)
+{
+    const auto& accessor = doc.accessors.Get(meshPrimitive.GetAttributeAccessorId(ACCESSOR_TANGENT));
+    return GetTangents(doc, reader, accessor);
+}
+
+void MeshPrimitiveUtils::GetTangents(const Document& doc, const GLTFResourceReader& reader, const Accessor& tangentsAccessor, StridedSpan<float> output)
 {
     if (tangentsAccessor.type != TYPE_VEC4)
     {
         throw GLTFException("Invalid type for tangents accessor " + tangentsAccessor.id);
     }
 
-    if (tangentsAccessor.componentType != COMPONENT_FLOAT)
+    if (!IsSignedNormalizedOrFloat(tangentsAccessor))
     {
         throw GLTFException("Invalid component type for tangents accessor " + tangentsAccessor.id);
     }
 
-    return reader.ReadBinaryData<float>(doc, tangentsAccessor);
+    ReadVertexAttribute(doc, reader, tangentsAccessor, output);
 }
 
-std::vector<float> MeshPrimitiveUtils::GetTangents(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive)
+void MeshPrimitiveUtils::GetTangents(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, StridedSpan<float> output)
 {
     const auto& accessor = doc.accessors.Get(meshPrimitive.GetAttributeAccessorId(ACCESSOR_TANGENT));
-    return GetTangents(doc, reader, accessor);
+    GetTangents(doc, reader, accessor, output);
 }
 
 // Morph Target Tangents (which have a different accessor type than base mesh tangents)
 std::vector<float> MeshPrimitiveUtils::GetMorphTangents(const Document& doc, const GLTFResourceReader& reader, const Accessor& tangentsAccessor)
+{
+    auto tangents = CreateOutput<float>(doc, tangentsAccessor, 3U);
+    GetMorphTangents(doc, reader, tangentsAccessor, MakeSpan(tangents, 3U));
+    return tangents;
+}
+
+std::vector<float> MeshPrimitiveUtils::GetTangents(const Document& doc, const GLTFResourceReader& reader, const MorphTarget& morphTarget)
+{
+    const auto& accessor = doc.accessors.Get(morphTarget.tangentsAccessorId);
+    return GetMorphTangents(doc, reader, accessor);
+}
+
+void MeshPrimitiveUtils::GetMorphTangents(const Document& doc, const GLTFResourceReader& reader, const Accessor& tangentsAccessor, StridedSpan<float> output)
 {
     if (tangentsAccessor.type != TYPE_VEC3)
     {
         throw GLTFException("Invalid type for tangents accessor " + tangentsAccessor.id);
     }
 
-    if (tangentsAccessor.componentType != COMPONENT_FLOAT)
+    if (!IsSignedNormalizedOrFloat(tangentsAccessor))
     {
         throw GLTFException("Invalid component type for tangents accessor " + tangentsAccessor.id);
     }
 
-    return reader.ReadBinaryData<float>(doc, tangentsAccessor);
+    ReadVertexAttribute(doc, reader, tangentsAccessor, output);
 }
 
-std::vector<float> MeshPrimitiveUtils::GetTangents(const Document& doc, const GLTFResourceReader& reader, const MorphTarget& morphTarget)
+void MeshPrimitiveUtils::GetTangents(const Document& doc, const GLTFResourceReader& reader, const MorphTarget& morphTarget, StridedSpan<float> output)
 {
     const auto& accessor = doc.accessors.Get(morphTarget.tangentsAccessorId);
-    return GetMorphTangents(doc, reader, accessor);
+    GetMorphTangents(doc, reader, accessor, output);
 }
 
 // Texcoords
 std::vector<float> MeshPrimitiveUtils::GetTexCoords(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
 {
-    switch (accessor.componentType)
-    {
-    case COMPONENT_FLOAT:
-        return ReadTexCoords<float>(doc, reader, accessor);
-
-    case COMPONENT_UNSIGNED_BYTE:
-        return ReadTexCoords<uint8_t>(doc, reader, accessor);
+    const size_t typeCount = Accessor::GetTypeCount(accessor.type);
 
-    case COMPONENT_UNSIGNED_SHORT:
-        return ReadTexCoords<uint16_t>(doc, reader, accessor);
-
-    default:
-        throw GLTFException("Invalid componentType for texcoords accessor " + accessor.id);
-    }
+    auto texCoords = CreateOutput<float>(doc, accessor, typeCount);
+    GetTexCoords(doc, reader, accessor, MakeSpan(texCoords, typeCount));
+    return texCoords;
 }
 
 std::vector<float> MeshPrimitiveUtils::GetTexCoords_0(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive)
@@ -844,33 +1283,84 @@ std::vector<float> MeshPrimitiveUtils::GetTexCoords_1(const Document& doc, const
     return GetTexCoords(doc, reader, accessor);
 }
 
+void MeshPrimitiveUtils::GetTexCoords(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, StridedSpan<float> output)
+{
+    if (accessor.componentType == COMPONENT_UNSIGNED_INT)
+    {
+        throw GLTFException("Invalid componentType for texcoords accessor " + accessor.id);
+    }
+
+    ReadVertexAttribute(doc, reader, accessor, output);
+}
+
+void MeshPrimitiveUtils::GetTexCoords_0(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, StridedSpan<float> output)
+{
+    const auto& accessor = doc.accessors.Get(meshPrimitive.GetAttributeAccessorId(ACCESSOR_TEXCOORD_0));
+    GetTexCoords(doc, reader, accessor, output);
+}
+
+void MeshPrimitiveUtils::GetTexCoords_1(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, StridedSpan<float> output)
+{
+    const auto& accessor = doc.accessors.Get(meshPrimitive.GetAttributeAccessorId(ACCESSOR_TEXCOORD_1));
+    GetTexCoords(doc, reader, accessor, output);
+}
+
 // Colors
 std::vector<uint32_t> MeshPrimitiveUtils::GetColors(const Document& doc, const GLTFResourceReader& reader, const Accessor& colorsAccessor)
+{
+    auto colors = CreateOutput<uint32_t>(doc, colorsAccessor, 1U);
+    GetColors(doc, reader, colorsAccessor, MakeSpan(colors, 1U));
+    return colors;
+}
+
+std::vector<uint32_t> MeshPrimitiveUtils::GetColors_0(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive)
+{
+    const auto& accessor = doc.accessors.Get(meshPrimitive.GetAttributeAccessorId(ACCESSOR_COLOR_0));
+    return GetColors(doc, reader, accessor);
+}
+
+void MeshPrimitiveUtils::GetColors(const Document& doc, const GLTFResourceReader& reader, const Accessor& colorsAccessor, StridedSpan<uint32_t> output)
 {
     switch (colorsAccessor.componentType)
     {
     case COMPONENT_FLOAT:
-        return ReadColors<float>(doc, reader, colorsAccessor);
+        ReadColors<float>(doc, reader, colorsAccessor, output);
+        break;
 
     case COMPONENT_UNSIGNED_BYTE:
-        return ReadColors<uint8_t>(doc, reader, colorsAccessor);
+        ReadColors<uint8_t>(doc, reader, colorsAccessor, output);
+        break;
 
     case COMPONENT_UNSIGNED_SHORT:
-        return ReadColors<uint16_t>(doc, reader, colorsAccessor);
+        ReadColors<uint16_t>(doc, reader, colorsAccessor, output);
+        break;
 
     default:
         throw GLTFException("Invalid componentType for color accessor " + colorsAccessor.id);
     }
 }
 
-std::vector<uint32_t> MeshPrimitiveUtils::GetColors_0(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive)
+void MeshPrimitiveUtils::GetColors_0(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, StridedSpan<uint32_t> output)
 {
     const auto& accessor = doc.accessors.Get(meshPrimitive.GetAttributeAccessorId(ACCESSOR_COLOR_0));
-    return GetColors(doc, reader, accessor);
+    GetColors(doc, reader, accessor, output);
 }
 
 // Joints
 std::vector<uint32_t> MeshPrimitiveUtils::GetJointIndices32(const Document& doc, const GLTFResourceReader& reader, const Accessor& jointsAccessor)
+{
+    auto joints = CreateOutput<uint32_t>(doc, jointsAccessor, 1U);
+    GetJointIndices32(doc, reader, jointsAccessor, MakeSpan(joints, 1U));
+    return joints;
+}
+
+std::vector<uint32_t> MeshPrimitiveUtils::GetJointIndices32_0(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive)
+{
+    const auto& accessor = doc.accessors.Get(meshPrimitive.GetAttributeAccessorId(ACCESSOR_JOINTS_0));
+    return GetJointIndices32(doc, reader, accessor);
+}
+
+void MeshPrimitiveUtils::GetJointIndices32(const Document& doc, const GLTFResourceReader& reader, const Accessor& jointsAccessor, StridedSpan<uint32_t> output)
 {
     if (jointsAccessor.type != TYPE_VEC4)
     {
@@ -880,7 +1370,8 @@ std::vector<uint32_t> MeshPrimitiveUtils::GetJointIndices32(const Document& doc,
     switch (jointsAccessor.componentType)
     {
     case COMPONENT_UNSIGNED_BYTE:
-        return ReadJoints32(doc, reader, jointsAccessor);
+        ReadPacked<uint8_t>(doc, reader, jointsAccessor, output, [](const uint8_t* joints) { return ToUint32(joints[0], joints[1], joints[2], joints[3]); });
+        break;
 
     case COMPONENT_UNSIGNED_SHORT:
         throw GLTFException("Cannot pack 4 x 16-bit indices into 32-bits");
@@ -890,13 +1381,26 @@ std::vector<uint32_t> MeshPrimitiveUtils::GetJointIndices32(const Document& doc,
     }
 }
 
-std::vector<uint32_t> MeshPrimitiveUtils::GetJointIndices32_0(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive)
+void MeshPrimitiveUtils::GetJointIndices32_0(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, StridedSpan<uint32_t> output)
 {
     const auto& accessor = doc.accessors.Get(meshPrimitive.GetAttributeAccessorId(ACCESSOR_JOINTS_0));
-    return GetJointIndices32(doc, reader, accessor);
+    GetJointIndices32(doc, reader, accessor, output);
 }
 
 std::vector<uint64_t> MeshPrimitiveUtils::GetJointIndices64(const Document& doc, const GLTFResourceReader& reader, const Accessor& jointsAccessor)
+{
+    auto joints = CreateOutput<uint64_t>(doc, jointsAccessor, 1U);
+    GetJointIndices64(doc, reader, jointsAccessor, MakeSpan(joints, 1U));
+    return joints;
+}
+
+std::vector<uint64_t> MeshPrimitiveUtils::GetJointIndices64_0(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive)
+{
+    const auto& accessor = doc.accessors.Get(meshPrimitive.GetAttributeAccessorId(ACCESSOR_JOINTS_0));
+    return GetJointIndices64(doc, reader, accessor);
+}
+
+void MeshPrimitiveUtils::GetJointIndices64(const Document& doc, const GLTFResourceReader& reader, const Accessor& jointsAccessor, StridedSpan<uint64_t> output)
 {
     if (jointsAccessor.type != TYPE_VEC4)
     {
@@ -906,24 +1410,39 @@ std::vector<uint64_t> MeshPrimitiveUtils::GetJointIndices64(const Document& doc,
     switch (jointsAccessor.componentType)
     {
     case COMPONENT_UNSIGNED_BYTE:
-        return ReadJoints64<uint8_t>(doc, reader, jointsAccessor);
+        ReadJoints64<uint8_t>(doc, reader, jointsAccessor, output);
+        break;
 
     case COMPONENT_UNSIGNED_SHORT:
-        return ReadJoints64<uint16_t>(doc, reader, jointsAccessor);
+        ReadJoints64<uint16_t>(doc, reader, jointsAccessor, output);
+        break;
 
     default:
         throw GLTFException("Invalid componentType for joints accessor " + jointsAccessor.id);
     }
 }
 
-std::vector<uint64_t> MeshPrimitiveUtils::GetJointIndices64_0(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive)
+void MeshPrimitiveUtils::GetJointIndices64_0(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, StridedSpan<uint64_t> output)
 {
     const auto& accessor = doc.accessors.Get(meshPrimitive.GetAttributeAccessorId(ACCESSOR_JOINTS_0));
-    return GetJointIndices64(doc, reader, accessor);
+    GetJointIndices64(doc, reader, accessor, output);
 }
 
 // Weights
 std::vector<uint32_t> MeshPrimitiveUtils::GetJointWeights32(const Document& doc, const GLTFResourceReader& reader, const Accessor& weightsAccessor)
+{
+    auto weights = CreateOutput<uint32_t>(doc, weightsAccessor, 1U);
+    GetJointWeights32(doc, reader, weightsAccessor, MakeSpan(weights, 1U));
+    return weights;
+}
+
+std::vector<uint32_t> MeshPrimitiveUtils::GetJointWeights32_0(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive)
+{
+    const auto& accessor = doc.accessors.Get(meshPrimitive.GetAttributeAccessorId(ACCESSOR_WEIGHTS_0));
+    return GetJointWeights32(doc, reader, accessor);
+}
+
+void MeshPrimitiveUtils::GetJointWeights32(const Document& doc, const GLTFResourceReader& reader, const Accessor& weightsAccessor, StridedSpan<uint32_t> output)
 {
     if (weightsAccessor.type != TYPE_VEC4)
     {
@@ -933,23 +1452,26 @@ std::vector<uint32_t> MeshPrimitiveUtils::GetJointWeights32(const Document& doc,
     switch (weightsAccessor.componentType)
     {
     case COMPONENT_FLOAT:
-        return ReadWeights32<float>(doc, reader, weightsAccessor);
+        ReadPackedUnorm8<float>(doc, reader, weightsAccessor, output);
+        break;
 
     case COMPONENT_UNSIGNED_BYTE:
-        return ReadWeights32<uint8_t>(doc, reader, weightsAccessor);
+        ReadPackedUnorm8<uint8_t>(doc, reader, weightsAccessor, output);
+        break;
 
     case COMPONENT_UNSIGNED_SHORT:
-        return ReadWeights32<uint16_t>(doc, reader, weightsAccessor);
+        ReadPackedUnorm8<uint16_t>(doc, reader, weightsAccessor, output);
+        break;
 
     default:
         throw GLTFException("Invalid componentType for weights accessor " + weightsAccessor.id);
     }
 }
 
-std::vector<uint32_t> MeshPrimitiveUtils::GetJointWeights32_0(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive)
+void MeshPrimitiveUtils::GetJointWeights32_0(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, StridedSpan<uint32_t> output)
 {
     const auto& accessor = doc.accessors.Get(meshPrimitive.GetAttributeAccessorId(ACCESSOR_WEIGHTS_0));
-    return GetJointWeights32(doc, reader, accessor);
+    GetJointWeights32(doc, reader, accessor, output);
 }
 
 std::vector<uint16_t> MeshPrimitiveUtils::ReverseTriangulateIndices16(const uint16_t* indices, size_t indexCount, MeshMode mode)
@@ -991,3 +1513,33 @@ std::vector<uint32_t> MeshPrimitiveUtils::ReverseSegmentIndices32(const std::vec
 {
     return ReverseSegmentIndices(indices.data(), indices.size(), mode);
 }
+
+TriangulationFlags Microsoft::glTF::operator|(TriangulationFlags lhs, TriangulationFlags rhs)
+{
+    const auto result =
+        static_cast<std::underlying_type_t<TriangulationFlags>>(lhs) |
+        static_cast<std::underlying_type_t<TriangulationFlags>>(rhs);
+
+    return static_cast<TriangulationFlags>(result);
+}
+
+TriangulationFlags& Microsoft::glTF::operator|=(TriangulationFlags& lhs, TriangulationFlags rhs)
+{
+    lhs = lhs | rhs;
+    return lhs;
+}
+
+TriangulationFlags Microsoft::glTF::operator&(TriangulationFlags lhs, TriangulationFlags rhs)
+{
+    const auto result =
+        static_cast<std::underlying_type_t<TriangulationFlags>>(lhs) &
+        static_cast<std::underlying_type_t<TriangulationFlags>>(rhs);
+
+    return static_cast<TriangulationFlags>(result);
+}
+
+TriangulationFlags& Microsoft::glTF::operator&=(TriangulationFlags& lhs, TriangulationFlags rhs)
+{
+    lhs = lhs & rhs;
+    return lhs;
+}
@@ -0,0 +1,708 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/MeshSimplificationUtils.h>
+
+#include <GLTFSDK/BufferBuilder.h>
+#include <GLTFSDK/Document.h>
+#include <GLTFSDK/ExtensionsMSFT.h>
+#include <GLTFSDK/GLTFResourceReader.h>
+#include <GLTFSDK/MeshPrimitiveUtils.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <numeric>
+#include <unordered_set>
+
+using namespace Microsoft::glTF;
+
+namespace
+{
+    // Border edges are constrained by a plane perpendicular to the adjacent triangle, weighted so that the border's shape is
+    // preserved in preference to the surface's
+    constexpr double BorderWeight = 10.0;
+
+    enum class VertexKind
+    {
+        Manifold, // Collapsible to any neighbor
+        Border,   // Only collapsible along a border edge to another border (or locked) vertex
+        Seam,     // Only collapsible along a seam edge to another seam (or locked) vertex
+        Locked    // Not collapsible
+    };
+
+    struct Vector
+    {
+        double x;
+        double y;
+        double z;
+    };
+
+    Vector operator-(const Vector& lhs, const Vector& rhs)
+    {
+        return { lhs.x - rhs.x, lhs.y - rhs.y, lhs.z - rhs.z };
+    }
+
+    Vector Cross(const Vector& lhs, const Vector& rhs)
+    {
+        return { lhs.y * rhs.z - lhs.z * rhs.y, lhs.z * rhs.x - lhs.x * rhs.z, lhs.x * rhs.y - lhs.y * rhs.x };
+    }
+
+    double Dot(const Vector& lhs, const Vector& rhs)
+    {
+        return lhs.x * rhs.x + lhs.y * rhs.y + lhs.z * rhs.z;
+    }
+
+    double Length(const Vector& v)
+    {
+        return std::sqrt(Dot(v, v));
+    }
+
+    // The symmetric matrix A, vector b and scalar c of the quadric form v'Av + 2b'v + c - the sum of squared distances to a
+    // set of weighted planes - along with the total weight of the planes
+    struct Quadric
+    {
+        double a00, a11, a22, a10, a20, a21;
+        double b0, b1, b2;
+        double c;
+        double weight;
+
+        void AddPlane(const Vector& n, double d, double w)
+        {
+            a00 += w * n.x * n.x;
+            a11 += w * n.y * n.y;
+            a22 += w * n.z * n.z;
+            a10 += w * n.y * n.x;
+            a20 += w * n.z * n.x;
+            a21 += w * n.z * n.y;
+            b0 += w * n.x * d;
+            b1 += w * n.y * d;
+            b2 += w * n.z * d;
+            c += w * d * d;
+            weight += w;
+        }
+
+        Quadric& operator+=(const Quadric& rhs)
+        {
+            a00 += rhs.a00; a11 += rhs.a11; a22 += rhs.a22;
+            a10 += rhs.a10; a20 += rhs.a20; a21 += rhs.a21;
+            b0 += rhs.b0; b1 += rhs.b1; b2 += rhs.b2;
+            c += rhs.c;
+            weight += rhs.weight;
+
+            return *this;
+        }
+
+        // Returns the weighted mean squared distance of the point from the planes
+        double GetError(const Vector& v) const
+        {
+            const double error = v.x * v.x * a00 + v.y * v.y * a11 + v.z * v.z * a22
+                + 2.0 * (v.x * v.y * a10 + v.x * v.z * a20 + v.y * v.z * a21)
+                + 2.0 * (v.x * b0 + v.y * b1 + v.z * b2)
+                + c;
+
+            return weight > 0.0 ? std::abs(error) / weight : 0.0;
+        }
+    };
+
+    struct Collapse
+    {
+        uint32_t vertex;
+        uint32_t target;
+        double error;
+    };
+
+    uint64_t GetEdgeKey(uint32_t a, uint32_t b)
+    {
+        return (static_cast<uint64_t>(a) << 32) | b;
+    }
+
+    // The set of directed edges of all triangles, optionally after remapping the vertices
+    std::unordered_set<uint64_t> GetEdges(const std::vector<uint32_t>& indices, const std::vector<uint32_t>* remap)
+    {
+        std::unordered_set<uint64_t> edges(indices.size());
+
+        const auto getVertex = [remap](uint32_t index)
+        {
+            return remap ? (*remap)[index] : index;
+        };
+
+        for (size_t i = 0U; i < indices.size(); i += 3U)
+        {
+            for (size_t j = 0U; j < 3U; ++j)
+            {
+                edges.insert(GetEdgeKey(getVertex(indices[i + j]), getVertex(indices[i + (j + 1U) % 3U])));
+            }
+        }
+
+        return edges;
+    }
+
+    // Identifies the referenced vertices with identical positions. Each vertex is mapped to the first such vertex (its
+    // canonical vertex) and the vertices with the same position (its "wedges") are linked in a cycle.
+    void BuildWedges(const std::vector<uint32_t>& indices, const std::vector<Vector>& positions, std::vector<uint32_t>& canonical, std::vector<uint32_t>& wedges)
+    {
+        canonical.resize(positions.size());
+        wedges.resize(positions.size());
+
+        std::iota(canonical.begin(), canonical.end(), 0U);
+        std::iota(wedges.begin(), wedges.end(), 0U);
+
+        std::vector<bool> isReferenced(positions.size(), false);
+
+        for (auto index : indices)
+        {
+            isReferenced[index] = true;
+        }
+
+        std::vector<uint32_t> order;
+
+        for (uint32_t i = 0U; i < positions.size(); ++i)
+        {
+            if (isReferenced[i])
+            {
+                order.push_back(i);
+            }
+        }
+
+        const auto less = [&positions](uint32_t a, uint32_t b)
+        {
+            const Vector& pa = positions[a];
+            const Vector& pb = positions[b];
+
+            return pa.x != pb.x ? pa.x < pb.x : (pa.y != pb.y ? pa.y < pb.y : pa.z < pb.z);
+        };
+
+        // A stable sort ensures the canonical vertex is the lowest numbered
+        std::stable_sort(order.begin(), order.end(), less);
+
+        for (size_t begin = 0U, end = 0U; begin < order.size(); begin = end)
+        {
+            end = begin + 1U;
+
+            while (end < order.size() && !less(order[begin], order[end]))
+            {
+                ++end;
+            }
+
+            for (size_t i = begin; i < end; ++i)
+            {
+                canonical[order[i]] = order[begin];
+                wedges[order[i]] = order[(i + 1U < end) ? i + 1U : begin];
+            }
+        }
+    }
+
+    std::vector<VertexKind> ClassifyVertices(const std::vector<uint32_t>& indices, const std::vector<uint32_t>& canonical, const std::vector<uint32_t>& wedges)
+    {
+        const auto edges = GetEdges(indices, nullptr);
+        const auto canonicalEdges = GetEdges(indices, &canonical);
+
+        // The number of open (i.e. unpaired) half-edges at each canonical vertex
+        std::vector<uint32_t> borderEdgeCounts(canonical.size(), 0U);
+        std::vector<uint32_t> seamEdgeCounts(canonical.size(), 0U);
+
+        for (size_t i = 0U; i < indices.size(); i += 3U)
+        {
+            for (size_t j = 0U; j < 3U; ++j)
+            {
+                const uint32_t a = indices[i + j];
+                const uint32_t b = indices[i + (j + 1U) % 3U];
+
+                if (canonicalEdges.count(GetEdgeKey(canonical[b], canonical[a])) == 0U)
+                {
+                    borderEdgeCounts[canonical[a]]++;
+                    borderEdgeCounts[canonical[b]]++;
+                }
+                else if (edges.count(GetEdgeKey(b, a)) == 0U)
+                {
+                    seamEdgeCounts[canonical[a]]++;
+                    seamEdgeCounts[canonical[b]]++;
+                }
+            }
+        }
+
+        std::vector<VertexKind> kinds(canonical.size(), VertexKind::Locked);
+
+        for (uint32_t v = 0U; v < canonical.size(); ++v)
+        {
+            if (canonical[v] != v)
+            {
+                continue;
+            }
+
+            size_t wedgeCount = 1U;
+
+            for (uint32_t w = wedges[v]; w != v; w = wedges[w])
+            {
+                wedgeCount++;
+            }
+
+            // A simple border or seam passes through the vertex, entering and leaving once (on each side of a seam)
+            if (wedgeCount == 1U && borderEdgeCounts[v] == 0U)
+            {
+                kinds[v] = VertexKind::Manifold;
+            }
+            else if (wedgeCount == 1U && borderEdgeCounts[v] == 2U)
+            {
+                kinds[v] = VertexKind::Border;
+            }
+            else if (wedgeCount == 2U && borderEdgeCounts[v] == 0U && seamEdgeCounts[v] == 4U)
+            {
+                kinds[v] = VertexKind::Seam;
+            }
+        }
+
+        return kinds;
+    }
+}
+
+std::vector<uint32_t> MeshSimplificationUtils::SimplifyIndices(const std::vector<uint32_t>& indices, const std::vector<float>& positions, size_t targetIndexCount,
+    float targetError, float* resultError)
+{
+    if (indices.size() % 3U != 0U)
+    {
+        throw GLTFException("The number of triangle list indices must be a multiple of 3");
+    }
+
+    if (positions.size() % 3U != 0U)
+    {
+        throw GLTFException("The number of position components must be a multiple of 3");
+    }
+
+    const size_t vertexCount = positions.size() / 3U;
+
+    for (auto index : indices)
+    {
+        if (index >= vertexCount)
+        {
+            throw GLTFException("Index " + std::to_string(index) + " is out of range for " + std::to_string(vertexCount) + " vertices");
+        }
+    }
+
+    if (resultError)
+    {
+        *resultError = 0.0f;
+    }
+
+    if (indices.size() <= targetIndexCount)
+    {
+        return indices;
+    }
+
+    // Positions are scaled to fit a unit cube so that errors are relative to the mesh's size
+    Vector min = { positions[0], positions[1], positions[2] };
+    Vector max = min;
+
+    for (size_t i = 0U; i < positions.size(); i += 3U)
+    {
+        min = { std::min<double>(min.x, positions[i]), std::min<double>(min.y, positions[i + 1U]), std::min<double>(min.z, positions[i + 2U]) };
+        max = { std::max<double>(max.x, positions[i]), std::max<double>(max.y, positions[i + 1U]), std::max<double>(max.z, positions[i + 2U]) };
+    }
+
+    const double extent = std::max({ max.x - min.x, max.y - min.y, max.z - min.z });
+    const double scale = extent > 0.0 ? 1.0 / extent : 0.0;
+
+    std::vector<Vector> vertices(vertexCount);
+
+    for (size_t i = 0U; i < vertexCount; ++i)
+    {
+        vertices[i] = { (positions[i * 3U] - min.x) * scale, (positions[i * 3U + 1U] - min.y) * scale, (positions[i * 3U + 2U] - min.z) * scale };
+    }
+
+    std::vector<uint32_t> canonical;
+    std::vector<uint32_t> wedges;
+
+    BuildWedges(indices, vertices, canonical, wedges);
+
+    const auto kinds = ClassifyVertices(indices, canonical, wedges);
+
+    // Each canonical vertex's quadric is the sum of its (area weighted) triangle planes and any border planes
+    std::vector<Quadric> quadrics(vertexCount, Quadric{});
+
+    {
+        const auto canonicalEdges = GetEdges(indices, &canonical);
+
+        for (size_t i = 0U; i < indices.size(); i += 3U)
+        {
+            const Vector& p0 = vertices[indices[i]];
+            const Vector n = Cross(vertices[indices[i + 1U]] - p0, vertices[indices[i + 2U]] - p0);
+            const double length = Length(n);
+
+            if (length == 0.0)
+            {
+                continue;
+            }
+
+            const Vector unitNormal = { n.x / length, n.y / length, n.z / length };
+
+            for (size_t j = 0U; j < 3U; ++j)
+            {
+                quadrics[canonical[indices[i + j]]].AddPlane(unitNormal, -Dot(unitNormal, p0), length * 0.5);
+            }
+
+            for (size_t j = 0U; j < 3U; ++j)
+            {
+                const uint32_t a = canonical[indices[i + j]];
+                const uint32_t b = canonical[indices[i + (j + 1U) % 3U]];
+
+                if (canonicalEdges.count(GetEdgeKey(b, a)) == 0U)
+                {
+                    const Vector edge = vertices[b] - vertices[a];
+                    const Vector borderNormal = Cross(edge, unitNormal);
+                    const double borderLength = Length(borderNormal);
+
+                    if (borderLength > 0.0)
+                    {
+                        const Vector unitBorderNormal = { borderNormal.x / borderLength, borderNormal.y / borderLength, borderNormal.z / borderLength };
+                        const double d = -Dot(unitBorderNormal, vertices[a]);
+
+                        quadrics[a].AddPlane(unitBorderNormal, d, Dot(edge, edge) * BorderWeight);
+                        quadrics[b].AddPlane(unitBorderNormal, d, Dot(edge, edge) * BorderWeight);
+                    }
+                }
+            }
+        }
+    }
+
+    const double maxError = static_cast<double>(targetError) * targetError;
+    double error = 0.0;
+
+    std::vector<uint32_t> result = indices;
+    std::vector<uint32_t> remap(vertexCount);
+    std::iota(remap.begin(), remap.end(), 0U);
+
+    std::vector<Collapse> collapses;
+    std::vector<bool> isLocked(vertexCount);
+    std::vector<std::pair<uint32_t, uint32_t>> wedgeTargets;
+
+    // Each pass collapses a set of edges that don't share vertices, in order of increasing error
+    while (result.size() > targetIndexCount)
+    {
+        const auto edges = GetEdges(result, nullptr);
+        const auto canonicalEdges = GetEdges(result, &canonical);
+
+        const auto hasEdge = [&canonicalEdges](uint32_t a, uint32_t b)
+        {
+            return canonicalEdges.count(GetEdgeKey(a, b)) != 0U;
+        };
+
+        // Returns the wedge of the target adjacent to the wedge w (or the target if there isn't one)
+        const auto findWedgeTarget = [&edges, &wedges](uint32_t w, uint32_t target)
+        {
+            uint32_t t = target;
+
+            do
+            {
+                if (edges.count(GetEdgeKey(w, t)) != 0U || edges.count(GetEdgeKey(t, w)) != 0U)
+                {
+                    return t;
+                }
+
+                t = wedges[t];
+            } while (t != target);
+
+            return target;
+        };
+
+        const auto isSeamEdge = [&](uint32_t vertex, uint32_t target)
+        {
+            if (!hasEdge(vertex, target) || !hasEdge(target, vertex))
+            {
+                return false;
+            }
+
+            uint32_t w = vertex;
+
+            do
+            {
+                const uint32_t t = findWedgeTarget(w, target);
+
+                if (edges.count(GetEdgeKey(w, t)) != edges.count(GetEdgeKey(t, w)))
+                {
+                    return true;
+                }
+
+                w = wedges[w];
+            } while (w != vertex);
+
+            return false;
+        };
+
+        const auto canCollapse = [&](uint32_t vertex, uint32_t target)
+        {
+            switch (kinds[vertex])
+            {
+            case VertexKind::Manifold:
+                return true;
+            case VertexKind::Border:
+                return (kinds[target] == VertexKind::Border || kinds[target] == VertexKind::Locked) && hasEdge(vertex, target) != hasEdge(target, vertex);
+            case VertexKind::Seam:
+                return (kinds[target] == VertexKind::Seam || kinds[target] == VertexKind::Locked) && isSeamEdge(vertex, target);
+            default:
+                return false;
+            }
+        };
+
+        collapses.clear();
+
+        for (size_t i = 0U; i < result.size(); i += 3U)
+        {
+            for (size_t j = 0U; j < 3U; ++j)
+            {
+                const uint32_t a = canonical[result[i + j]];
+                const uint32_t b = canonical[result[i + (j + 1U) % 3U]];
+
+                for (const auto& collapse : { std::make_pair(a, b), std::make_pair(b, a) })
+                {
+                    if (canCollapse(collapse.first, collapse.second))
+                    {
+                        Quadric quadric = quadrics[collapse.first];
+                        quadric += quadrics[collapse.second];
+
+                        collapses.push_back({ collapse.first, collapse.second, quadric.GetError(vertices[collapse.second]) });
+                    }
+                }
+            }
+        }
+
+        std::sort(collapses.begin(), collapses.end(), [](const Collapse& lhs, const Collapse& rhs) { return lhs.error < rhs.error; });
+
+        // The triangles adjacent to each canonical vertex
+        std::vector<size_t> offsets(vertexCount + 1U, 0U);
+
+        for (auto index : result)
+        {
+            offsets[canonical[index] + 1U]++;
+        }
+
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+        std::vector<uint32_t> adjacency(result.size());
+
+        {
+            std::vector<size_t> cursors(offsets.begin(), offsets.end() - 1U);
+
+            for (size_t i = 0U; i < result.size(); ++i)
+            {
+                adjacency[cursors[canonical[result[i]]]++] = static_cast<uint32_t>(i / 3U);
+            }
+        }
+
+        // Returns true if moving the vertex to the target's position would flip (or collapse) a triangle that isn't removed
+        const auto hasFlip = [&](uint32_t vertex, uint32_t target)
+        {
+            for (size_t i = offsets[vertex]; i < offsets[vertex + 1U]; ++i)
+            {
+                const size_t triangle = adjacency[i] * 3U;
+
+                uint32_t corners[3] = { canonical[result[triangle]], canonical[result[triangle + 1U]], canonical[result[triangle + 2U]] };
+
+                if (std::find(std::begin(corners), std::end(corners), target) != std::end(corners))
+                {
+                    continue;
+                }
+
+                const Vector before = Cross(vertices[corners[1]] - vertices[corners[0]], vertices[corners[2]] - vertices[corners[0]]);
+
+                std::replace(std::begin(corners), std::end(corners), vertex, target);
+
+                const Vector after = Cross(vertices[corners[1]] - vertices[corners[0]], vertices[corners[2]] - vertices[corners[0]]);
+
+                if (Dot(before, after) <= 0.0)
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        };
+
+        // Interior edge collapses remove two triangles and border edge collapses one
+        const size_t triangleCollapseGoal = (result.size() - targetIndexCount) / 3U;
+        size_t triangleCollapseCount = 0U;
+
+        std::fill(isLocked.begin(), isLocked.end(), false);
+
+        for (const auto& collapse : collapses)
+        {
+            if (collapse.error > maxError || triangleCollapseCount >= triangleCollapseGoal)
+            {
+                break;
+            }
+
+            if (isLocked[collapse.vertex] || isLocked[collapse.target] || hasFlip(collapse.vertex, collapse.target))
+            {
+                continue;
+            }
+
+            // Each of the vertex's wedges must collapse onto an adjacent wedge of the target so that seams are preserved
+            wedgeTargets.clear();
+
+            uint32_t w = collapse.vertex;
+            bool isValid = true;
+
+            do
+            {
+                const uint32_t t = findWedgeTarget(w, collapse.target);
+
+                if (edges.count(GetEdgeKey(w, t)) == 0U && edges.count(GetEdgeKey(t, w)) == 0U)
+                {
+                    isValid = false;
+                    break;
+                }
+
+                wedgeTargets.emplace_back(w, t);
+                w = wedges[w];
+            } while (w != collapse.vertex);
+
+            if (!isValid)
+            {
+                continue;
+            }
+
+            for (const auto& wedgeTarget : wedgeTargets)
+            {
+                remap[wedgeTarget.first] = wedgeTarget.second;
+            }
+
+            quadrics[collapse.target] += quadrics[collapse.vertex];
+
+            // The flip test for any later collapse in this pass must only see unchanged triangles, so the vertices of every
+            // triangle adjacent to the collapsed vertex are locked
+            for (size_t i = offsets[collapse.vertex]; i < offsets[collapse.vertex + 1U]; ++i)
+            {
+                const size_t triangle = adjacency[i] * 3U;
+
+                isLocked[canonical[result[triangle]]] = true;
+                isLocked[canonical[result[triangle + 1U]]] = true;
+                isLocked[canonical[result[triangle + 2U]]] = true;
+            }
+
+            error = std::max(error, collapse.error);
+            triangleCollapseCount += (kinds[collapse.vertex] == VertexKind::Border) ? 1U : 2U;
+        }
+
+        if (triangleCollapseCount == 0U)
+        {
+            break;
+        }
+
+        // Apply the collapses, removing the triangles that have become degenerate
+        size_t writeIndex = 0U;
+
+        for (size_t i = 0U; i < result.size(); i += 3U)
+        {
+            const uint32_t a = remap[result[i]];
+            const uint32_t b = remap[result[i + 1U]];
+            const uint32_t c = remap[result[i + 2U]];
+
+            if (canonical[a] != canonical[b] && canonical[b] != canonical[c] && canonical[c] != canonical[a])
+            {
+                result[writeIndex++] = a;
+                result[writeIndex++] = b;
+                result[writeIndex++] = c;
+            }
+        }
+
+        result.resize(writeIndex);
+
+        std::iota(remap.begin(), remap.end(), 0U);
+    }
+
+    if (resultError)
+    {
+        *resultError = static_cast<float>(std::sqrt(error));
+    }
+
+    return result;
+}
+
+std::vector<uint32_t> MeshSimplificationUtils::SimplifyMeshPrimitive(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, float ratio,
+    float targetError, float* resultError)
+{
+    if (!(ratio > 0.0f && ratio <= 1.0f))
+    {
+        throw GLTFException("The simplification ratio must be greater than 0 and no greater than 1");
+    }
+
+    const auto indices = MeshPrimitiveUtils::GetTriangulatedIndices32(doc, reader, meshPrimitive);
+    const auto positions = MeshPrimitiveUtils::GetPositions(doc, reader, meshPrimitive);
+
+    const size_t targetIndexCount = static_cast<size_t>(static_cast<double>(indices.size() / 3U) * ratio) * 3U;
+
+    return SimplifyIndices(indices, positions, targetIndexCount, targetError, resultError);
+}
+
+std::vector<std::string> MeshSimplificationUtils::AddNodeLods(Document& doc, const GLTFResourceReader& reader, const std::string& nodeId, const std::vector<float>& ratios,
+    BufferBuilder& bufferBuilder, float targetError)
+{
+    Node node = doc.nodes.Get(nodeId);
+
+    if (node.meshId.empty())
+    {
+        throw GLTFException("Node " + nodeId + " has no mesh to simplify");
+    }
+
+    const Mesh mesh = doc.meshes.Get(node.meshId);
+
+    std::vector<float> sortedRatios = ratios;
+    std::sort(sortedRatios.begin(), sortedRatios.end(), std::greater<float>());
+
+    MSFT::Lod lod;
+
+    for (size_t i = 0U; i < sortedRatios.size(); ++i)
+    {
+        const std::string suffix = "_lod" + std::to_string(i + 1U);
+
+        Mesh lodMesh = mesh;
+
+        lodMesh.id.clear();
+        lodMesh.name = mesh.name.empty() ? std::string() : mesh.name + suffix;
+        lodMesh.primitives.clear();
+
+        // Only the vertex data is copied from the original primitives, any extensions (e.g. compression) won't be valid
+        // for the simplified indices
+        for (const auto& meshPrimitive : mesh.primitives)
+        {
+            MeshPrimitive lodPrimitive;
+
+            lodPrimitive.attributes = meshPrimitive.attributes;
+            lodPrimitive.targets = meshPrimitive.targets;
+            lodPrimitive.materialId = meshPrimitive.materialId;
+            lodPrimitive.mode = MESH_TRIANGLES;
+
+            const auto indices = SimplifyMeshPrimitive(doc, reader, meshPrimitive, sortedRatios[i], targetError);
+
+            bufferBuilder.AddBufferView(BufferViewTarget::ELEMENT_ARRAY_BUFFER);
+            lodPrimitive.indicesAccessorId = bufferBuilder.AddIndicesAccessor(indices).id;
+
+            lodMesh.primitives.push_back(std::move(lodPrimitive));
+        }
+
+        Node lodNode;
+
+        lodNode.name = node.name.empty() ? std::string() : node.name + suffix;
+        lodNode.meshId = doc.meshes.Append(std::move(lodMesh), AppendIdPolicy::GenerateOnEmpty).id;
+        lodNode.skinId = node.skinId;
+        lodNode.matrix = node.matrix;
+        lodNode.rotation = node.rotation;
+        lodNode.scale = node.scale;
+        lodNode.translation = node.translation;
+        lodNode.weights = node.weights;
+
+        lod.ids.push_back(doc.nodes.Append(std::move(lodNode), AppendIdPolicy::GenerateOnEmpty).id);
+    }
+
+    if (node.HasExtension<MSFT::Lod>())
+    {
+        node.RemoveExtension<MSFT::Lod>();
+    }
+
+    node.SetExtension<MSFT::Lod>(lod);
+    doc.nodes.Replace(node);
+
+    doc.extensionsUsed.insert(MSFT::LOD_NAME);
+
+    return lod.ids;
+}
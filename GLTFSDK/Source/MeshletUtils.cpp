@@ -0,0 +1,308 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/MeshletUtils.h>
+
+#include <GLTFSDK/BufferBuilder.h>
+#include <GLTFSDK/GLTFResourceReader.h>
+#include <GLTFSDK/MeshPrimitiveUtils.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+using namespace Microsoft::glTF;
+
+namespace
+{
+    constexpr uint32_t UnassignedVertex = std::numeric_limits<uint32_t>::max();
+
+    struct Vertex
+    {
+        float x;
+        float y;
+        float z;
+    };
+
+    Vertex GetVertex(const std::vector<float>& positions, uint32_t index)
+    {
+        return { positions[index * 3U], positions[index * 3U + 1U], positions[index * 3U + 2U] };
+    }
+
+    MeshletUtils::MeshletBounds ComputeBounds(const MeshletUtils::MeshletData& meshletData, const MeshletUtils::Meshlet& meshlet, const std::vector<float>& positions)
+    {
+        MeshletUtils::MeshletBounds bounds = {};
+
+        // The bounding sphere is centered on the meshlet's axis aligned bounding box
+        Vertex min = { std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max() };
+        Vertex max = { std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest() };
+
+        for (size_t i = 0U; i < meshlet.vertexCount; ++i)
+        {
+            const Vertex v = GetVertex(positions, meshletData.vertices[meshlet.vertexOffset + i]);
+
+            min = { std::min(min.x, v.x), std::min(min.y, v.y), std::min(min.z, v.z) };
+            max = { std::max(max.x, v.x), std::max(max.y, v.y), std::max(max.z, v.z) };
+        }
+
+        const Vertex center = { (min.x + max.x) * 0.5f, (min.y + max.y) * 0.5f, (min.z + max.z) * 0.5f };
+
+        float radiusSquared = 0.0f;
+
+        for (size_t i = 0U; i < meshlet.vertexCount; ++i)
+        {
+            const Vertex v = GetVertex(positions, meshletData.vertices[meshlet.vertexOffset + i]);
+            const Vertex d = { v.x - center.x, v.y - center.y, v.z - center.z };
+
+            radiusSquared = std::max(radiusSquared, d.x * d.x + d.y * d.y + d.z * d.z);
+        }
+
+        bounds.center[0] = center.x;
+        bounds.center[1] = center.y;
+        bounds.center[2] = center.z;
+        bounds.radius = std::sqrt(radiusSquared);
+
+        // The normal cone's axis is the average of the (normalized) triangle normals, zero area triangles are ignored
+        std::vector<Vertex> normals;
+        Vertex axis = { 0.0f, 0.0f, 0.0f };
+
+        for (size_t i = 0U; i < meshlet.triangleCount; ++i)
+        {
+            const uint8_t* triangle = meshletData.triangles.data() + (meshlet.triangleOffset + i) * 3U;
+
+            const Vertex p0 = GetVertex(positions, meshletData.vertices[meshlet.vertexOffset + triangle[0]]);
+            const Vertex p1 = GetVertex(positions, meshletData.vertices[meshlet.vertexOffset + triangle[1]]);
+            const Vertex p2 = GetVertex(positions, meshletData.vertices[meshlet.vertexOffset + triangle[2]]);
+
+            const Vertex e1 = { p1.x - p0.x, p1.y - p0.y, p1.z - p0.z };
+            const Vertex e2 = { p2.x - p0.x, p2.y - p0.y, p2.z - p0.z };
+            const Vertex n = { e1.y * e2.z - e1.z * e2.y, e1.z * e2.x - e1.x * e2.z, e1.x * e2.y - e1.y * e2.x };
+
+            const float length = std::sqrt(n.x * n.x + n.y * n.y + n.z * n.z);
+
+            if (length > 0.0f)
+            {
+                normals.push_back({ n.x / length, n.y / length, n.z / length });
+
+                axis.x += normals.back().x;
+                axis.y += normals.back().y;
+                axis.z += normals.back().z;
+            }
+        }
+
+        const float axisLength = std::sqrt(axis.x * axis.x + axis.y * axis.y + axis.z * axis.z);
+
+        bounds.coneCutoff = -1.0f;
+
+        if (axisLength > 0.0f)
+        {
+            axis = { axis.x / axisLength, axis.y / axisLength, axis.z / axisLength };
+
+            float minDot = 1.0f;
+
+            for (const auto& n : normals)
+            {
+                minDot = std::min(minDot, n.x * axis.x + n.y * axis.y + n.z * axis.z);
+            }
+
+            bounds.coneAxis[0] = axis.x;
+            bounds.coneAxis[1] = axis.y;
+            bounds.coneAxis[2] = axis.z;
+
+            if (minDot > 0.0f)
+            {
+                bounds.coneCutoff = minDot;
+            }
+        }
+
+        return bounds;
+    }
+
+    template<typename T>
+    std::vector<T> ReadMeshletAccessor(const Document& doc, const GLTFResourceReader& reader, const std::string& accessorId, AccessorType accessorType, ComponentType componentType)
+    {
+        const auto& accessor = doc.accessors.Get(accessorId);
+
+        if (accessor.type != accessorType || accessor.componentType != componentType)
+        {
+            throw GLTFException("Accessor " + accessor.id + " has an invalid type for " + MSFT::MeshPrimitives::MESHLETS_NAME);
+        }
+
+        return reader.ReadBinaryData<T>(doc, accessor);
+    }
+}
+
+MeshletUtils::MeshletData MeshletUtils::BuildMeshlets(const std::vector<uint32_t>& indices, const std::vector<float>& positions, size_t maxVertices, size_t maxTriangles)
+{
+    if (maxVertices < 3U || maxVertices > MaxVertexLimit)
+    {
+        throw GLTFException("The maximum meshlet vertex count must be between 3 and " + std::to_string(MaxVertexLimit));
+    }
+
+    if (maxTriangles < 1U || maxTriangles > MaxTriangleLimit)
+    {
+        throw GLTFException("The maximum meshlet triangle count must be between 1 and " + std::to_string(MaxTriangleLimit));
+    }
+
+    if (indices.size() % 3U != 0U)
+    {
+        throw GLTFException("The number of triangle list indices must be a multiple of 3");
+    }
+
+    if (positions.size() % 3U != 0U)
+    {
+        throw GLTFException("The number of position components must be a multiple of 3");
+    }
+
+    const size_t vertexCount = positions.size() / 3U;
+
+    for (auto index : indices)
+    {
+        if (index >= vertexCount)
+        {
+            throw GLTFException("Index " + std::to_string(index) + " is out of range for " + std::to_string(vertexCount) + " vertices");
+        }
+    }
+
+    MeshletData meshletData;
+
+    // The index of each vertex within the current meshlet
+    std::vector<uint32_t> localIndices(vertexCount, UnassignedVertex);
+
+    Meshlet meshlet = {};
+
+    const auto finishMeshlet = [&]()
+    {
+        for (size_t i = 0U; i < meshlet.vertexCount; ++i)
+        {
+            localIndices[meshletData.vertices[meshlet.vertexOffset + i]] = UnassignedVertex;
+        }
+
+        meshletData.bounds.push_back(ComputeBounds(meshletData, meshlet, positions));
+        meshletData.meshlets.push_back(meshlet);
+
+        meshlet = { static_cast<uint32_t>(meshletData.vertices.size()), 0U, static_cast<uint32_t>(meshletData.triangles.size() / 3U), 0U };
+    };
+
+    // Triangles are added to the current meshlet, in order, until either limit would be exceeded
+    for (size_t i = 0U; i < indices.size(); i += 3U)
+    {
+        const uint32_t a = indices[i];
+        const uint32_t b = indices[i + 1U];
+        const uint32_t c = indices[i + 2U];
+
+        const size_t newVertexCount = (localIndices[a] == UnassignedVertex ? 1U : 0U)
+            + (localIndices[b] == UnassignedVertex && b != a ? 1U : 0U)
+            + (localIndices[c] == UnassignedVertex && c != a && c != b ? 1U : 0U);
+
+        if (meshlet.vertexCount + newVertexCount > maxVertices || meshlet.triangleCount == maxTriangles)
+        {
+            finishMeshlet();
+        }
+
+        for (auto vertex : { a, b, c })
+        {
+            if (localIndices[vertex] == UnassignedVertex)
+            {
+                localIndices[vertex] = meshlet.vertexCount++;
+                meshletData.vertices.push_back(vertex);
+            }
+
+            meshletData.triangles.push_back(static_cast<uint8_t>(localIndices[vertex]));
+        }
+
+        meshlet.triangleCount++;
+    }
+
+    if (meshlet.triangleCount > 0U)
+    {
+        finishMeshlet();
+    }
+
+    return meshletData;
+}
+
+MeshletUtils::MeshletData MeshletUtils::BuildMeshlets(const Document& doc, const GLTFResourceReader& reader, const MeshPrimitive& meshPrimitive, size_t maxVertices, size_t maxTriangles)
+{
+    return BuildMeshlets(
+        MeshPrimitiveUtils::GetTriangulatedIndices32(doc, reader, meshPrimitive),
+        MeshPrimitiveUtils::GetPositions(doc, reader, meshPrimitive),
+        maxVertices,
+        maxTriangles);
+}
+
+MSFT::MeshPrimitives::Meshlets MeshletUtils::AddMeshlets(const MeshletData& meshletData, size_t maxVertices, size_t maxTriangles, BufferBuilder& bufferBuilder)
+{
+    static_assert(sizeof(Meshlet) == 4U * sizeof(uint32_t), "Meshlet must be tightly packed");
+    static_assert(sizeof(MeshletBounds) == 8U * sizeof(float), "MeshletBounds must be tightly packed");
+
+    MSFT::MeshPrimitives::Meshlets meshlets;
+
+    meshlets.maxVertices = maxVertices;
+    meshlets.maxTriangles = maxTriangles;
+
+    bufferBuilder.AddBufferView(BufferViewTarget::UNKNOWN_BUFFER);
+    meshlets.meshletsAccessorId = bufferBuilder.AddAccessor(meshletData.meshlets.data(), meshletData.meshlets.size(), { TYPE_VEC4, COMPONENT_UNSIGNED_INT }).id;
+
+    bufferBuilder.AddBufferView(BufferViewTarget::UNKNOWN_BUFFER);
+    meshlets.verticesAccessorId = bufferBuilder.AddAccessor(meshletData.vertices, { TYPE_SCALAR, COMPONENT_UNSIGNED_INT }).id;
+
+    bufferBuilder.AddBufferView(BufferViewTarget::UNKNOWN_BUFFER);
+    meshlets.trianglesAccessorId = bufferBuilder.AddAccessor(meshletData.triangles, { TYPE_SCALAR, COMPONENT_UNSIGNED_BYTE }).id;
+
+    bufferBuilder.AddBufferView(BufferViewTarget::UNKNOWN_BUFFER);
+    meshlets.boundsAccessorId = bufferBuilder.AddAccessor(meshletData.bounds.data(), meshletData.bounds.size() * 2U, { TYPE_VEC4, COMPONENT_FLOAT }).id;
+
+    return meshlets;
+}
+
+void MeshletUtils::AddMeshlets(const Document& doc, const GLTFResourceReader& reader, MeshPrimitive& meshPrimitive, BufferBuilder& bufferBuilder, size_t maxVertices, size_t maxTriangles)
+{
+    const auto meshletData = BuildMeshlets(doc, reader, meshPrimitive, maxVertices, maxTriangles);
+
+    if (meshPrimitive.HasExtension<MSFT::MeshPrimitives::Meshlets>())
+    {
+        meshPrimitive.RemoveExtension<MSFT::MeshPrimitives::Meshlets>();
+    }
+
+    meshPrimitive.SetExtension<MSFT::MeshPrimitives::Meshlets>(AddMeshlets(meshletData, maxVertices, maxTriangles, bufferBuilder));
+}
+
+MeshletUtils::MeshletData MeshletUtils::GetMeshlets(const Document& doc, const GLTFResourceReader& reader, const MSFT::MeshPrimitives::Meshlets& meshlets)
+{
+    MeshletData meshletData;
+
+    const auto meshletComponents = ReadMeshletAccessor<uint32_t>(doc, reader, meshlets.meshletsAccessorId, TYPE_VEC4, COMPONENT_UNSIGNED_INT);
+    const auto boundsComponents = ReadMeshletAccessor<float>(doc, reader, meshlets.boundsAccessorId, TYPE_VEC4, COMPONENT_FLOAT);
+
+    meshletData.vertices = ReadMeshletAccessor<uint32_t>(doc, reader, meshlets.verticesAccessorId, TYPE_SCALAR, COMPONENT_UNSIGNED_INT);
+    meshletData.triangles = ReadMeshletAccessor<uint8_t>(doc, reader, meshlets.trianglesAccessorId, TYPE_SCALAR, COMPONENT_UNSIGNED_BYTE);
+
+    meshletData.meshlets.resize(meshletComponents.size() / 4U);
+    meshletData.bounds.resize(boundsComponents.size() / 8U);
+
+    if (meshletData.meshlets.size() != meshletData.bounds.size())
+    {
+        throw GLTFException(std::string("The number of meshlets and meshlet bounds of ") + MSFT::MeshPrimitives::MESHLETS_NAME + " don't match");
+    }
+
+    std::memcpy(meshletData.meshlets.data(), meshletComponents.data(), meshletData.meshlets.size() * sizeof(Meshlet));
+    std::memcpy(meshletData.bounds.data(), boundsComponents.data(), meshletData.bounds.size() * sizeof(MeshletBounds));
+
+    for (const auto& meshlet : meshletData.meshlets)
+    {
+        if (static_cast<size_t>(meshlet.vertexOffset) + meshlet.vertexCount > meshletData.vertices.size()
+            || (static_cast<size_t>(meshlet.triangleOffset) + meshlet.triangleCount) * 3U > meshletData.triangles.size())
+        {
+            throw GLTFException(std::string("A meshlet of ") + MSFT::MeshPrimitives::MESHLETS_NAME + " is out of range");
+        }
+    }
+
+    return meshletData;
+}
+
+void MeshletUtils::AddExtension(Document& document)
+{
+    document.extensionsUsed.insert(MSFT::MeshPrimitives::MESHLETS_NAME);
+}
@@ -0,0 +1,219 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/ParallelUtils.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+using namespace Microsoft::glTF;
+
+namespace
+{
+    // Blocks each caller of Wait until threadCount threads are waiting and then releases them all. Cancel releases every
+    // current and future caller immediately, so threads are never left waiting for a thread that failed to start.
+    class Barrier
+    {
+    public:
+        explicit Barrier(size_t threadCount)
+            : m_threadCount(threadCount), m_waitingCount(0U), m_generation(0U), m_isCancelled(false)
+        {
+        }
+
+        void Wait()
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            const size_t generation = m_generation;
+
+            if (++m_waitingCount == m_threadCount)
+            {
+                m_waitingCount = 0U;
+                ++m_generation;
+                m_condition.notify_all();
+            }
+            else
+            {
+                m_condition.wait(lock, [&]() { return m_generation != generation || m_isCancelled; });
+            }
+        }
+
+        void Cancel()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_isCancelled = true;
+            }
+
+            m_condition.notify_all();
+        }
+
+    private:
+        std::mutex m_mutex;
+        std::condition_variable m_condition;
+
+        const size_t m_threadCount;
+        size_t m_waitingCount;
+        size_t m_generation;
+        bool m_isCancelled;
+    };
+
+    size_t GetRangeCount(size_t count, size_t minRangeSize)
+    {
+        return std::min(ParallelUtils::GetConcurrency(), count / std::max<size_t>(minRangeSize, 1U));
+    }
+
+    // Distributes any remainder across the ranges so that they differ in size by at most one element
+    size_t GetRangeBegin(size_t count, size_t rangeIndex, size_t rangeCount)
+    {
+        return (count * rangeIndex) / rangeCount;
+    }
+
+    // Calls run(rangeIndex) for each of the rangeCount ranges - the first on the calling thread and the rest on new threads -
+    // and waits for them all to finish. If a thread can't be started then onStartFailed is called before waiting for the
+    // threads that were started and the exception is rethrown.
+    template<typename Run, typename StartFailed>
+    void RunRanges(size_t rangeCount, const Run& run, const StartFailed& onStartFailed)
+    {
+        std::vector<std::thread> threads;
+        threads.reserve(rangeCount - 1U);
+
+        try
+        {
+            for (size_t i = 1U; i < rangeCount; ++i)
+            {
+                threads.emplace_back(run, i);
+            }
+        }
+        catch (...)
+        {
+            onStartFailed();
+
+            // Thread creation failed - wait for any threads that were started before rethrowing
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            throw;
+        }
+
+        run(0U);
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    void RethrowFirst(const std::vector<std::exception_ptr>& exceptions)
+    {
+        for (const auto& exception : exceptions)
+        {
+            if (exception)
+            {
+                std::rethrow_exception(exception);
+            }
+        }
+    }
+}
+
+size_t ParallelUtils::GetConcurrency()
+{
+    // hardware_concurrency is permitted to return zero if the value is not well defined or computable
+    return std::max<size_t>(std::thread::hardware_concurrency(), 1U);
+}
+
+void ParallelUtils::ParallelFor(size_t count, size_t minRangeSize, const std::function<void(size_t, size_t)>& fn)
+{
+    const size_t rangeCount = GetRangeCount(count, minRangeSize);
+
+    if (rangeCount < 2U)
+    {
+        if (count > 0U)
+        {
+            fn(0U, count);
+        }
+
+        return;
+    }
+
+    std::vector<std::exception_ptr> exceptions(rangeCount);
+
+    const auto run = [&](size_t rangeIndex)
+    {
+        try
+        {
+            fn(GetRangeBegin(count, rangeIndex, rangeCount), GetRangeBegin(count, rangeIndex + 1U, rangeCount));
+        }
+        catch (...)
+        {
+            exceptions[rangeIndex] = std::current_exception();
+        }
+    };
+
+    RunRanges(rangeCount, run, []() {});
+    RethrowFirst(exceptions);
+}
+
+void ParallelUtils::ParallelForPhases(const std::vector<size_t>& counts, size_t minRangeSize, const std::function<void(size_t, size_t, size_t)>& fn)
+{
+    const size_t maxCount = counts.empty() ? 0U : *std::max_element(counts.begin(), counts.end());
+    const size_t rangeCount = GetRangeCount(maxCount, minRangeSize);
+
+    if (rangeCount < 2U)
+    {
+        for (size_t phase = 0U; phase < counts.size(); ++phase)
+        {
+            if (counts[phase] > 0U)
+            {
+                fn(phase, 0U, counts[phase]);
+            }
+        }
+
+        return;
+    }
+
+    std::vector<std::exception_ptr> exceptions(rangeCount);
+    Barrier barrier(rangeCount);
+
+    // The phase in which fn first threw (or zero if a thread failed to start). Threads only stop at the start of a phase after
+    // the failed one, which they all reach through the barrier, so no thread stops while another is still waiting for it.
+    std::atomic<size_t> failedPhase(counts.size());
+
+    const auto run = [&](size_t rangeIndex)
+    {
+        for (size_t phase = 0U; phase < counts.size() && phase <= failedPhase; ++phase)
+        {
+            const size_t begin = GetRangeBegin(counts[phase], rangeIndex, rangeCount);
+            const size_t end = GetRangeBegin(counts[phase], rangeIndex + 1U, rangeCount);
+
+            try
+            {
+                if (begin < end)
+                {
+                    fn(phase, begin, end);
+                }
+            }
+            catch (...)
+            {
+                exceptions[rangeIndex] = std::current_exception();
+                failedPhase = phase;
+            }
+
+            barrier.Wait();
+        }
+    };
+
+    RunRanges(rangeCount, run, [&]()
+    {
+        failedPhase = 0U;
+        barrier.Cancel();
+    });
+
+    RethrowFirst(exceptions);
+}
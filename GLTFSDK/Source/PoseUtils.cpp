@@ -0,0 +1,234 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/PoseUtils.h>
+
+#include <GLTFSDK/AnimationUtils.h>
+#include <GLTFSDK/CompiledAnimation.h>
+#include <GLTFSDK/Document.h>
+#include <GLTFSDK/GLTFResourceReader.h>
+#include <GLTFSDK/ParallelUtils.h>
+
+#include <algorithm>
+
+using namespace Microsoft::glTF;
+
+namespace
+{
+    // The minimum number of joints computed by each thread
+    constexpr size_t ParallelRangeSize = 1U << 10;
+}
+
+PoseUtils::NodeHierarchy PoseUtils::GetNodeHierarchy(const Document& doc)
+{
+    const size_t nodeCount = doc.nodes.Size();
+
+    NodeHierarchy hierarchy;
+    hierarchy.parents.resize(nodeCount, NoParent);
+    hierarchy.order.reserve(nodeCount);
+
+    for (size_t i = 0U; i < nodeCount; ++i)
+    {
+        const auto& node = doc.nodes[i];
+
+        for (const auto& childId : node.children)
+        {
+            const size_t child = doc.nodes.GetIndex(childId);
+
+            if (child == i || hierarchy.parents[child] != NoParent)
+            {
+                throw GLTFException("Node " + childId + " has more than one parent");
+            }
+
+            hierarchy.parents[child] = i;
+        }
+    }
+
+    // A depth first traversal from each root, so that the descendants of a node are contiguous
+    std::vector<size_t> stack;
+
+    for (size_t i = 0U; i < nodeCount; ++i)
+    {
+        if (hierarchy.parents[i] != NoParent)
+        {
+            continue;
+        }
+
+        stack.push_back(i);
+
+        while (!stack.empty())
+        {
+            const size_t index = stack.back();
+            stack.pop_back();
+
+            hierarchy.order.push_back(index);
+
+            const auto& children = doc.nodes[index].children;
+
+            for (auto it = children.rbegin(); it != children.rend(); ++it)
+            {
+                stack.push_back(doc.nodes.GetIndex(*it));
+            }
+        }
+    }
+
+    // Nodes in a cycle have parents but aren't reachable from a root
+    if (hierarchy.order.size() != nodeCount)
+    {
+        throw GLTFException("The node hierarchy contains a cycle");
+    }
+
+    return hierarchy;
+}
+
+PoseUtils::Pose PoseUtils::GetRestPose(const Document& doc)
+{
+    Pose pose;
+
+    pose.translations.reserve(doc.nodes.Size());
+    pose.rotations.reserve(doc.nodes.Size());
+    pose.scales.reserve(doc.nodes.Size());
+
+    for (const auto& node : doc.nodes.Elements())
+    {
+        pose.translations.push_back(node.translation);
+        pose.rotations.push_back(node.rotation);
+        pose.scales.push_back(node.scale);
+    }
+
+    return pose;
+}
+
+void PoseUtils::ApplyAnimation(const Document& doc, const CompiledAnimation& animation, const float* output, Pose& pose)
+{
+    for (size_t i = 0U; i < animation.GetChannelCount(); ++i)
+    {
+        const auto& channel = animation.GetChannel(i);
+        const float* value = output + channel.outputOffset;
+
+        switch (channel.path)
+        {
+        case TARGET_TRANSLATION:
+            pose.translations[doc.nodes.GetIndex(channel.nodeId)] = Vector3(value[0], value[1], value[2]);
+            break;
+        case TARGET_ROTATION:
+            pose.rotations[doc.nodes.GetIndex(channel.nodeId)] = Quaternion(value[0], value[1], value[2], value[3]);
+            break;
+        case TARGET_SCALE:
+            pose.scales[doc.nodes.GetIndex(channel.nodeId)] = Vector3(value[0], value[1], value[2]);
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+void PoseUtils::ComputeLocalTransforms(const Document& doc, const Pose& pose, std::vector<Matrix4>& localTransforms)
+{
+    const size_t nodeCount = doc.nodes.Size();
+
+    localTransforms.resize(nodeCount);
+
+    for (size_t i = 0U; i < nodeCount; ++i)
+    {
+        const auto& node = doc.nodes[i];
+
+        if (node.GetTransformationType() == TRANSFORMATION_MATRIX)
+        {
+            localTransforms[i] = node.matrix;
+        }
+        else
+        {
+            localTransforms[i] = Math::CreateTransform(pose.translations[i], pose.rotations[i], pose.scales[i]);
+        }
+    }
+}
+
+void PoseUtils::ComputeWorldTransforms(const NodeHierarchy& hierarchy, const std::vector<Matrix4>& localTransforms, std::vector<Matrix4>& worldTransforms)
+{
+    worldTransforms.resize(localTransforms.size());
+
+    for (auto index : hierarchy.order)
+    {
+        const size_t parent = hierarchy.parents[index];
+
+        if (parent == NoParent)
+        {
+            worldTransforms[index] = localTransforms[index];
+        }
+        else
+        {
+            worldTransforms[index] = Math::Multiply(worldTransforms[parent], localTransforms[index]);
+        }
+    }
+}
+
+PoseUtils::SkinBinding PoseUtils::GetSkinBinding(const Document& doc, const GLTFResourceReader& reader, const Skin& skin)
+{
+    SkinBinding binding;
+
+    binding.jointIndices.reserve(skin.jointIds.size());
+
+    for (const auto& jointId : skin.jointIds)
+    {
+        binding.jointIndices.push_back(doc.nodes.GetIndex(jointId));
+    }
+
+    binding.inverseBindMatrices.resize(skin.jointIds.size());
+
+    if (!skin.inverseBindMatricesAccessorId.empty())
+    {
+        const auto matrices = AnimationUtils::GetInverseBindMatrices(doc, reader, skin);
+
+        if (matrices.size() != skin.jointIds.size() * 16U)
+        {
+            throw GLTFException("Skin " + skin.id + " inverse bind matrix count doesn't match its joint count");
+        }
+
+        for (size_t i = 0U; i < binding.inverseBindMatrices.size(); ++i)
+        {
+            std::copy(matrices.begin() + i * 16U, matrices.begin() + (i + 1U) * 16U, binding.inverseBindMatrices[i].values.begin());
+        }
+    }
+
+    return binding;
+}
+
+void PoseUtils::ComputeJointPalette(const SkinBinding& skin, const Matrix4* worldTransforms, Matrix4* palette)
+{
+    for (size_t i = 0U; i < skin.jointIndices.size(); ++i)
+    {
+        palette[i] = Math::Multiply(worldTransforms[skin.jointIndices[i]], skin.inverseBindMatrices[i]);
+    }
+}
+
+void PoseUtils::ComputeJointPalettes(const std::vector<PaletteJob>& jobs)
+{
+    // The index of each job's first joint in the range of all the jobs' joints
+    std::vector<size_t> jobOffsets;
+    jobOffsets.reserve(jobs.size() + 1U);
+    jobOffsets.push_back(0U);
+
+    for (const auto& job : jobs)
+    {
+        jobOffsets.push_back(jobOffsets.back() + job.skin->jointIndices.size());
+    }
+
+    ParallelUtils::ParallelFor(jobOffsets.back(), ParallelRangeSize, [&jobs, &jobOffsets](size_t begin, size_t end)
+    {
+        size_t jobIndex = static_cast<size_t>(std::upper_bound(jobOffsets.begin(), jobOffsets.end(), begin) - jobOffsets.begin()) - 1U;
+
+        for (size_t i = begin; i < end; ++i)
+        {
+            while (i >= jobOffsets[jobIndex + 1U])
+            {
+                ++jobIndex;
+            }
+
+            const auto& job = jobs[jobIndex];
+            const size_t joint = i - jobOffsets[jobIndex];
+
+            job.palette[joint] = Math::Multiply(job.worldTransforms[job.skin->jointIndices[joint]], job.skin->inverseBindMatrices[joint]);
+        }
+    });
+}
@@ -0,0 +1,450 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/QuantizationUtils.h>
+
+#include <GLTFSDK/AnimationUtils.h>
+#include <GLTFSDK/BufferBuilder.h>
+#include <GLTFSDK/Document.h>
+#include <GLTFSDK/ExtensionsKHR.h>
+#include <GLTFSDK/GLTFResourceReader.h>
+#include <GLTFSDK/SIMD.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace Microsoft::glTF;
+
+namespace
+{
+    const float SNORM8_MAX = 127.0f;
+    const float SNORM16_MAX = 32767.0f;
+    const float UNORM16_MAX = 65535.0f;
+
+    // Rounds to nearest (ties to even), matching the SSE2 conversion instructions in the default rounding mode
+    int32_t Round(float value, float lo, float hi)
+    {
+        return static_cast<int32_t>(std::nearbyint(std::min(hi, std::max(value, lo))));
+    }
+
+    // Converts count elements of 'components' floats (3 or 4) to four snorm16 values: (value - offset) * multiplier
+    // Elements with three components are padded with a zero fourth component.
+    void QuantizeSnorm16(const float* src, size_t count, size_t components, const float (&offset)[4], float multiplier, int16_t* dst)
+    {
+        size_t i = 0U;
+
+#ifdef GLTFSDK_SSE2
+        const __m128 vOffset = _mm_loadu_ps(offset);
+        const __m128 vMultiplier = _mm_set1_ps(multiplier);
+        const __m128 vMask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, components == 4U ? -1 : 0));
+        const __m128 vLo = _mm_set1_ps(-SNORM16_MAX);
+        const __m128 vHi = _mm_set1_ps(SNORM16_MAX);
+
+        // Two elements per iteration, the unaligned loads may read (but ignore) one float beyond a three component element
+        for (; (i + 1U) * components + 4U <= count * components; i += 2U)
+        {
+            __m128 a = _mm_and_ps(_mm_loadu_ps(src + i * components), vMask);
+            __m128 b = _mm_and_ps(_mm_loadu_ps(src + (i + 1U) * components), vMask);
+
+            a = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_sub_ps(a, vOffset), vMultiplier), vLo), vHi);
+            b = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_sub_ps(b, vOffset), vMultiplier), vLo), vHi);
+
+            const __m128i packed = _mm_packs_epi32(_mm_cvtps_epi32(a), _mm_cvtps_epi32(b));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 4U), packed);
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            for (size_t j = 0U; j < 4U; ++j)
+            {
+                const float value = j < components ? (src[i * components + j] - offset[j]) * multiplier : 0.0f;
+                dst[i * 4U + j] = static_cast<int16_t>(Round(value, -SNORM16_MAX, SNORM16_MAX));
+            }
+        }
+    }
+
+    // Converts count elements of 'components' floats (3 or 4) in the range [-1, 1] to four snorm8 values
+    // Elements with three components are padded with a zero fourth component.
+    void QuantizeSnorm8(const float* src, size_t count, size_t components, int8_t* dst)
+    {
+        size_t i = 0U;
+
+#ifdef GLTFSDK_SSE2
+        const __m128 vMultiplier = _mm_set1_ps(SNORM8_MAX);
+        const __m128 vMask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, components == 4U ? -1 : 0));
+        const __m128 vLo = _mm_set1_ps(-SNORM8_MAX);
+        const __m128 vHi = _mm_set1_ps(SNORM8_MAX);
+
+        auto convert = [&](const float* element)
+        {
+            const __m128 v = _mm_mul_ps(_mm_and_ps(_mm_loadu_ps(element), vMask), vMultiplier);
+            return _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(v, vLo), vHi));
+        };
+
+        // Four elements per iteration, the unaligned loads may read (but ignore) one float beyond a three component element
+        for (; (i + 3U) * components + 4U <= count * components; i += 4U)
+        {
+            const __m128i ab = _mm_packs_epi32(convert(src + i * components), convert(src + (i + 1U) * components));
+            const __m128i cd = _mm_packs_epi32(convert(src + (i + 2U) * components), convert(src + (i + 3U) * components));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 4U), _mm_packs_epi16(ab, cd));
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            for (size_t j = 0U; j < 4U; ++j)
+            {
+                const float value = j < components ? src[i * components + j] * SNORM8_MAX : 0.0f;
+                dst[i * 4U + j] = static_cast<int8_t>(Round(value, -SNORM8_MAX, SNORM8_MAX));
+            }
+        }
+    }
+
+    // Converts count pairs of floats to unorm16 values: (value - offset) * multiplier
+    void QuantizeUnorm16x2(const float* src, size_t count, const Vector2& offset, const Vector2& multiplier, uint16_t* dst)
+    {
+        const size_t valueCount = count * 2U;
+        size_t i = 0U;
+
+#ifdef GLTFSDK_SSE2
+        const __m128 vOffset = _mm_setr_ps(offset.x, offset.y, offset.x, offset.y);
+        const __m128 vMultiplier = _mm_setr_ps(multiplier.x, multiplier.y, multiplier.x, multiplier.y);
+        const __m128 vLo = _mm_setzero_ps();
+        const __m128 vHi = _mm_set1_ps(UNORM16_MAX);
+        const __m128i vBias = _mm_set1_epi32(32768);
+        const __m128i vUnbias = _mm_set1_epi16(static_cast<int16_t>(0x8000));
+
+        // SSE2 has no unsigned saturating 32 to 16-bit pack so the values are biased into the signed range and back
+        for (; i + 8U <= valueCount; i += 8U)
+        {
+            const __m128 a = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(src + i), vOffset), vMultiplier), vLo), vHi);
+            const __m128 b = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(src + i + 4U), vOffset), vMultiplier), vLo), vHi);
+
+            const __m128i packed = _mm_packs_epi32(_mm_sub_epi32(_mm_cvtps_epi32(a), vBias), _mm_sub_epi32(_mm_cvtps_epi32(b), vBias));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_xor_si128(packed, vUnbias));
+        }
+#endif
+
+        for (; i < valueCount; ++i)
+        {
+            const float value = (i % 2U) ? (src[i] - offset.y) * multiplier.y : (src[i] - offset.x) * multiplier.x;
+            dst[i] = static_cast<uint16_t>(Round(value, 0.0f, UNORM16_MAX));
+        }
+    }
+
+    void ValidateElementCount(const std::vector<float>& values, size_t components, const char* name)
+    {
+        if (values.size() % components)
+        {
+            throw GLTFException(std::string("Invalid number of values for quantized ") + name);
+        }
+    }
+
+    // Adds an accessor to a new buffer view that uses the specified byte stride
+    const Accessor& AddStridedAccessor(BufferBuilder& bufferBuilder, const void* data, size_t count, size_t byteStride, AccessorDesc desc)
+    {
+        bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+        bufferBuilder.AddAccessors(data, count, byteStride, &desc, 1U);
+
+        return bufferBuilder.GetCurrentAccessor();
+    }
+
+    // Combines the texture coordinate dequantization transform with any existing KHR_texture_transform, if the texture uses the set
+    void ApplyTextureTransform(TextureInfo& textureInfo, size_t texCoord, const QuantizationUtils::QuantizedTexCoords& texCoords)
+    {
+        using KHR::TextureInfos::TextureTransform;
+
+        if (textureInfo.textureId.empty())
+        {
+            return;
+        }
+
+        if (textureInfo.HasExtension<TextureTransform>())
+        {
+            auto& transform = textureInfo.GetExtension<TextureTransform>();
+
+            if ((transform.texCoord ? *transform.texCoord : textureInfo.texCoord) == texCoord)
+            {
+                // T * R * S * translation(offset) * scale(scale) = (T + R * S * offset) * R * (S * scale), where KHR_texture_transform's
+                // rotation maps (u, v) to (u * cos + v * sin, v * cos - u * sin)
+                const float c = std::cos(transform.rotation);
+                const float s = std::sin(transform.rotation);
+                const Vector2 offset(transform.scale.x * texCoords.offset.x, transform.scale.y * texCoords.offset.y);
+
+                transform.offset = Vector2(transform.offset.x + c * offset.x + s * offset.y, transform.offset.y - s * offset.x + c * offset.y);
+                transform.scale = Vector2(transform.scale.x * texCoords.scale.x, transform.scale.y * texCoords.scale.y);
+            }
+        }
+        else if (textureInfo.texCoord == texCoord)
+        {
+            auto transform = std::make_unique<TextureTransform>();
+            transform->offset = texCoords.offset;
+            transform->scale = texCoords.scale;
+
+            textureInfo.SetExtension(std::move(transform));
+        }
+    }
+}
+
+QuantizationUtils::QuantizedPositions QuantizationUtils::QuantizePositions(const std::vector<float>& positions)
+{
+    ValidateElementCount(positions, 3U, "positions");
+
+    const size_t count = positions.size() / 3U;
+
+    float lo[3] = { std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max() };
+    float hi[3] = { std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest() };
+
+    for (size_t i = 0U; i < count; ++i)
+    {
+        for (size_t j = 0U; j < 3U; ++j)
+        {
+            lo[j] = std::min(lo[j], positions[i * 3U + j]);
+            hi[j] = std::max(hi[j], positions[i * 3U + j]);
+        }
+    }
+
+    QuantizedPositions result;
+    result.translation = Vector3::ZERO;
+    result.scale = 1.0f;
+
+    if (count > 0U)
+    {
+        result.translation = Vector3((lo[0] + hi[0]) * 0.5f, (lo[1] + hi[1]) * 0.5f, (lo[2] + hi[2]) * 0.5f);
+
+        const float halfExtent = std::max({ hi[0] - lo[0], hi[1] - lo[1], hi[2] - lo[2] }) * 0.5f;
+
+        if (halfExtent > 0.0f)
+        {
+            result.scale = halfExtent;
+        }
+    }
+
+    const float offset[4] = { result.translation.x, result.translation.y, result.translation.z, 0.0f };
+
+    result.positions.resize(count * 4U);
+    QuantizeSnorm16(positions.data(), count, 3U, offset, SNORM16_MAX / result.scale, result.positions.data());
+
+    // POSITION accessors require min and max values, these are the quantized (not normalized) values
+    if (count > 0U)
+    {
+        result.minValues.assign(3U, std::numeric_limits<float>::max());
+        result.maxValues.assign(3U, std::numeric_limits<float>::lowest());
+
+        for (size_t i = 0U; i < count; ++i)
+        {
+            for (size_t j = 0U; j < 3U; ++j)
+            {
+                const float value = result.positions[i * 4U + j];
+
+                result.minValues[j] = std::min(result.minValues[j], value);
+                result.maxValues[j] = std::max(result.maxValues[j], value);
+            }
+        }
+    }
+
+    return result;
+}
+
+std::vector<int8_t> QuantizationUtils::QuantizeNormals(const std::vector<float>& normals)
+{
+    ValidateElementCount(normals, 3U, "normals");
+
+    const size_t count = normals.size() / 3U;
+
+    std::vector<int8_t> result(count * 4U);
+    QuantizeSnorm8(normals.data(), count, 3U, result.data());
+
+    return result;
+}
+
+std::vector<int8_t> QuantizationUtils::QuantizeTangents(const std::vector<float>& tangents)
+{
+    ValidateElementCount(tangents, 4U, "tangents");
+
+    const size_t count = tangents.size() / 4U;
+
+    std::vector<int8_t> result(count * 4U);
+    QuantizeSnorm8(tangents.data(), count, 4U, result.data());
+
+    return result;
+}
+
+QuantizationUtils::QuantizedTexCoords QuantizationUtils::QuantizeTexCoords(const std::vector<float>& texCoords)
+{
+    ValidateElementCount(texCoords, 2U, "texture coordinates");
+
+    const size_t count = texCoords.size() / 2U;
+
+    Vector2 lo(std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+    Vector2 hi(std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest());
+
+    for (size_t i = 0U; i < count; ++i)
+    {
+        lo.x = std::min(lo.x, texCoords[i * 2U]);
+        lo.y = std::min(lo.y, texCoords[i * 2U + 1U]);
+        hi.x = std::max(hi.x, texCoords[i * 2U]);
+        hi.y = std::max(hi.y, texCoords[i * 2U + 1U]);
+    }
+
+    QuantizedTexCoords result;
+    result.offset = Vector2::ZERO;
+    result.scale = Vector2::ONE;
+
+    // Only texture coordinates outside of [0, 1] require a dequantization transform
+    if (count > 0U && (lo.x < 0.0f || lo.y < 0.0f || hi.x > 1.0f || hi.y > 1.0f))
+    {
+        result.offset = lo;
+        result.scale = Vector2(hi.x > lo.x ? hi.x - lo.x : 1.0f, hi.y > lo.y ? hi.y - lo.y : 1.0f);
+    }
+
+    result.texCoords.resize(count * 2U);
+    QuantizeUnorm16x2(texCoords.data(), count, result.offset, Vector2(UNORM16_MAX / result.scale.x, UNORM16_MAX / result.scale.y), result.texCoords.data());
+
+    return result;
+}
+
+const Accessor& QuantizationUtils::AddPositionsAccessor(BufferBuilder& bufferBuilder, const QuantizedPositions& positions)
+{
+    // Vertex attribute elements must be 4-byte aligned, each position's padding component is skipped via the byte stride
+    return AddStridedAccessor(bufferBuilder, positions.positions.data(), positions.positions.size() / 4U, 4U * sizeof(int16_t),
+        { TYPE_VEC3, COMPONENT_SHORT, true, positions.minValues, positions.maxValues });
+}
+
+const Accessor& QuantizationUtils::AddNormalsAccessor(BufferBuilder& bufferBuilder, const std::vector<int8_t>& normals)
+{
+    return AddStridedAccessor(bufferBuilder, normals.data(), normals.size() / 4U, 4U * sizeof(int8_t),
+        { TYPE_VEC3, COMPONENT_BYTE, true });
+}
+
+const Accessor& QuantizationUtils::AddTangentsAccessor(BufferBuilder& bufferBuilder, const std::vector<int8_t>& tangents)
+{
+    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+    return bufferBuilder.AddAccessor(tangents, { TYPE_VEC4, COMPONENT_BYTE, true });
+}
+
+const Accessor& QuantizationUtils::AddTexCoordsAccessor(BufferBuilder& bufferBuilder, const QuantizedTexCoords& texCoords)
+{
+    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+    return bufferBuilder.AddAccessor(texCoords.texCoords, { TYPE_VEC2, COMPONENT_UNSIGNED_SHORT, true });
+}
+
+const Node& QuantizationUtils::ApplyDequantizationTransform(Document& document, const std::string& nodeId, const QuantizedPositions& positions)
+{
+    Node node = document.nodes[nodeId];
+
+    if (!node.skinId.empty())
+    {
+        throw GLTFException("The dequantization transform of skinned node " + nodeId + " must be applied to its skin");
+    }
+
+    Node child;
+    child.meshId = std::move(node.meshId);
+    child.weights = std::move(node.weights);
+    child.translation = positions.translation;
+    child.scale = Vector3(positions.scale, positions.scale, positions.scale);
+
+    const Node& childRef = document.nodes.Append(std::move(child), AppendIdPolicy::GenerateOnEmpty);
+
+    node.meshId.clear();
+    node.weights.clear();
+    node.children.push_back(childRef.id);
+
+    document.nodes.Replace(std::move(node));
+
+    return childRef;
+}
+
+const Skin& QuantizationUtils::ApplySkinDequantizationTransform(Document& document, const GLTFResourceReader& reader, BufferBuilder& bufferBuilder, const std::string& nodeId, const QuantizedPositions& positions)
+{
+    Skin skin = document.skins[document.nodes[nodeId].skinId];
+
+    std::vector<float> matrices;
+
+    if (skin.inverseBindMatricesAccessorId.empty())
+    {
+        matrices.resize(skin.jointIds.size() * 16U);
+
+        for (size_t i = 0U; i < skin.jointIds.size(); ++i)
+        {
+            std::copy(Matrix4::IDENTITY.values.begin(), Matrix4::IDENTITY.values.end(), matrices.begin() + i * 16U);
+        }
+    }
+    else
+    {
+        matrices = AnimationUtils::GetInverseBindMatrices(document, reader, skin);
+    }
+
+    const Vector3& t = positions.translation;
+    const float s = positions.scale;
+
+    // matrix' = matrix * translation(t) * scale(s) - the matrix values are stored in column-major order
+    for (size_t i = 0U; i < matrices.size(); i += 16U)
+    {
+        float* m = matrices.data() + i;
+
+        for (size_t row = 0U; row < 4U; ++row)
+        {
+            m[12U + row] += m[row] * t.x + m[4U + row] * t.y + m[8U + row] * t.z;
+
+            m[row] *= s;
+            m[4U + row] *= s;
+            m[8U + row] *= s;
+        }
+    }
+
+    bufferBuilder.AddBufferView(BufferViewTarget::UNKNOWN_BUFFER);
+
+    // The skin may be shared by other nodes so a copy is transformed
+    skin.id.clear();
+    skin.inverseBindMatricesAccessorId = bufferBuilder.AddAccessor(matrices, { TYPE_MAT4, COMPONENT_FLOAT }).id;
+
+    const Skin& skinRef = document.skins.Append(std::move(skin), AppendIdPolicy::GenerateOnEmpty);
+
+    Node node = document.nodes[nodeId];
+    node.skinId = skinRef.id;
+    document.nodes.Replace(std::move(node));
+
+    return skinRef;
+}
+
+void QuantizationUtils::ApplyDequantizationTransform(Document& document, const MeshPrimitive& meshPrimitive, size_t texCoord, const QuantizedTexCoords& texCoords)
+{
+    if (meshPrimitive.materialId.empty() || (texCoords.offset == Vector2::ZERO && texCoords.scale == Vector2::ONE))
+    {
+        return;
+    }
+
+    Material material = document.materials[meshPrimitive.materialId];
+
+    ApplyTextureTransform(material.metallicRoughness.baseColorTexture, texCoord, texCoords);
+    ApplyTextureTransform(material.metallicRoughness.metallicRoughnessTexture, texCoord, texCoords);
+    ApplyTextureTransform(material.normalTexture, texCoord, texCoords);
+    ApplyTextureTransform(material.occlusionTexture, texCoord, texCoords);
+    ApplyTextureTransform(material.emissiveTexture, texCoord, texCoords);
+
+    if (material.HasExtension<KHR::Materials::PBRSpecularGlossiness>())
+    {
+        auto& specGloss = material.GetExtension<KHR::Materials::PBRSpecularGlossiness>();
+
+        ApplyTextureTransform(specGloss.diffuseTexture, texCoord, texCoords);
+        ApplyTextureTransform(specGloss.specularGlossinessTexture, texCoord, texCoords);
+    }
+
+    document.materials.Replace(std::move(material));
+
+    // Without the texture transform the quantized texture coordinates would be interpreted incorrectly
+    document.extensionsUsed.insert(KHR::TextureInfos::TEXTURETRANSFORM_NAME);
+    document.extensionsRequired.insert(KHR::TextureInfos::TEXTURETRANSFORM_NAME);
+}
+
+void QuantizationUtils::AddExtension(Document& document)
+{
+    document.extensionsUsed.insert(KHR::MeshPrimitives::MESHQUANTIZATION_NAME);
+    document.extensionsRequired.insert(KHR::MeshPrimitives::MESHQUANTIZATION_NAME);
+}
@@ -16,7 +16,66 @@ void ResourceWriter::Write(const BufferView& bufferView, const void* data)
     WriteImpl(bufferView, data, bufferView.byteOffset, bufferView.byteLength);
 }
 
+void ResourceWriter::Write(const BufferView& bufferView, std::istream& stream)
+{
+    const std::streamoff totalOffset = bufferView.byteOffset;
+
+    if (auto bufferStream = PrepareBufferStream(bufferView, totalOffset))
+    {
+        StreamUtils::CopyBinary(stream, *bufferStream, bufferView.byteLength);
+
+        SetBufferOffset(bufferView.bufferId, totalOffset + bufferView.byteLength);
+    }
+}
+
 void ResourceWriter::Write(const BufferView& bufferView, const void* data, const Accessor& accessor)
+{
+    ValidateAccessor(bufferView, accessor);
+
+    WriteImpl(bufferView, data, bufferView.byteOffset + accessor.byteOffset, accessor.GetByteLength());
+}
+
+void ResourceWriter::Write(const BufferView& bufferView, const Accessor& accessor, const std::function<void(void* chunk, size_t byteOffset, size_t byteLength)>& fnFill)
+{
+    ValidateAccessor(bufferView, accessor);
+
+    const std::streamoff totalOffset = bufferView.byteOffset + accessor.byteOffset;
+    const auto accessorByteLength = accessor.GetByteLength();
+
+    if (auto bufferStream = PrepareBufferStream(bufferView, totalOffset))
+    {
+        alignas(16) char chunk[16U * 1024U];
+
+        // Round the chunk size down so that no element is split between chunks
+        const size_t elementSize = Accessor::GetTypeCount(accessor.type) * Accessor::GetComponentTypeSize(accessor.componentType);
+        const size_t chunkElementsByteLength = (sizeof(chunk) / elementSize) * elementSize;
+
+        for (size_t byteOffset = 0U; byteOffset < accessorByteLength; byteOffset += chunkElementsByteLength)
+        {
+            const size_t byteLength = std::min(chunkElementsByteLength, accessorByteLength - byteOffset);
+
+            fnFill(chunk, byteOffset, byteLength);
+            StreamUtils::WriteBinary(*bufferStream, chunk, byteLength);
+        }
+
+        SetBufferOffset(bufferView.bufferId, totalOffset + accessorByteLength);
+    }
+}
+
+void ResourceWriter::WriteExternal(const std::string& uri, const void* data, size_t byteLength) const
+{
+    if (auto stream = m_streamWriterCache->Get(uri))
+    {
+        StreamUtils::WriteBinary(*stream, data, byteLength);
+    }
+}
+
+void ResourceWriter::WriteExternal(const std::string& uri, const std::string& data) const
+{
+    WriteExternal(uri, data.c_str(), data.length());
+}
+
+void ResourceWriter::ValidateAccessor(const BufferView& bufferView, const Accessor& accessor)
 {
     if (accessor.bufferViewId != bufferView.id)
     {
@@ -37,35 +96,20 @@ void ResourceWriter::Write(const BufferView& bufferView, const void* data, const
         throw InvalidGLTFException("accessor.byteOffset + bufferView.byteOffset must be a multiple of the accessor's component type size");
     }
 
-    const auto accessorByteLength = accessor.GetByteLength();
-
     // Ensure there is enough room in the BufferView for the accessor's data
-    if (bufferView.byteLength < accessor.byteOffset + accessorByteLength)
+    if (bufferView.byteLength < accessor.byteOffset + accessor.GetByteLength())
     {
         throw InvalidGLTFException("accessor offset and byte length exceed the buffer view's byte length");
     }
-
-    WriteImpl(bufferView, data, bufferView.byteOffset + accessor.byteOffset, accessorByteLength);
 }
 
-void ResourceWriter::WriteExternal(const std::string& uri, const void* data, size_t byteLength) const
-{
-    if (auto stream = m_streamWriterCache->Get(uri))
-    {
-        StreamUtils::WriteBinary(*stream, data, byteLength);
-    }
-}
-
-void ResourceWriter::WriteExternal(const std::string& uri, const std::string& data) const
-{
-    WriteExternal(uri, data.c_str(), data.length());
-}
-
-void ResourceWriter::WriteImpl(const BufferView& bufferView, const void* data, std::streamoff totalOffset, size_t totalByteLength)
+std::ostream* ResourceWriter::PrepareBufferStream(const BufferView& bufferView, std::streamoff totalOffset)
 {
     // TODO: vertex attributes must be aligned to 4-byte boundaries inside a bufferView (accessor.byteOffset and bufferView.byteStride must be multiples of 4)
 
-    if (auto bufferStream = GetBufferStream(bufferView.bufferId))
+    auto bufferStream = GetBufferStream(bufferView.bufferId);
+
+    if (bufferStream)
     {
         const auto bufferOffset = GetBufferOffset(bufferView.bufferId);
 
@@ -82,7 +126,15 @@ void ResourceWriter::WriteImpl(const BufferView& bufferView, const void* data, s
         }
 
         SetBufferOffset(bufferView.bufferId, totalOffset);
+    }
+
+    return bufferStream;
+}
 
+void ResourceWriter::WriteImpl(const BufferView& bufferView, const void* data, std::streamoff totalOffset, size_t totalByteLength)
+{
+    if (auto bufferStream = PrepareBufferStream(bufferView, totalOffset))
+    {
         if (StreamUtils::WriteBinary(*bufferStream, data, totalByteLength) != totalByteLength)
         {
             throw InvalidGLTFException("An unexpected number of bytes were output to the stream");
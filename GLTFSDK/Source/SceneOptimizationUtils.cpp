@@ -0,0 +1,792 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/SceneOptimizationUtils.h>
+
+#include <GLTFSDK/BoundsUtils.h>
+#include <GLTFSDK/BufferBuilder.h>
+#include <GLTFSDK/ConversionUtils.h>
+#include <GLTFSDK/Document.h>
+#include <GLTFSDK/GLTFResourceReader.h>
+#include <GLTFSDK/MeshPrimitiveUtils.h>
+#include <GLTFSDK/PoseUtils.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+
+using namespace Microsoft::glTF;
+
+namespace
+{
+    bool HasContent(const Node& node)
+    {
+        return !node.meshId.empty()
+            || !node.cameraId.empty()
+            || !node.skinId.empty()
+            || !node.weights.empty()
+            || !node.extensions.empty()
+            || !node.GetExtensions().empty()
+            || !node.extras.empty();
+    }
+
+    // The ids of nodes whose identity matters to other parts of the document
+    std::unordered_set<std::string> GetReferencedNodeIds(const Document& doc)
+    {
+        std::unordered_set<std::string> nodeIds;
+
+        for (const auto& animation : doc.animations.Elements())
+        {
+            for (const auto& channel : animation.channels.Elements())
+            {
+                nodeIds.insert(channel.target.nodeId);
+            }
+        }
+
+        for (const auto& skin : doc.skins.Elements())
+        {
+            nodeIds.insert(skin.jointIds.begin(), skin.jointIds.end());
+
+            if (!skin.skeletonId.empty())
+            {
+                nodeIds.insert(skin.skeletonId);
+            }
+        }
+
+        return nodeIds;
+    }
+
+    // The number of scenes that each node is a root of
+    std::vector<size_t> GetSceneCounts(const Document& doc)
+    {
+        std::vector<size_t> sceneCounts(doc.nodes.Size(), 0U);
+
+        for (const auto& scene : doc.scenes.Elements())
+        {
+            for (const auto& nodeId : scene.nodes)
+            {
+                ++sceneCounts[doc.nodes.GetIndex(nodeId)];
+            }
+        }
+
+        return sceneCounts;
+    }
+
+    std::vector<std::string> RemoveIds(const std::vector<std::string>& ids, const std::unordered_set<std::string>& removedIds)
+    {
+        std::vector<std::string> result;
+        result.reserve(ids.size());
+
+        for (const auto& id : ids)
+        {
+            if (removedIds.count(id) == 0U)
+            {
+                result.push_back(id);
+            }
+        }
+
+        return result;
+    }
+
+    template<typename T>
+    void ReadElements(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor, uint8_t* output)
+    {
+        reader.ReadBinaryData<T>(doc, accessor, StridedSpan<T>(reinterpret_cast<T*>(output), accessor.count));
+    }
+
+    // Reads the accessor's elements, whatever their component type, as tightly packed bytes
+    std::vector<uint8_t> ReadElements(const Document& doc, const GLTFResourceReader& reader, const Accessor& accessor)
+    {
+        std::vector<uint8_t> elements(accessor.GetByteLength());
+
+        switch (accessor.componentType)
+        {
+        case COMPONENT_BYTE:
+            ReadElements<int8_t>(doc, reader, accessor, elements.data());
+            break;
+        case COMPONENT_UNSIGNED_BYTE:
+            ReadElements<uint8_t>(doc, reader, accessor, elements.data());
+            break;
+        case COMPONENT_SHORT:
+            ReadElements<int16_t>(doc, reader, accessor, elements.data());
+            break;
+        case COMPONENT_UNSIGNED_SHORT:
+            ReadElements<uint16_t>(doc, reader, accessor, elements.data());
+            break;
+        case COMPONENT_UNSIGNED_INT:
+            ReadElements<uint32_t>(doc, reader, accessor, elements.data());
+            break;
+        case COMPONENT_FLOAT:
+            ReadElements<float>(doc, reader, accessor, elements.data());
+            break;
+        default:
+            throw GLTFException("Invalid componentType for accessor " + accessor.id);
+        }
+
+        return elements;
+    }
+
+    // Accessor min and max values are the unnormalized component values
+    void ComputeMinMax(const uint8_t* elements, size_t count, size_t byteStride, AccessorDesc& desc)
+    {
+        const size_t typeCount = Accessor::GetTypeCount(desc.accessorType);
+
+        desc.minValues.assign(typeCount, std::numeric_limits<float>::max());
+        desc.maxValues.assign(typeCount, std::numeric_limits<float>::lowest());
+
+        std::vector<float> values(typeCount);
+
+        for (size_t i = 0U; i < count; ++i)
+        {
+            ConversionUtils::ToFloat(elements + i * byteStride, desc.componentType, false, values.data(), typeCount);
+
+            for (size_t j = 0U; j < typeCount; ++j)
+            {
+                desc.minValues[j] = std::min(desc.minValues[j], values[j]);
+                desc.maxValues[j] = std::max(desc.maxValues[j], values[j]);
+            }
+        }
+    }
+
+    bool CanMergePrimitive(const MeshPrimitive& meshPrimitive)
+    {
+        return (meshPrimitive.mode == MESH_TRIANGLES || meshPrimitive.mode == MESH_TRIANGLE_STRIP || meshPrimitive.mode == MESH_TRIANGLE_FAN)
+            && meshPrimitive.targets.empty()
+            && meshPrimitive.HasAttribute(ACCESSOR_POSITION)
+            && meshPrimitive.extensions.empty()
+            && meshPrimitive.GetExtensions().empty()
+            && meshPrimitive.extras.empty();
+    }
+
+    // Baking a transform requires float positions, normals and tangents
+    bool CanTransformPrimitive(const Document& doc, const MeshPrimitive& meshPrimitive)
+    {
+        const auto isFloat = [&doc, &meshPrimitive](const char* name, AccessorType accessorType)
+        {
+            std::string accessorId;
+
+            if (!meshPrimitive.TryGetAttributeAccessorId(name, accessorId))
+            {
+                return true;
+            }
+
+            const auto& accessor = doc.accessors.Get(accessorId);
+
+            return accessor.type == accessorType && accessor.componentType == COMPONENT_FLOAT;
+        };
+
+        return isFloat(ACCESSOR_POSITION, TYPE_VEC3) && isFloat(ACCESSOR_NORMAL, TYPE_VEC3) && isFloat(ACCESSOR_TANGENT, TYPE_VEC4);
+    }
+
+    // Primitives can only be merged if they share a material and their attributes have the same names and formats
+    std::string GetMergeKey(const Document& doc, const MeshPrimitive& meshPrimitive)
+    {
+        const std::map<std::string, std::string> attributes(meshPrimitive.attributes.begin(), meshPrimitive.attributes.end());
+
+        std::string key = meshPrimitive.materialId;
+
+        for (const auto& attribute : attributes)
+        {
+            const auto& accessor = doc.accessors.Get(attribute.second);
+
+            key += '\n';
+            key += attribute.first;
+            key += ':' + std::to_string(accessor.type) + ':' + std::to_string(accessor.componentType) + ':' + std::to_string(accessor.normalized);
+        }
+
+        return key;
+    }
+
+    // A primitive and the transform to bake into its vertex data
+    struct PrimitiveSource
+    {
+        const MeshPrimitive* meshPrimitive;
+        Matrix4 transform;
+    };
+
+    // The transforms applied to each kind of vertex attribute. Normals are transformed by the inverse transpose of the
+    // transform's linear part, for which its cofactor matrix (scaled by the sign of the determinant) is used as the
+    // transformed normals are renormalized anyway. A mirroring transform also reverses the triangles' winding.
+    struct AttributeTransforms
+    {
+        explicit AttributeTransforms(const Matrix4& transform) : points(transform), linear(transform)
+        {
+            const auto& m = transform.values;
+
+            const Vector3 c0(m[0], m[1], m[2]);
+            const Vector3 c1(m[4], m[5], m[6]);
+            const Vector3 c2(m[8], m[9], m[10]);
+
+            const auto cross = [](const Vector3& a, const Vector3& b)
+            {
+                return Vector3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x);
+            };
+
+            const Vector3 n0 = cross(c1, c2);
+            const Vector3 n1 = cross(c2, c0);
+            const Vector3 n2 = cross(c0, c1);
+
+            determinant = c0.x * n0.x + c0.y * n0.y + c0.z * n0.z;
+            isMirrored = determinant < 0.0f;
+
+            const float sign = isMirrored ? -1.0f : 1.0f;
+
+            normals.values = {
+                n0.x * sign, n0.y * sign, n0.z * sign, 0.0f,
+                n1.x * sign, n1.y * sign, n1.z * sign, 0.0f,
+                n2.x * sign, n2.y * sign, n2.z * sign, 0.0f,
+                0.0f, 0.0f, 0.0f, 1.0f
+            };
+
+            linear.values[12] = 0.0f;
+            linear.values[13] = 0.0f;
+            linear.values[14] = 0.0f;
+        }
+
+        Matrix4 points;
+        Matrix4 normals;
+        Matrix4 linear;
+        float determinant;
+        bool isMirrored;
+    };
+
+    void Normalize(float* v)
+    {
+        const float length = std::sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+
+        if (length > 0.0f)
+        {
+            v[0] /= length;
+            v[1] /= length;
+            v[2] /= length;
+        }
+    }
+
+    void TransformAttribute(const std::string& name, const AttributeTransforms& transforms, float* values, size_t count)
+    {
+        if (name == ACCESSOR_POSITION)
+        {
+            Math::TransformPoints(transforms.points, values, count, values);
+        }
+        else if (name == ACCESSOR_NORMAL)
+        {
+            Math::TransformPoints(transforms.normals, values, count, values);
+
+            for (size_t i = 0U; i < count; ++i)
+            {
+                Normalize(values + i * 3U);
+            }
+        }
+        else if (name == ACCESSOR_TANGENT)
+        {
+            // The w component is the handedness of the bitangent, which a mirroring transform flips
+            for (size_t i = 0U; i < count; ++i)
+            {
+                float* tangent = values + i * 4U;
+
+                const auto xyz = Math::TransformPoint(transforms.linear, Vector3(tangent[0], tangent[1], tangent[2]));
+
+                tangent[0] = xyz.x;
+                tangent[1] = xyz.y;
+                tangent[2] = xyz.z;
+
+                Normalize(tangent);
+
+                if (transforms.isMirrored)
+                {
+                    tangent[3] = -tangent[3];
+                }
+            }
+        }
+    }
+
+    MeshPrimitive WriteMergedPrimitive(const Document& doc, const GLTFResourceReader& reader, const std::vector<PrimitiveSource>& sources,
+        BufferBuilder& bufferBuilder)
+    {
+        const auto& firstPrimitive = *sources.front().meshPrimitive;
+
+        std::vector<size_t> vertexCounts;
+        vertexCounts.reserve(sources.size());
+
+        size_t vertexCount = 0U;
+
+        for (const auto& source : sources)
+        {
+            vertexCounts.push_back(doc.accessors.Get(source.meshPrimitive->GetAttributeAccessorId(ACCESSOR_POSITION)).count);
+            vertexCount += vertexCounts.back();
+        }
+
+        if (vertexCount >= std::numeric_limits<uint32_t>::max())
+        {
+            throw GLTFException("The merged primitive has too many vertices for 32-bit indices");
+        }
+
+        std::vector<AttributeTransforms> transforms;
+        transforms.reserve(sources.size());
+
+        std::vector<uint32_t> indices;
+        uint32_t baseVertex = 0U;
+
+        for (size_t i = 0U; i < sources.size(); ++i)
+        {
+            transforms.emplace_back(sources[i].transform);
+
+            const auto sourceIndices = MeshPrimitiveUtils::GetTriangulatedIndices32(doc, reader, *sources[i].meshPrimitive);
+            const size_t offset = indices.size();
+
+            indices.reserve(offset + sourceIndices.size());
+
+            for (auto index : sourceIndices)
+            {
+                indices.push_back(baseVertex + index);
+            }
+
+            if (transforms.back().isMirrored)
+            {
+                for (size_t j = offset; j + 2U < indices.size(); j += 3U)
+                {
+                    std::swap(indices[j + 1U], indices[j + 2U]);
+                }
+            }
+
+            baseVertex += static_cast<uint32_t>(vertexCounts[i]);
+        }
+
+        MeshPrimitive result;
+        result.materialId = firstPrimitive.materialId;
+        result.mode = MESH_TRIANGLES;
+
+        // Sorted by name, so that the accessors are written in the same order whatever the order of the attributes
+        const std::map<std::string, std::string> attributes(firstPrimitive.attributes.begin(), firstPrimitive.attributes.end());
+
+        for (const auto& attribute : attributes)
+        {
+            const auto& firstAccessor = doc.accessors.Get(attribute.second);
+
+            // Vertex attribute elements must be 4-byte aligned so narrow elements (e.g. VEC3 of shorts) are padded
+            const size_t elementSize = Accessor::GetComponentTypeSize(firstAccessor.componentType) * Accessor::GetTypeCount(firstAccessor.type);
+            const size_t byteStride = (elementSize + 3U) & ~static_cast<size_t>(3U);
+
+            std::vector<uint8_t> destination(vertexCount * byteStride);
+            size_t vertexOffset = 0U;
+
+            for (size_t i = 0U; i < sources.size(); ++i)
+            {
+                const auto& accessor = doc.accessors.Get(sources[i].meshPrimitive->GetAttributeAccessorId(attribute.first));
+
+                if (accessor.count != vertexCounts[i])
+                {
+                    throw GLTFException("The element count of accessor " + accessor.id + " doesn't match the primitive's vertex count");
+                }
+
+                auto elements = ReadElements(doc, reader, accessor);
+
+                if (sources[i].transform != Matrix4::IDENTITY && accessor.componentType == COMPONENT_FLOAT)
+                {
+                    TransformAttribute(attribute.first, transforms[i], reinterpret_cast<float*>(elements.data()), accessor.count);
+                }
+
+                for (size_t j = 0U; j < accessor.count; ++j)
+                {
+                    std::memcpy(destination.data() + (vertexOffset + j) * byteStride, elements.data() + j * elementSize, elementSize);
+                }
+
+                vertexOffset += accessor.count;
+            }
+
+            AccessorDesc desc(firstAccessor.type, firstAccessor.componentType, firstAccessor.normalized);
+
+            if (attribute.first == ACCESSOR_POSITION || (!firstAccessor.min.empty() && !firstAccessor.max.empty()))
+            {
+                ComputeMinMax(destination.data(), vertexCount, byteStride, desc);
+            }
+
+            bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+            bufferBuilder.AddAccessors(destination.data(), vertexCount, byteStride == elementSize ? 0U : byteStride, &desc, 1U);
+
+            result.attributes[attribute.first] = bufferBuilder.GetCurrentAccessor().id;
+        }
+
+        bufferBuilder.AddBufferView(BufferViewTarget::ELEMENT_ARRAY_BUFFER);
+        result.indicesAccessorId = bufferBuilder.AddIndicesAccessor(indices).id;
+
+        return result;
+    }
+
+    // Merges the sources that can be merged, in the order of each merged group's first source. Sources that can't be merged,
+    // or have nothing to merge with and nothing to bake, are copied unchanged.
+    std::vector<MeshPrimitive> MergeSources(const Document& doc, const GLTFResourceReader& reader, const std::vector<PrimitiveSource>& sources,
+        BufferBuilder& bufferBuilder)
+    {
+        std::vector<std::vector<PrimitiveSource>> groups;
+        std::unordered_map<std::string, size_t> groupIndices;
+
+        for (const auto& source : sources)
+        {
+            if (!CanMergePrimitive(*source.meshPrimitive))
+            {
+                groups.push_back({ source });
+                continue;
+            }
+
+            const auto result = groupIndices.emplace(GetMergeKey(doc, *source.meshPrimitive), groups.size());
+
+            if (result.second)
+            {
+                groups.emplace_back();
+            }
+
+            groups[result.first->second].push_back(source);
+        }
+
+        std::vector<MeshPrimitive> meshPrimitives;
+        meshPrimitives.reserve(groups.size());
+
+        for (const auto& group : groups)
+        {
+            if (group.size() == 1U && group.front().transform == Matrix4::IDENTITY)
+            {
+                meshPrimitives.push_back(*group.front().meshPrimitive);
+            }
+            else
+            {
+                meshPrimitives.push_back(WriteMergedPrimitive(doc, reader, group, bufferBuilder));
+            }
+        }
+
+        return meshPrimitives;
+    }
+
+    bool CanMergeNode(const Document& doc, const Node& node, const std::vector<size_t>& meshUseCounts)
+    {
+        if (node.meshId.empty()
+            || !node.children.empty()
+            || !node.cameraId.empty()
+            || !node.skinId.empty()
+            || !node.weights.empty()
+            || !node.extensions.empty()
+            || !node.GetExtensions().empty()
+            || !node.extras.empty()
+            || meshUseCounts[doc.meshes.GetIndex(node.meshId)] != 1U)
+        {
+            return false;
+        }
+
+        const auto& mesh = doc.meshes.Get(node.meshId);
+
+        if (!mesh.weights.empty() || !mesh.extensions.empty() || !mesh.GetExtensions().empty() || !mesh.extras.empty())
+        {
+            return false;
+        }
+
+        for (const auto& meshPrimitive : mesh.primitives)
+        {
+            if (!CanMergePrimitive(meshPrimitive) || !CanTransformPrimitive(doc, meshPrimitive))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+size_t SceneOptimizationUtils::CollapseNodes(Document& doc)
+{
+    const size_t nodeCount = doc.nodes.Size();
+    const auto hierarchy = PoseUtils::GetNodeHierarchy(doc);
+    const auto sceneCounts = GetSceneCounts(doc);
+    const auto referencedNodeIds = GetReferencedNodeIds(doc);
+
+    // The ids that take the place of each removed node in its parent's children (or its scenes' nodes) - its remaining
+    // children, or their replacements in turn
+    std::vector<bool> isRemoved(nodeCount, false);
+    std::vector<std::vector<std::string>> replacements(nodeCount);
+
+    const auto replaceIds = [&doc, &isRemoved, &replacements](const std::vector<std::string>& ids)
+    {
+        std::vector<std::string> result;
+        result.reserve(ids.size());
+
+        for (const auto& id : ids)
+        {
+            const size_t index = doc.nodes.GetIndex(id);
+
+            if (isRemoved[index])
+            {
+                result.insert(result.end(), replacements[index].begin(), replacements[index].end());
+            }
+            else
+            {
+                result.push_back(id);
+            }
+        }
+
+        return result;
+    };
+
+    size_t removedCount = 0U;
+
+    // Children before parents, so that a node whose children are all removed is itself an empty leaf
+    for (auto it = hierarchy.order.rbegin(); it != hierarchy.order.rend(); ++it)
+    {
+        const size_t index = *it;
+        const auto& node = doc.nodes[index];
+
+        const bool isChild = hierarchy.parents[index] != PoseUtils::NoParent;
+        const bool isRoot = sceneCounts[index] > 0U;
+
+        if (isChild == isRoot || HasContent(node) || referencedNodeIds.count(node.id) > 0U)
+        {
+            continue; // Not in the scene graph (or a node that is both a root and a child), or a node that can't be removed
+        }
+
+        auto children = replaceIds(node.children);
+
+        if (children.empty() || node.GetTransformationType() == TRANSFORMATION_IDENTITY)
+        {
+            isRemoved[index] = true;
+            replacements[index] = std::move(children);
+            ++removedCount;
+        }
+    }
+
+    if (removedCount == 0U)
+    {
+        return 0U;
+    }
+
+    // The removed nodes are removed by rebuilding the container, as removing them one at a time reindexes every node
+    IndexedContainer<const Node> nodes;
+    nodes.Reserve(nodeCount - removedCount);
+
+    for (size_t i = 0U; i < nodeCount; ++i)
+    {
+        if (!isRemoved[i])
+        {
+            Node node = doc.nodes[i];
+            node.children = replaceIds(node.children);
+
+            nodes.Append(std::move(node));
+        }
+    }
+
+    IndexedContainer<const Scene> scenes;
+    scenes.Reserve(doc.scenes.Size());
+
+    for (const auto& scene : doc.scenes.Elements())
+    {
+        Scene newScene = scene;
+        newScene.nodes = replaceIds(scene.nodes);
+
+        scenes.Append(std::move(newScene));
+    }
+
+    doc.nodes = std::move(nodes);
+    doc.scenes = std::move(scenes);
+
+    return removedCount;
+}
+
+size_t SceneOptimizationUtils::MergePrimitives(const Document& doc, const GLTFResourceReader& reader, Mesh& mesh, BufferBuilder& bufferBuilder)
+{
+    std::vector<PrimitiveSource> sources;
+    sources.reserve(mesh.primitives.size());
+
+    for (const auto& meshPrimitive : mesh.primitives)
+    {
+        sources.push_back({ &meshPrimitive, Matrix4::IDENTITY });
+    }
+
+    auto meshPrimitives = MergeSources(doc, reader, sources, bufferBuilder);
+
+    const size_t removedCount = mesh.primitives.size() - meshPrimitives.size();
+
+    mesh.primitives = std::move(meshPrimitives);
+
+    return removedCount;
+}
+
+size_t SceneOptimizationUtils::MergeMeshNodes(Document& doc, const GLTFResourceReader& reader, BufferBuilder& bufferBuilder)
+{
+    const size_t nodeCount = doc.nodes.Size();
+    const auto hierarchy = PoseUtils::GetNodeHierarchy(doc);
+    const auto referencedNodeIds = GetReferencedNodeIds(doc);
+
+    std::vector<size_t> meshUseCounts(doc.meshes.Size(), 0U);
+
+    for (const auto& node : doc.nodes.Elements())
+    {
+        if (!node.meshId.empty())
+        {
+            ++meshUseCounts[doc.meshes.GetIndex(node.meshId)];
+        }
+    }
+
+    // The scene of each root node, or an empty id if it's a root of more than one scene
+    std::vector<std::string> sceneIds(nodeCount);
+    std::vector<size_t> sceneCounts(nodeCount, 0U);
+
+    for (const auto& scene : doc.scenes.Elements())
+    {
+        for (const auto& nodeId : scene.nodes)
+        {
+            const size_t nodeIndex = doc.nodes.GetIndex(nodeId);
+
+            if (sceneCounts[nodeIndex]++ == 0U)
+            {
+                sceneIds[nodeIndex] = scene.id;
+            }
+            else
+            {
+                sceneIds[nodeIndex].clear();
+            }
+        }
+    }
+
+    // The indices of the nodes to merge, grouped by parent (or scene), with a prefix so a parent and a scene with the same
+    // id don't collide
+    std::vector<std::vector<size_t>> groups;
+    std::unordered_map<std::string, size_t> groupIndices;
+
+    for (size_t i = 0U; i < nodeCount; ++i)
+    {
+        const auto& node = doc.nodes[i];
+
+        if (!CanMergeNode(doc, node, meshUseCounts) || referencedNodeIds.count(node.id) > 0U)
+        {
+            continue;
+        }
+
+        if (AttributeTransforms(BoundsUtils::GetLocalTransform(node)).determinant == 0.0f)
+        {
+            continue; // A zero scale would leave the normals without a direction
+        }
+
+        std::string key;
+
+        if (hierarchy.parents[i] != PoseUtils::NoParent)
+        {
+            if (sceneCounts[i] > 0U)
+            {
+                continue; // A node can't be both a root and a child
+            }
+
+            key = "n" + doc.nodes[hierarchy.parents[i]].id;
+        }
+        else if (!sceneIds[i].empty())
+        {
+            key = "s" + sceneIds[i];
+        }
+        else
+        {
+            continue; // Not in any scene, or a root of several scenes
+        }
+
+        const auto result = groupIndices.emplace(std::move(key), groups.size());
+
+        if (result.second)
+        {
+            groups.emplace_back();
+        }
+
+        groups[result.first->second].push_back(i);
+    }
+
+    std::unordered_set<std::string> removedNodeIds;
+    std::unordered_set<std::string> removedMeshIds;
+
+    for (const auto& group : groups)
+    {
+        const auto& firstNode = doc.nodes[group.front()];
+
+        if (group.size() == 1U && firstNode.GetTransformationType() == TRANSFORMATION_IDENTITY)
+        {
+            continue; // Nothing to merge or bake
+        }
+
+        std::vector<PrimitiveSource> sources;
+
+        for (auto nodeIndex : group)
+        {
+            const auto& node = doc.nodes[nodeIndex];
+            const auto transform = BoundsUtils::GetLocalTransform(node);
+
+            for (const auto& meshPrimitive : doc.meshes.Get(node.meshId).primitives)
+            {
+                sources.push_back({ &meshPrimitive, transform });
+            }
+        }
+
+        Mesh mesh = doc.meshes.Get(firstNode.meshId);
+        mesh.primitives = MergeSources(doc, reader, sources, bufferBuilder);
+
+        Node node = firstNode;
+        node.matrix = Matrix4::IDENTITY;
+        node.translation = Vector3::ZERO;
+        node.rotation = Quaternion::IDENTITY;
+        node.scale = Vector3::ONE;
+
+        for (size_t i = 1U; i < group.size(); ++i)
+        {
+            removedNodeIds.insert(doc.nodes[group[i]].id);
+            removedMeshIds.insert(doc.nodes[group[i]].meshId);
+        }
+
+        doc.meshes.Replace(std::move(mesh));
+        doc.nodes.Replace(std::move(node));
+    }
+
+    if (removedNodeIds.empty())
+    {
+        return 0U;
+    }
+
+    // The merged nodes and their meshes are removed by rebuilding the containers, as removing them one at a time reindexes
+    // every element
+    IndexedContainer<const Node> nodes;
+    nodes.Reserve(nodeCount - removedNodeIds.size());
+
+    for (const auto& node : doc.nodes.Elements())
+    {
+        if (removedNodeIds.count(node.id) == 0U)
+        {
+            Node newNode = node;
+            newNode.children = RemoveIds(node.children, removedNodeIds);
+
+            nodes.Append(std::move(newNode));
+        }
+    }
+
+    IndexedContainer<const Mesh> meshes;
+    meshes.Reserve(doc.meshes.Size() - removedMeshIds.size());
+
+    for (const auto& mesh : doc.meshes.Elements())
+    {
+        if (removedMeshIds.count(mesh.id) == 0U)
+        {
+            meshes.Append(mesh);
+        }
+    }
+
+    IndexedContainer<const Scene> scenes;
+    scenes.Reserve(doc.scenes.Size());
+
+    for (const auto& scene : doc.scenes.Elements())
+    {
+        Scene newScene = scene;
+        newScene.nodes = RemoveIds(scene.nodes, removedNodeIds);
+
+        scenes.Append(std::move(newScene));
+    }
+
+    doc.nodes = std::move(nodes);
+    doc.meshes = std::move(meshes);
+    doc.scenes = std::move(scenes);
+
+    return removedNodeIds.size();
+}
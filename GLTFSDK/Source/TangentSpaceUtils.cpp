@@ -0,0 +1,366 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/TangentSpaceUtils.h>
+
+#include <GLTFSDK/BufferBuilder.h>
+#include <GLTFSDK/GLTFResourceReader.h>
+#include <GLTFSDK/MeshPrimitiveUtils.h>
+#include <GLTFSDK/ParallelUtils.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace Microsoft::glTF;
+
+namespace
+{
+    // The minimum number of triangles (or vertices) processed by each ParallelFor sub-range
+    constexpr size_t ParallelRangeSize = 1U << 12;
+
+    struct Vector
+    {
+        float x;
+        float y;
+        float z;
+    };
+
+    Vector operator+(const Vector& lhs, const Vector& rhs)
+    {
+        return { lhs.x + rhs.x, lhs.y + rhs.y, lhs.z + rhs.z };
+    }
+
+    Vector operator-(const Vector& lhs, const Vector& rhs)
+    {
+        return { lhs.x - rhs.x, lhs.y - rhs.y, lhs.z - rhs.z };
+    }
+
+    Vector operator*(const Vector& v, float s)
+    {
+        return { v.x * s, v.y * s, v.z * s };
+    }
+
+    Vector Cross(const Vector& lhs, const Vector& rhs)
+    {
+        return { lhs.y * rhs.z - lhs.z * rhs.y, lhs.z * rhs.x - lhs.x * rhs.z, lhs.x * rhs.y - lhs.y * rhs.x };
+    }
+
+    float Dot(const Vector& lhs, const Vector& rhs)
+    {
+        return lhs.x * rhs.x + lhs.y * rhs.y + lhs.z * rhs.z;
+    }
+
+    // Returns the normalized vector, or the zero vector if v has no length
+    Vector Normalize(const Vector& v)
+    {
+        const float length = std::sqrt(Dot(v, v));
+
+        return length > 0.0f ? v * (1.0f / length) : Vector{};
+    }
+
+    // Removes the component of v parallel to the unit vector n
+    Vector Project(const Vector& v, const Vector& n)
+    {
+        return v - n * Dot(n, v);
+    }
+
+    // Returns the angle between two unit vectors
+    float Angle(const Vector& lhs, const Vector& rhs)
+    {
+        return std::acos(std::max(-1.0f, std::min(1.0f, Dot(lhs, rhs))));
+    }
+
+    Vector GetVector(const std::vector<float>& values, size_t index)
+    {
+        return { values[index * 3U], values[index * 3U + 1U], values[index * 3U + 2U] };
+    }
+
+    void SetVector(std::vector<float>& values, size_t index, const Vector& v)
+    {
+        values[index * 3U] = v.x;
+        values[index * 3U + 1U] = v.y;
+        values[index * 3U + 2U] = v.z;
+    }
+
+    void ValidateIndices(const std::vector<uint32_t>& indices, size_t vertexCount)
+    {
+        if (indices.size() % 3U != 0U)
+        {
+            throw GLTFException("The number of triangle list indices must be a multiple of 3");
+        }
+
+        for (auto index : indices)
+        {
+            if (index >= vertexCount)
+            {
+                throw GLTFException("Index " + std::to_string(index) + " is out of range for " + std::to_string(vertexCount) + " vertices");
+            }
+        }
+    }
+
+    // The triangle corners (indices into the index array) that reference each vertex, in ascending order. The corners of
+    // vertex i are corners[offsets[i]] to corners[offsets[i + 1] - 1].
+    struct VertexCorners
+    {
+        std::vector<uint32_t> offsets;
+        std::vector<uint32_t> corners;
+    };
+
+    VertexCorners GetVertexCorners(const std::vector<uint32_t>& indices, size_t vertexCount)
+    {
+        VertexCorners result;
+
+        result.offsets.resize(vertexCount + 1U, 0U);
+        result.corners.resize(indices.size());
+
+        for (auto index : indices)
+        {
+            ++result.offsets[index + 1U];
+        }
+
+        for (size_t i = 0; i < vertexCount; ++i)
+        {
+            result.offsets[i + 1U] += result.offsets[i];
+        }
+
+        std::vector<uint32_t> next(result.offsets.begin(), result.offsets.end() - 1);
+
+        for (size_t i = 0; i < indices.size(); ++i)
+        {
+            result.corners[next[indices[i]]++] = static_cast<uint32_t>(i);
+        }
+
+        return result;
+    }
+
+    // Returns a unit vector perpendicular to the unit vector n
+    Vector GetPerpendicular(const Vector& n)
+    {
+        const Vector axis = std::abs(n.x) < 0.9f ? Vector{ 1.0f, 0.0f, 0.0f } : Vector{ 0.0f, 1.0f, 0.0f };
+
+        return Normalize(Project(axis, n));
+    }
+}
+
+std::vector<float> TangentSpaceUtils::GenerateNormals(const std::vector<uint32_t>& indices, const std::vector<float>& positions, NormalWeighting weighting)
+{
+    if (positions.size() % 3U != 0U)
+    {
+        throw GLTFException("The number of position components must be a multiple of 3");
+    }
+
+    const size_t vertexCount = positions.size() / 3U;
+
+    ValidateIndices(indices, vertexCount);
+
+    const size_t triangleCount = indices.size() / 3U;
+    const auto vertexCorners = GetVertexCorners(indices, vertexCount);
+
+    std::vector<Vector> cornerNormals(indices.size());
+    std::vector<float> normals(positions.size());
+
+    // Phase 0 writes the weighted normal of each triangle corner independently and phase 1 sums each vertex's corners in index
+    // order, so the floating point results are independent of the sub-ranges
+    ParallelUtils::ParallelForPhases({ triangleCount, vertexCount }, ParallelRangeSize, [&](size_t phase, size_t begin, size_t end)
+    {
+        if (phase == 0U)
+        {
+            for (size_t i = begin * 3U; i < end * 3U; i += 3U)
+            {
+                const Vector p[3] = { GetVector(positions, indices[i]), GetVector(positions, indices[i + 1U]), GetVector(positions, indices[i + 2U]) };
+
+                // The cross product's length is twice the triangle's area
+                const Vector normal = Cross(p[1] - p[0], p[2] - p[0]);
+
+                if (weighting == NormalWeighting::Area)
+                {
+                    cornerNormals[i] = cornerNormals[i + 1U] = cornerNormals[i + 2U] = normal;
+                }
+                else
+                {
+                    const Vector unitNormal = Normalize(normal);
+
+                    for (size_t j = 0; j < 3U; ++j)
+                    {
+                        const Vector& corner = p[j];
+                        const float angle = Angle(Normalize(p[(j + 1U) % 3U] - corner), Normalize(p[(j + 2U) % 3U] - corner));
+
+                        cornerNormals[i + j] = unitNormal * angle;
+                    }
+                }
+            }
+        }
+        else
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                Vector sum = {};
+
+                for (auto j = vertexCorners.offsets[i]; j < vertexCorners.offsets[i + 1U]; ++j)
+                {
+                    sum = sum + cornerNormals[vertexCorners.corners[j]];
+                }
+
+                const Vector normal = Normalize(sum);
+
+                SetVector(normals, i, Dot(normal, normal) > 0.0f ? normal : Vector{ 0.0f, 0.0f, 1.0f });
+            }
+        }
+    });
+
+    return normals;
+}
+
+std::vector<float> TangentSpaceUtils::GenerateTangents(const std::vector<uint32_t>& indices, const std::vector<float>& positions, const std::vector<float>& normals,
+    const std::vector<float>& texCoords)
+{
+    if (positions.size() % 3U != 0U)
+    {
+        throw GLTFException("The number of position components must be a multiple of 3");
+    }
+
+    const size_t vertexCount = positions.size() / 3U;
+
+    if (normals.size() != vertexCount * 3U)
+    {
+        throw GLTFException("The number of normals must match the number of positions");
+    }
+
+    if (texCoords.size() != vertexCount * 2U)
+    {
+        throw GLTFException("The number of texture coordinates must match the number of positions");
+    }
+
+    ValidateIndices(indices, vertexCount);
+
+    const size_t triangleCount = indices.size() / 3U;
+    const auto vertexCorners = GetVertexCorners(indices, vertexCount);
+
+    // The angle weighted tangent and bitangent of each corner, projected onto the plane of the vertex normal - zero if the
+    // triangle's texture coordinates are degenerate
+    std::vector<Vector> cornerTangents(indices.size());
+    std::vector<Vector> cornerBitangents(indices.size());
+    std::vector<float> tangents(vertexCount * 4U);
+
+    // As with GenerateNormals, phase 0 processes each triangle's corners and phase 1 sums each vertex's corners in index order
+    ParallelUtils::ParallelForPhases({ triangleCount, vertexCount }, ParallelRangeSize, [&](size_t phase, size_t begin, size_t end)
+    {
+        if (phase == 0U)
+        {
+            for (size_t t = begin; t < end; ++t)
+            {
+                const size_t i = t * 3U;
+
+                const Vector p[3] = { GetVector(positions, indices[i]), GetVector(positions, indices[i + 1U]), GetVector(positions, indices[i + 2U]) };
+
+                const float* uv0 = &texCoords[indices[i] * 2U];
+                const float* uv1 = &texCoords[indices[i + 1U] * 2U];
+                const float* uv2 = &texCoords[indices[i + 2U] * 2U];
+
+                const float s1 = uv1[0] - uv0[0];
+                const float t1 = uv1[1] - uv0[1];
+                const float s2 = uv2[0] - uv0[0];
+                const float t2 = uv2[1] - uv0[1];
+
+                // Twice the signed area of the triangle in texture space
+                const float signedArea = s1 * t2 - t1 * s2;
+
+                if (signedArea == 0.0f)
+                {
+                    continue;
+                }
+
+                const float sign = signedArea > 0.0f ? 1.0f : -1.0f;
+
+                // The directions of increasing s and t, scaled by the sign so they're independent of the triangle's texture
+                // space winding
+                const Vector tangent = ((p[1] - p[0]) * t2 - (p[2] - p[0]) * t1) * sign;
+                const Vector bitangent = ((p[2] - p[0]) * s1 - (p[1] - p[0]) * s2) * sign;
+
+                for (size_t j = 0; j < 3U; ++j)
+                {
+                    const Vector n = GetVector(normals, indices[i + j]);
+
+                    // As with MikkTSpace the corner angle is measured in the plane of the vertex normal
+                    const Vector& corner = p[j];
+                    const float angle = Angle(
+                        Normalize(Project(p[(j + 1U) % 3U] - corner, n)),
+                        Normalize(Project(p[(j + 2U) % 3U] - corner, n)));
+
+                    cornerTangents[i + j] = Normalize(Project(tangent, n)) * angle;
+                    cornerBitangents[i + j] = Normalize(Project(bitangent, n)) * angle;
+                }
+            }
+        }
+        else
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                Vector tangentSum = {};
+                Vector bitangentSum = {};
+
+                for (auto j = vertexCorners.offsets[i]; j < vertexCorners.offsets[i + 1U]; ++j)
+                {
+                    const auto corner = vertexCorners.corners[j];
+
+                    tangentSum = tangentSum + cornerTangents[corner];
+                    bitangentSum = bitangentSum + cornerBitangents[corner];
+                }
+
+                const Vector normal = Normalize(GetVector(normals, i));
+
+                Vector tangent = Normalize(tangentSum);
+
+                if (Dot(tangent, tangent) == 0.0f)
+                {
+                    tangent = GetPerpendicular(normal);
+                }
+
+                if (Dot(tangent, tangent) == 0.0f)
+                {
+                    tangent = { 1.0f, 0.0f, 0.0f };
+                }
+
+                tangents[i * 4U] = tangent.x;
+                tangents[i * 4U + 1U] = tangent.y;
+                tangents[i * 4U + 2U] = tangent.z;
+
+                // As with MikkTSpace the handedness compares the bitangent with cross(normal, tangent), which is how glTF
+                // reconstructs the bitangent from w, rather than relying on the triangles' winding agreeing with the normals
+                tangents[i * 4U + 3U] = Dot(Cross(normal, tangent), bitangentSum) < 0.0f ? -1.0f : 1.0f;
+            }
+        }
+    });
+
+    return tangents;
+}
+
+void TangentSpaceUtils::GenerateNormals(const Document& doc, const GLTFResourceReader& reader, MeshPrimitive& meshPrimitive, BufferBuilder& bufferBuilder,
+    NormalWeighting weighting)
+{
+    const auto positions = MeshPrimitiveUtils::GetPositions(doc, reader, meshPrimitive);
+    const auto indices = MeshPrimitiveUtils::GetTriangulatedIndices32(doc, reader, meshPrimitive);
+
+    const auto normals = GenerateNormals(indices, positions, weighting);
+
+    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+    meshPrimitive.attributes[ACCESSOR_NORMAL] = bufferBuilder.AddAccessor(normals, { TYPE_VEC3, COMPONENT_FLOAT }).id;
+}
+
+void TangentSpaceUtils::GenerateTangents(const Document& doc, const GLTFResourceReader& reader, MeshPrimitive& meshPrimitive, BufferBuilder& bufferBuilder)
+{
+    if (!meshPrimitive.HasAttribute(ACCESSOR_NORMAL) || !meshPrimitive.HasAttribute(ACCESSOR_TEXCOORD_0))
+    {
+        throw GLTFException("Generating tangents requires the " + std::string(ACCESSOR_NORMAL) + " and " + std::string(ACCESSOR_TEXCOORD_0) + " attributes");
+    }
+
+    const auto positions = MeshPrimitiveUtils::GetPositions(doc, reader, meshPrimitive);
+    const auto normals = MeshPrimitiveUtils::GetNormals(doc, reader, meshPrimitive);
+    const auto texCoords = MeshPrimitiveUtils::GetTexCoords_0(doc, reader, meshPrimitive);
+    const auto indices = MeshPrimitiveUtils::GetTriangulatedIndices32(doc, reader, meshPrimitive);
+
+    const auto tangents = GenerateTangents(indices, positions, normals, texCoords);
+
+    bufferBuilder.AddBufferView(BufferViewTarget::ARRAY_BUFFER);
+    meshPrimitive.attributes[ACCESSOR_TANGENT] = bufferBuilder.AddAccessor(tangents, { TYPE_VEC4, COMPONENT_FLOAT }).id;
+}
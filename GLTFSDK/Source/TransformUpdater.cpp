@@ -0,0 +1,288 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <GLTFSDK/TransformUpdater.h>
+
+#include <GLTFSDK/ParallelUtils.h>
+
+#include <algorithm>
+#include <atomic>
+
+using namespace Microsoft::glTF;
+
+namespace
+{
+    // Levels with fewer than two chunks of nodes aren't worth dividing between threads
+    constexpr size_t ChunkSize = 1U << 11;
+
+    bool IsWideLevel(size_t nodeCount)
+    {
+        return nodeCount >= 2U * ChunkSize;
+    }
+
+    // Calls updateNode(flatIndex) for the nodes of consecutive levels, levels[i] being the flat indices of the counts[i]
+    // nodes of the i-th level. Runs of narrow levels are updated on the calling thread. Each run of wide levels is divided
+    // between threads that are started once for the whole run and wait at a barrier between its levels, rather than being
+    // started for every level. Every node of a level costs the same so each level is divided evenly.
+    template<typename UpdateNode>
+    void UpdateLevels(const std::vector<const size_t*>& levels, const std::vector<size_t>& counts, const UpdateNode& updateNode)
+    {
+        size_t level = 0U;
+
+        while (level < levels.size())
+        {
+            for (; level < levels.size() && !IsWideLevel(counts[level]); ++level)
+            {
+                std::for_each(levels[level], levels[level] + counts[level], updateNode);
+            }
+
+            const size_t firstWideLevel = level;
+
+            while (level < levels.size() && IsWideLevel(counts[level]))
+            {
+                ++level;
+            }
+
+            if (firstWideLevel < level)
+            {
+                const std::vector<size_t> wideCounts(counts.begin() + firstWideLevel, counts.begin() + level);
+
+                ParallelUtils::ParallelForPhases(wideCounts, ChunkSize, [&](size_t phase, size_t begin, size_t end)
+                {
+                    const size_t* nodes = levels[firstWideLevel + phase];
+
+                    std::for_each(nodes + begin, nodes + end, updateNode);
+                });
+            }
+        }
+    }
+}
+
+TransformUpdater::TransformUpdater(const FlatSceneGraph& sceneGraph, std::vector<Matrix4> localTransforms)
+    : m_sceneGraph(sceneGraph),
+      m_localTransforms(std::move(localTransforms)),
+      m_worldTransforms(sceneGraph.GetNodeCount()),
+      m_dirty(sceneGraph.GetNodeCount(), 0U)
+{
+    const size_t nodeCount = sceneGraph.GetNodeCount();
+
+    if (m_localTransforms.size() != nodeCount)
+    {
+        throw GLTFException("The number of local transforms doesn't match the scene graph's node count");
+    }
+
+    // A counting sort of the nodes by depth, which keeps the nodes of each level in flat order
+    for (size_t i = 0U; i < nodeCount; ++i)
+    {
+        const size_t depth = sceneGraph.GetDepth(i);
+
+        if (m_levelOffsets.size() < depth + 2U)
+        {
+            m_levelOffsets.resize(depth + 2U, 0U);
+        }
+
+        ++m_levelOffsets[depth + 1U];
+    }
+
+    for (size_t level = 1U; level < m_levelOffsets.size(); ++level)
+    {
+        m_levelOffsets[level] += m_levelOffsets[level - 1U];
+    }
+
+    m_levelNodes.resize(nodeCount);
+
+    std::vector<size_t> levelSizes(m_levelOffsets.size(), 0U);
+
+    for (size_t i = 0U; i < nodeCount; ++i)
+    {
+        const size_t depth = sceneGraph.GetDepth(i);
+
+        m_levelNodes[m_levelOffsets[depth] + levelSizes[depth]++] = i;
+    }
+
+    UpdateAll();
+}
+
+size_t TransformUpdater::GetLevelCount() const
+{
+    return m_levelOffsets.empty() ? 0U : m_levelOffsets.size() - 1U;
+}
+
+const Matrix4& TransformUpdater::GetLocalTransform(size_t flatIndex) const
+{
+    return m_localTransforms.at(flatIndex);
+}
+
+const Matrix4& TransformUpdater::GetWorldTransform(size_t flatIndex) const
+{
+    return m_worldTransforms.at(flatIndex);
+}
+
+const std::vector<Matrix4>& TransformUpdater::GetWorldTransforms() const
+{
+    return m_worldTransforms;
+}
+
+void TransformUpdater::SetLocalTransform(size_t flatIndex, const Matrix4& localTransform)
+{
+    m_localTransforms.at(flatIndex) = localTransform;
+
+    if (!m_dirty[flatIndex])
+    {
+        m_dirty[flatIndex] = 1U;
+        m_dirtyNodes.push_back(flatIndex);
+    }
+}
+
+bool TransformUpdater::IsDirty() const
+{
+    return !m_dirtyNodes.empty();
+}
+
+size_t TransformUpdater::Update()
+{
+    if (m_dirtyNodes.empty())
+    {
+        return 0U;
+    }
+
+    const auto& parents = m_sceneGraph.GetParents();
+    const auto& subtreeSizes = m_sceneGraph.GetSubtreeSizes();
+
+    // Dirty nodes inside the subtree of another dirty node are updated along with it, so only the outermost ones are kept.
+    // Sorted by flat index, a node is inside the previous kept node's subtree if it's before the end of that subtree.
+    std::sort(m_dirtyNodes.begin(), m_dirtyNodes.end());
+
+    std::vector<size_t> roots;
+    size_t subtreeEnd = 0U;
+    size_t updatedCount = 0U;
+
+    for (auto flatIndex : m_dirtyNodes)
+    {
+        m_dirty[flatIndex] = 0U;
+
+        if (roots.empty() || flatIndex >= subtreeEnd)
+        {
+            roots.push_back(flatIndex);
+            subtreeEnd = flatIndex + subtreeSizes[flatIndex];
+            updatedCount += subtreeSizes[flatIndex];
+        }
+    }
+
+    m_dirtyNodes.clear();
+
+    // Each subtree is contiguous and ordered parents first, so it's updated by a linear scan. The subtrees are independent
+    // and are divided between threads if there are enough of them.
+    const auto updateSubtrees = [this, &roots, &parents, &subtreeSizes](size_t begin, size_t end)
+    {
+        for (size_t r = begin; r < end; ++r)
+        {
+            const size_t root = roots[r];
+
+            for (size_t i = root; i < root + subtreeSizes[root]; ++i)
+            {
+                const size_t parent = parents[i];
+
+                m_worldTransforms[i] = parent == FlatSceneGraph::NoParent ? m_localTransforms[i] : Math::Multiply(m_worldTransforms[parent], m_localTransforms[i]);
+            }
+        }
+    };
+
+    if (updatedCount < 2U * ChunkSize || ParallelUtils::GetConcurrency() < 2U)
+    {
+        updateSubtrees(0U, roots.size());
+    }
+    else if (roots.size() == 1U)
+    {
+        // A single large subtree is updated level by level instead, if any of its levels are wide enough to divide
+        const size_t root = roots.front();
+        const size_t rootDepth = m_sceneGraph.GetDepth(root);
+
+        std::vector<const size_t*> levels;
+        std::vector<size_t> counts;
+
+        for (size_t level = rootDepth + 1U; level + 1U < m_levelOffsets.size(); ++level)
+        {
+            // The level's nodes in the subtree are contiguous as the nodes of each level are in flat order
+            const auto levelBegin = m_levelNodes.begin() + m_levelOffsets[level];
+            const auto levelEnd = m_levelNodes.begin() + m_levelOffsets[level + 1U];
+
+            const auto first = std::lower_bound(levelBegin, levelEnd, root);
+            const auto last = std::lower_bound(first, levelEnd, root + subtreeSizes[root]);
+
+            if (first == last)
+            {
+                break;
+            }
+
+            levels.push_back(&*first);
+            counts.push_back(static_cast<size_t>(last - first));
+        }
+
+        if (std::none_of(counts.begin(), counts.end(), IsWideLevel))
+        {
+            updateSubtrees(0U, 1U);
+        }
+        else
+        {
+            m_worldTransforms[root] = parents[root] == FlatSceneGraph::NoParent ? m_localTransforms[root] : Math::Multiply(m_worldTransforms[parents[root]], m_localTransforms[root]);
+
+            UpdateLevels(levels, counts, [this, &parents](size_t node)
+            {
+                m_worldTransforms[node] = Math::Multiply(m_worldTransforms[parents[node]], m_localTransforms[node]);
+            });
+        }
+    }
+    else
+    {
+        // Claims subtrees one at a time, as their sizes can vary widely
+        std::atomic<size_t> nextRoot(0U);
+
+        ParallelUtils::ParallelFor(std::min(ParallelUtils::GetConcurrency(), roots.size()), 1U, [&](size_t, size_t)
+        {
+            for (size_t r = nextRoot++; r < roots.size(); r = nextRoot++)
+            {
+                updateSubtrees(r, r + 1U);
+            }
+        });
+    }
+
+    return updatedCount;
+}
+
+void TransformUpdater::UpdateAll()
+{
+    std::vector<const size_t*> levels;
+    std::vector<size_t> counts;
+
+    for (size_t level = 0U; level + 1U < m_levelOffsets.size(); ++level)
+    {
+        levels.push_back(m_levelNodes.data() + m_levelOffsets[level]);
+        counts.push_back(m_levelOffsets[level + 1U] - m_levelOffsets[level]);
+    }
+
+    // Flat order visits parents first and accesses the transforms sequentially, so unless there are levels to divide between
+    // threads a linear scan is faster than a pass per level
+    if (ParallelUtils::GetConcurrency() < 2U || std::none_of(counts.begin(), counts.end(), IsWideLevel))
+    {
+        m_sceneGraph.ComputeWorldTransforms(m_localTransforms.data(), m_worldTransforms.data());
+    }
+    else
+    {
+        const auto& parents = m_sceneGraph.GetParents();
+
+        UpdateLevels(levels, counts, [this, &parents](size_t node)
+        {
+            const size_t parent = parents[node];
+
+            m_worldTransforms[node] = parent == FlatSceneGraph::NoParent ? m_localTransforms[node] : Math::Multiply(m_worldTransforms[parent], m_localTransforms[node]);
+        });
+    }
+
+    for (auto flatIndex : m_dirtyNodes)
+    {
+        m_dirty[flatIndex] = 0U;
+    }
+
+    m_dirtyNodes.clear();
+}
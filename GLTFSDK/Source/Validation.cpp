@@ -4,6 +4,7 @@
 #include <GLTFSDK/Validation.h>
 
 #include <GLTFSDK/BufferBuilder.h>
+#include <GLTFSDK/ExtensionsKHR.h>
 
 #include <sstream>
 
@@ -210,14 +211,30 @@ void Validation::ValidateMeshPrimitiveAttributeAccessors(
         { ACCESSOR_WEIGHTS_0,  { { TYPE_VEC4 },            { COMPONENT_FLOAT, COMPONENT_UNSIGNED_BYTE, COMPONENT_UNSIGNED_SHORT } } }
     };
 
+    // https://github.com/KhronosGroup/glTF/tree/master/extensions/2.0/Khronos/KHR_mesh_quantization
+    static const std::unordered_map <std::string, std::pair<std::unordered_set<AccessorType>, std::unordered_set<ComponentType>>> quantizedAttributeDefinitions =
+    {
+        { ACCESSOR_POSITION,   { { TYPE_VEC3 },            { COMPONENT_FLOAT, COMPONENT_BYTE, COMPONENT_UNSIGNED_BYTE, COMPONENT_SHORT, COMPONENT_UNSIGNED_SHORT } } },
+        { ACCESSOR_NORMAL,     { { TYPE_VEC3 },            { COMPONENT_FLOAT, COMPONENT_BYTE, COMPONENT_SHORT } } },
+        { ACCESSOR_TANGENT,    { { TYPE_VEC4 },            { COMPONENT_FLOAT, COMPONENT_BYTE, COMPONENT_SHORT } } },
+        { ACCESSOR_TEXCOORD_0, { { TYPE_VEC2 },            { COMPONENT_FLOAT, COMPONENT_BYTE, COMPONENT_UNSIGNED_BYTE, COMPONENT_SHORT, COMPONENT_UNSIGNED_SHORT } } },
+        { ACCESSOR_TEXCOORD_1, { { TYPE_VEC2 },            { COMPONENT_FLOAT, COMPONENT_BYTE, COMPONENT_UNSIGNED_BYTE, COMPONENT_SHORT, COMPONENT_UNSIGNED_SHORT } } },
+        { ACCESSOR_COLOR_0,    { { TYPE_VEC3, TYPE_VEC4 }, { COMPONENT_FLOAT, COMPONENT_UNSIGNED_BYTE, COMPONENT_UNSIGNED_SHORT } } },
+        { ACCESSOR_JOINTS_0,   { { TYPE_VEC4 },            {                  COMPONENT_UNSIGNED_BYTE, COMPONENT_UNSIGNED_SHORT } } },
+        { ACCESSOR_WEIGHTS_0,  { { TYPE_VEC4 },            { COMPONENT_FLOAT, COMPONENT_UNSIGNED_BYTE, COMPONENT_UNSIGNED_SHORT } } }
+    };
+
+    const bool isQuantized = doc.extensionsUsed.find(KHR::MeshPrimitives::MESHQUANTIZATION_NAME) != doc.extensionsUsed.end();
+    const auto& definitions = isQuantized ? quantizedAttributeDefinitions : attributeDefinitions;
+
     // TODO: Validate by prefix TEXCOORD_/COLOR_/JOINTS_/WEIGHTS_ 
     for (const auto& attribute : attributes)
     {
         const auto& attributeName = attribute.first;
         const auto& attributeAccessorId = attribute.second;
 
-        const auto it = attributeDefinitions.find(attributeName);
-        if (it != attributeDefinitions.end())
+        const auto it = definitions.find(attributeName);
+        if (it != definitions.end())
         {
             const auto& accessor = doc.accessors.Get(attributeAccessorId);
             ValidateAccessorTypes(accessor, attributeName, it->second.first, it->second.second);